@@ -37,17 +37,12 @@ cChunk::cChunk()
  */
 Execution cChunk::ToType(unsigned short chunkToConvert, int* resultedType)
 {
-    chunkToConvert = chunkToConvert & 0xFF00;
-    
-    switch(chunkToConvert)
+    unsigned char chunkClass = ClassOf(chunkToConvert);
+
+    if(chunkClass != 0)
     {
-        case(ChunkType::Byte):
-        case(ChunkType::Check):
-        case(ChunkType::Div):
-        case(ChunkType::Start):
-            *resultedType = chunkToConvert;
-            return Execution::Passed;
-        break;        
+        *resultedType = (chunkClass - 1) << 8;
+        return Execution::Passed;
     }
 
     // Incorrect Chunk type given.
@@ -69,6 +64,305 @@ Execution cChunk::ToUART(unsigned short chunkToSend, unsigned char* resulted2byt
     return (Data.ToBytes(chunkToSend, resulted2bytes, 2));
 }
 
+/**
+ * @brief Packs a whole plane in a single
+ * UART frame where each chunk only takes
+ * its 10 bits. The frame is PACKED_UART_MARKER,
+ * the amount of chunks, then the chunks as a
+ * little endian bitstream padded with 0s.
+ * Only use it once the other side accepted
+ * WireMode::Packed.
+ * @param chunksToSend
+ * The plane to pack.
+ * @param count
+ * Amount of chunks in the plane. 2 to MAX_PLANE_PASSENGER_CAPACITY.
+ * @param resultedBytes
+ * Where the frame is placed. Must hold PACKED_UART_SIZE(count) bytes.
+ * @param resultedSize
+ * Where the amount of bytes of the frame is placed.
+ * @return Execution::Passed = Packed | Execution::Failed = Invalid count or a value is not a chunk
+ */
+Execution cChunk::ToPackedUART(unsigned short* chunksToSend, int count, unsigned char* resultedBytes, int* resultedSize)
+{
+    if(count < 2 || count > MAX_PLANE_PASSENGER_CAPACITY)
+    {
+        Device.SetErrorMessage("89:Chunk -> Packed count      ");
+        return Execution::Failed;
+    }
+
+    resultedBytes[0] = PACKED_UART_MARKER;
+    resultedBytes[1] = (unsigned char)count;
+
+    unsigned char* cursor = &resultedBytes[PACKED_UART_HEADER_SIZE];
+    unsigned short outOfRange = 0;
+    unsigned int bits = 0;
+    int bitCount = 0;
+
+    int index = 0;
+
+    // Whole groups: 4 chunks, 40 bits, 5 bytes.
+    for(; index + 4 <= count; index += 4)
+    {
+        unsigned short c0 = chunksToSend[index];
+        unsigned short c1 = chunksToSend[index + 1];
+        unsigned short c2 = chunksToSend[index + 2];
+        unsigned short c3 = chunksToSend[index + 3];
+        outOfRange |= c0 | c1 | c2 | c3;
+
+        cursor[0] = (unsigned char)c0;
+        cursor[1] = (unsigned char)((c0 >> 8) & 0x03) | (unsigned char)(c1 << 2);
+        cursor[2] = (unsigned char)((c1 >> 6) & 0x0F) | (unsigned char)(c2 << 4);
+        cursor[3] = (unsigned char)((c2 >> 4) & 0x3F) | (unsigned char)(c3 << 6);
+        cursor[4] = (unsigned char)(c3 >> 2);
+        cursor += 5;
+    }
+
+    // Last 1 to 3 chunks. Never more than 17 bits waiting in bits.
+    for(; index < count; index++)
+    {
+        unsigned short chunk = chunksToSend[index];
+        outOfRange |= chunk;
+        bits |= (unsigned int)(chunk & 0x03FF) << bitCount;
+        bitCount += 10;
+
+        while(bitCount >= 8)
+        {
+            *cursor++ = (unsigned char)bits;
+            bits >>= 8;
+            bitCount -= 8;
+        }
+    }
+
+    if(bitCount > 0)
+    {
+        *cursor++ = (unsigned char)bits;
+    }
+
+    if(outOfRange & 0xFC00)
+    {
+        Device.SetErrorMessage("143:Chunk -> Chunk above 1023  ");
+        return Execution::Failed;
+    }
+
+    *resultedSize = (int)(cursor - resultedBytes);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Unpacks a frame made by ToPackedUART.
+ * The frame is only accepted if it holds a
+ * plane: a start chunk, byte and div chunks,
+ * then a check chunk. This is what lets a
+ * receiver find the next frame after noise.
+ * @param frame
+ * The received frame, marker included.
+ * @param frameSize
+ * Amount of bytes received.
+ * @param resultedChunks
+ * Where the chunks are placed. Must hold MAX_PLANE_PASSENGER_CAPACITY chunks.
+ * @param resultedCount
+ * Where the amount of chunks is placed.
+ * @return Execution::Passed = Unpacked | Execution::Failed = Not a frame or not a plane | Execution::Incompatibility = frameSize does not match the frame's chunk count
+ */
+Execution cChunk::FromPackedUART(unsigned char* frame, int frameSize, unsigned short* resultedChunks, int* resultedCount)
+{
+    if(frameSize < PACKED_UART_SIZE(2) || frame[0] != PACKED_UART_MARKER || frame[1] < 2)
+    {
+        return Execution::Failed;
+    }
+
+    int count = frame[1];
+    if(frameSize != PACKED_UART_SIZE(count))
+    {
+        return Execution::Incompatibility;
+    }
+
+    unsigned char* cursor = &frame[PACKED_UART_HEADER_SIZE];
+    unsigned int bits = 0;
+    int bitCount = 0;
+    bool misplacedChunk = false;
+
+    for(int index = 0; index < count; index++)
+    {
+        while(bitCount < 10)
+        {
+            bits |= (unsigned int)(*cursor++) << bitCount;
+            bitCount += 8;
+        }
+
+        unsigned short chunk = (unsigned short)(bits & 0x03FF);
+        bits >>= 10;
+        bitCount -= 10;
+
+        resultedChunks[index] = chunk;
+        // Start and check chunks have the 0x200 bit. Only the first and last chunks may have it.
+        misplacedChunk |= (index != 0 && index != count - 1 && (chunk & ChunkType::Start));
+    }
+
+    if(misplacedChunk
+       || ClassOf(resultedChunks[0]) != ClassOf(ChunkType::Start)
+       || ClassOf(resultedChunks[count - 1]) != ClassOf(ChunkType::Check))
+    {
+        return Execution::Failed;
+    }
+
+    *resultedCount = count;
+    return Execution::Passed;
+}
+
+/// @brief Bits checked by each Hamming parity bit of a protected chunk, parity bit and PROTECTED_UART_FLAG included.
+#define PROTECTED_UART_P1_BITS 0xAAAA
+#define PROTECTED_UART_P2_BITS 0xCCCC
+#define PROTECTED_UART_P4_BITS 0xF0F0
+#define PROTECTED_UART_P8_BITS 0xFF00
+
+/**
+ * @brief Same as ToUART, but the 6 bits that
+ * ToUART leaves empty are used. Bits 1 to 14
+ * are a Hamming code of the chunk (parity at
+ * 1, 2, 4 and 8), bit 0 is the parity of the
+ * whole code and bit 15 is PROTECTED_UART_FLAG.
+ * Only use it once the other side accepted
+ * WireMode::Protected.
+ * @param chunkToSend
+ * The chunk to protect.
+ * @param resulted2bytes
+ * 0: Second to send, 1: First to send. Same as ToUART.
+ * @return Execution::Passed = Protected | Execution::Failed = Value is not a chunk
+ */
+Execution cChunk::ToProtectedUART(unsigned short chunkToSend, unsigned char* resulted2bytes)
+{
+    if(chunkToSend & 0xFC00)
+    {
+        Device.SetErrorMessage("237:Chunk -> Chunk above 1023  ");
+        return Execution::Failed;
+    }
+
+    // Data bits go everywhere but bit 0 and the powers of 2. Bit 15 is the flag, coded like data so it can be corrected.
+    unsigned int code = ((chunkToSend & 0x0001) << 3)
+                      | ((chunkToSend & 0x000E) << 4)
+                      | ((chunkToSend & 0x03F0) << 5)
+                      | PROTECTED_UART_FLAG;
+
+    code |= __builtin_parity(code & PROTECTED_UART_P1_BITS) << 1;
+    code |= __builtin_parity(code & PROTECTED_UART_P2_BITS) << 2;
+    code |= __builtin_parity(code & PROTECTED_UART_P4_BITS) << 4;
+    code |= __builtin_parity(code & PROTECTED_UART_P8_BITS) << 8;
+    code |= __builtin_parity(code);
+
+    resulted2bytes[0] = (unsigned char)code;
+    resulted2bytes[1] = (unsigned char)(code >> 8);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Gets the chunk back from 2 bytes
+ * made by ToProtectedUART. A single flipped
+ * bit is corrected, PROTECTED_UART_FLAG
+ * included. Two flipped bits are detected.
+ * @param received2bytes
+ * 0: Second received, 1: First received.
+ * @param resultedChunk
+ * Where the chunk is placed.
+ * @param corrected
+ * Set to true if a flipped bit was corrected.
+ * @return Execution::Passed = Chunk is good | Execution::Failed = Not a protected chunk or more than one flipped bit
+ */
+Execution cChunk::FromProtectedUART(unsigned char* received2bytes, unsigned short* resultedChunk, bool* corrected)
+{
+    unsigned int code = received2bytes[0] | (received2bytes[1] << 8);
+
+    // The syndrome is the position of the flipped bit.
+    unsigned int syndrome = __builtin_parity(code & PROTECTED_UART_P1_BITS)
+                          | __builtin_parity(code & PROTECTED_UART_P2_BITS) << 1
+                          | __builtin_parity(code & PROTECTED_UART_P4_BITS) << 2
+                          | __builtin_parity(code & PROTECTED_UART_P8_BITS) << 3;
+    bool oddParity = __builtin_parity(code);
+
+    *corrected = false;
+    if(oddParity)
+    {
+        // One bit flipped.
+        code ^= 1u << syndrome;
+        *corrected = true;
+    }
+    else if(syndrome != 0)
+    {
+        // Two bits flipped.
+        return Execution::Failed;
+    }
+
+    // Closest to a code without the flag: this never was a protected chunk.
+    if(!(code & PROTECTED_UART_FLAG))
+    {
+        return Execution::Failed;
+    }
+
+    *resultedChunk = (unsigned short)(((code >> 3) & 0x0001)
+                                    | ((code >> 4) & 0x000E)
+                                    | ((code >> 5) & 0x03F0));
+    return Execution::Passed;
+}
+
+/**
+ * @brief Drops the first bytes of the frame
+ * being received, then every byte up to the
+ * next PACKED_UART_MARKER.
+ * @param from
+ * Amount of bytes to drop no matter what.
+ */
+void cPackedUARTReceiver::_Resync(int from)
+{
+    int next = from;
+    while(next < _received && _frame[next] != PACKED_UART_MARKER)
+    {
+        next++;
+    }
+
+    droppedBytes += next - from;
+    _received -= next;
+    memmove(_frame, &_frame[next], _received);
+}
+
+/**
+ * @brief Gives the receiver the next byte
+ * read from the UART.
+ * @return Execution::Passed = A plane landed in plane | Execution::Bypassed = Waiting for more bytes | Execution::Failed = Bytes were dropped and nothing landed
+ */
+Execution cPackedUARTReceiver::Receive(unsigned char byte)
+{
+    Execution result = Execution::Bypassed;
+
+    if(_received == 0 && byte != PACKED_UART_MARKER)
+    {
+        droppedBytes++;
+        return Execution::Failed;
+    }
+    _frame[_received++] = byte;
+
+    // After a resync, what is left may already hold a whole frame.
+    while(_received >= PACKED_UART_HEADER_SIZE)
+    {
+        int frameSize = PACKED_UART_SIZE(_frame[1]);
+        if(_frame[1] >= 2 && _received < frameSize)
+        {
+            return result;
+        }
+
+        if(_frame[1] >= 2 && Chunk.FromPackedUART(_frame, frameSize, plane, &planeSize) == Execution::Passed)
+        {
+            _Resync(frameSize);
+            return Execution::Passed;
+        }
+
+        // Not a plane. The marker was noise or the frame got corrupted.
+        droppedBytes++;
+        _Resync(1);
+        result = Execution::Failed;
+    }
+    return result;
+}
+
 /**
  * @brief Function that converts a chunk
  * to an unsigned char single byte.
@@ -86,7 +380,7 @@ Execution cChunk::ToUART(unsigned short chunkToSend, unsigned char* resulted2byt
  */
 Execution cChunk::ToByte(unsigned short chunkToConvert, unsigned char* resultedByte)
 {
-    if(chunkToConvert > 1023)
+    if(ClassOf(chunkToConvert) == 0)
     {
         Device.SetErrorMessage("77:Chunk -> Chunk above 1203  ");
         Serial.println(chunkToConvert);
@@ -140,3 +434,88 @@ Execution cChunk::ToChunk(unsigned char byteToConvert, unsigned short* resultedC
     return Execution::Passed;
 
 }
+
+/**
+ * @brief Converts a whole array of bytes
+ * to chunks of the same ChunkType.
+ * @param bytesToConvert
+ * Bytes to convert.
+ * @param count
+ * How many bytes to convert.
+ * @param resultedChunks
+ * Where the chunks are placed. Must hold count chunks.
+ * @param typeToApply
+ * ChunkType given to every chunk.
+ * @return Execution::Passed = Converted | Execution::Failed = Invalid ChunkType
+ */
+Execution cChunk::ToChunks(unsigned char* bytesToConvert, int count, unsigned short* resultedChunks, int typeToApply)
+{
+    // The type is checked once for the whole array.
+    if((typeToApply & 0x00FF) != 0 || typeToApply < 0 || typeToApply > ChunkType::Check)
+    {
+        return Execution::Failed;
+    }
+
+    unsigned short type = (unsigned short)typeToApply;
+    for(int index = 0; index < count; index++)
+    {
+        resultedChunks[index] = type | bytesToConvert[index];
+    }
+    return Execution::Passed;
+}
+
+/**
+ * @brief Classifies a whole array of chunks
+ * into a bitmap of the ChunkTypes found in it.
+ * See CHUNK_TYPE_BIT and CHUNK_INVALID_BIT.
+ * @param chunksToConvert
+ * Chunks to look at.
+ * @param count
+ * How many chunks to look at.
+ * @param resultedTypeBitmap
+ * Where the bitmap is placed.
+ * @return Execution::Passed = All chunks are valid | Execution::Failed = At least one value is not a chunk
+ */
+Execution cChunk::ToTypes(unsigned short* chunksToConvert, int count, unsigned char* resultedTypeBitmap)
+{
+    unsigned int bitmap = 0;
+
+    for(int index = 0; index < count; index++)
+    {
+        bitmap |= 1u << ClassOf(chunksToConvert[index]);
+    }
+
+    *resultedTypeBitmap = (unsigned char)bitmap;
+    return (bitmap & CHUNK_INVALID_BIT) ? Execution::Failed : Execution::Passed;
+}
+
+/**
+ * @brief Extracts the byte of a whole
+ * array of chunks, whatever their type.
+ * @param chunksToConvert
+ * Chunks to extract bytes from.
+ * @param count
+ * How many chunks to convert.
+ * @param resultedBytes
+ * Where the bytes are placed. Must hold count bytes.
+ * @return Execution::Passed = Converted | Execution::Failed = At least one value is not a chunk
+ */
+Execution cChunk::ToBytes(unsigned short* chunksToConvert, int count, unsigned char* resultedBytes)
+{
+    // Anything above 1023 has one of these bits set.
+    unsigned short outOfRange = 0;
+
+    for(int index = 0; index < count; index++)
+    {
+        unsigned short chunk = chunksToConvert[index];
+        outOfRange |= chunk;
+        resultedBytes[index] = (unsigned char)chunk;
+    }
+
+    if(outOfRange & 0xFC00)
+    {
+        Device.SetErrorMessage("218:Chunk -> Chunk above 1023  ");
+        return Execution::Failed;
+    }
+    return Execution::Passed;
+}
@@ -56,6 +56,16 @@
         #define UT_CBFIO_ERROR_CODE 7,200,5000
         ///@brief Error code given when cBFIO fails its unit test.
         #define UT_CPACKET_ERROR_CODE 8,200,5000
+        ///@brief Error code given when cTerminal fails its unit test.
+        #define UT_CTERMINAL_ERROR_CODE 9,200,5000
+        ///@brief Error code given when cTower fails its unit test.
+        #define UT_CTOWER_ERROR_CODE 10,200,5000
+        ///@brief Error code given when cScheduler fails its unit test.
+        #define UT_CSCHEDULER_ERROR_CODE 11,200,5000
+        ///@brief Error code given when cInputSampler fails its unit test.
+        #define UT_CINPUTSAMPLER_ERROR_CODE 12,200,5000
+        ///@brief Error code given when cAdcScanner fails its unit test.
+        #define UT_CADCSCANNER_ERROR_CODE 13,200,5000
     #pragma endregion
   #pragma endregion
 
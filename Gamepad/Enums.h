@@ -186,4 +186,51 @@ enum GateStatus
     AvailableArrival
 
 };
+
+/**
+ * @brief How chunks are laid on the UART.
+ * Unpacked is the default and what any BFIO
+ * device understands. Packed is only used
+ * once both sides agreed on it during the
+ * handshake. See cChunk::ToPackedUART.
+ */
+enum WireMode
+{
+    /// @brief Each chunk takes 2 UART bytes. See cChunk::ToUART.
+    Unpacked,
+    /// @brief 4 chunks take 5 UART bytes, in frames that start with PACKED_UART_MARKER.
+    Packed,
+    /// @brief Each chunk takes 2 UART bytes, the spare bits hold a SEC-DED code. See cChunk::ToProtectedUART.
+    Protected
+};
+
+/**
+ * @brief What a plane's Check chunk carries.
+ * AdditiveSum is the default and what any BFIO
+ * device understands. CRC8 is only used once
+ * both sides agreed on it during the handshake.
+ */
+enum PlaneCheck
+{
+    /// @brief 8 bits sum of the ID and every Byte chunk.
+    AdditiveSum,
+    /// @brief CRC-8 of every chunk before the Check chunk. See cPacket::GetCRC8.
+    CRC8
+};
+
+/**
+ * @brief Lanes of a terminal's departure
+ * taxiway. Planes in the Priority lane always
+ * take off before planes in the Bulk lane.
+ * See cTerminal::LaneOf.
+ */
+enum TaxiwayLane
+{
+    /// @brief Latency critical planes, like hardware inputs and pings.
+    Priority,
+    /// @brief Large planes that can wait, like UniversalInfo and ErrorMessage.
+    Bulk,
+    /// @brief Amount of lanes.
+    TaxiwayLaneCount
+};
 #endif
\ No newline at end of file
@@ -25,41 +25,106 @@
 //=============================================//
 //	Defines
 //=============================================//
-#define PING_PARAM_COUNT 1
-#define PING_PASSENGER_CAPACITY 4
 #define PING_PLANE_ID 0
+#define PING_PARAM_COUNT (cPlane_Ping::parameterCount)
+#define PING_PASSENGER_CAPACITY (cPlane_Ping::size)
 
-#define STATUS_PARAM_COUNT 1
-#define STATUS_PASSENGER_CAPACITY 4
 #define STATUS_PLANE_ID 1
+#define STATUS_PARAM_COUNT (cPlane_Status::parameterCount)
+#define STATUS_PASSENGER_CAPACITY (cPlane_Status::size)
+
+#define HANDSHAKE_PLANE_ID 2
+#define HANDSHAKE_PARAM_COUNT (cPlane_Handshake::parameterCount)
+#define HANDSHAKE_PASSENGER_CAPACITY (cPlane_Handshake::size)
+/// @brief Handshake flag asking for PlaneCheck::CRC8. The handshake carrying it is checked with it.
+#define HANDSHAKE_CRC8 0x01
+/// @brief Handshake flag asking for sequence tags. See cTerminal::sequenceTags.
+#define HANDSHAKE_SEQUENCE_TAGS 0x02
 
-#define TYPE_PARAM_COUNT 1
-#define TYPE_PASSENGER_CAPACITY 4
 #define TYPE_PLANE_ID 4
+#define TYPE_PARAM_COUNT (cPlane_Type::parameterCount)
+#define TYPE_PASSENGER_CAPACITY (cPlane_Type::size)
 
 #define ERRORMESSAGE_PARAM_COUNT 1
 #define ERRORMESSAGE_PASSENGER_CAPACITY 22
 #define ERRORMESSAGE_PLANE_ID 3
 
-#define ID_PARAM_COUNT 1
-#define ID_PASSENGER_CAPACITY 10
 #define ID_PLANE_ID 5
+#define ID_PARAM_COUNT (cPlane_ID::parameterCount)
+#define ID_PASSENGER_CAPACITY (cPlane_ID::size)
 
-#define RESTART_PARAM_COUNT 0
-#define RESTART_PASSENGER_CAPACITY 2
 #define RESTART_PLANE_ID 6
+#define RESTART_PARAM_COUNT (cPlane_Restart::parameterCount)
+#define RESTART_PASSENGER_CAPACITY (cPlane_Restart::size)
 
 #define UNIVERSALINFO_PARAM_COUNT 7
 //#define UNIVERSALINFO_PASSENGER_CAPACITY 2 + 8 + 8 + 1 + 1 + str + str
 #define UNIVERSALINFO_PLANE_ID 7
 
-#define HANDLINGERROR_PARAM_COUNT 1
-#define HANDLINGERROR_PASSENGER_CAPACITY 4
 #define HANDLINGERROR_PLANE_ID 8
+#define HANDLINGERROR_PARAM_COUNT (cPlane_HandlingError::parameterCount)
+#define HANDLINGERROR_PASSENGER_CAPACITY (cPlane_HandlingError::size)
+
+#define RESPONSECURVE_PLANE_ID 29
+#define RESPONSECURVE_PARAM_COUNT (cPlane_ResponseCurve::parameterCount)
+#define RESPONSECURVE_PASSENGER_CAPACITY (cPlane_ResponseCurve::size)
+/// @brief Points a ResponseCurve plane carries. Must match JOYSTICK_CURVE_POINTS.
+#define RESPONSECURVE_POINT_COUNT 8
+/// @brief Radial deadzone units of a ResponseCurve plane. 255 is almost JOYSTICK_MAX_RADIAL_DEADZONE.
+#define RESPONSECURVE_RADIAL_DEADZONE_STEP 4
+
+/// @brief Requests a gate can have in flight at once when its terminal uses sequence tags.
+#define MAX_REQUESTS_IN_FLIGHT 4
+//=============================================//
+//	Plane schemas
+//=============================================//
+// Sizes above are computed from these. Planes
+// carrying strings (ErrorMessage, UniversalInfo)
+// have no fixed size and are not described here.
+typedef cPlaneSchema<PING_PLANE_ID, bool>                   cPlane_Ping;
+typedef cPlaneSchema<STATUS_PLANE_ID, int>                  cPlane_Status;
+typedef cPlaneSchema<HANDSHAKE_PLANE_ID, unsigned char>     cPlane_Handshake;
+typedef cPlaneSchema<TYPE_PLANE_ID, unsigned char>          cPlane_Type;
+typedef cPlaneSchema<ID_PLANE_ID, unsigned long long>       cPlane_ID;
+typedef cPlaneSchema<RESTART_PLANE_ID>                      cPlane_Restart;
+typedef cPlaneSchema<HANDLINGERROR_PLANE_ID, unsigned char> cPlane_HandlingError;
+typedef cPlaneSchema<RESPONSECURVE_PLANE_ID, unsigned char, unsigned char, unsigned char, unsigned char,
+                     unsigned char, unsigned char, unsigned char, unsigned char,
+                     unsigned char, unsigned char, unsigned char, unsigned char> cPlane_ResponseCurve;
 //=============================================//
 //	Base Class
 //=============================================//
 
+/**
+ * @brief Passengers of a ResponseCurve plane.
+ * See cJoystick::SetResponseCurve.
+ */
+struct cResponseCurveSettings
+{
+    /// @brief 0: Left joystick 1: Right joystick
+    unsigned char joystickID = 0;
+    /// @brief See JOYSTICK_CURVE_LINEAR
+    unsigned char curve = 0;
+    /// @brief 0 (straight line) to 255 (the whole curve).
+    unsigned char strength = 0;
+    /// @brief In RESPONSECURVE_RADIAL_DEADZONE_STEP units.
+    unsigned char radialDeadzone = 0;
+    /// @brief Points of the custom curve.
+    unsigned char points[RESPONSECURVE_POINT_COUNT] = {0};
+};
+
+/**
+ * @brief A request that departed with a
+ * sequence tag and awaits its answer.
+ */
+struct cRequestInFlight
+{
+    unsigned char sequenceTag = 0;
+    /// @brief millis() when it departed.
+    unsigned long departedAt = 0;
+};
+
+
 /**
  * @brief class that is herited by departing
  * classes and serves as a foundation that all
@@ -70,6 +135,32 @@ class cGateFoundation
  {       
     private:
            
+    protected:
+        /// @brief Set by the tower when the plane that departed did not come back in time. Cleared by Update.
+        bool _arrivalTimedOut = false;
+
+        /**
+         * @brief DeadlineCallback of every gate. The
+         * plane that departed did not come back in
+         * time: the gate can send it again and its
+         * next Update reports the failure.
+         * @param gate
+         * The gate, as given to the tower.
+         */
+        static void _ArrivalTimedOut(void* gate);
+
+        /// @brief Asks the tower to wake this gate if its plane is not back in timeLeftForArrival milliseconds.
+        void _WatchArrival();
+
+        /// @brief The plane came back. The tower watches the oldest request still in flight, if any.
+        void _StopWatchingArrival();
+
+        /// @brief Tagged requests awaiting their answer, oldest first.
+        cRequestInFlight _requestsInFlight[MAX_REQUESTS_IN_FLIGHT];
+
+        /// @brief Amount of _requestsInFlight used.
+        int _requestsInFlightCount = 0;
+
     public:
         bool built = false;
         /////////////////////////////////////////
@@ -101,11 +192,25 @@ class cGateFoundation
         unsigned char maxSizeOfPlane = 0;
 
         /**
-         * @brief How long it should take until the plane
-         * comes back to the gate with answer passengers
+         * @brief How long, in milliseconds, the plane
+         * has to come back to the gate with answer
+         * passengers once it departed. The tower
+         * watches it, gates are not polled for it.
          */
-        unsigned int timeLeftForArrival = 1000;
+        unsigned int timeLeftForArrival = TIMEOUT_DURATION_MS;
+
+        /// @brief Set when a request was queued while others were in flight. See _BoardGateRequest.
+        bool _departureQueuedInFlight = false;
+
+        /// @brief Tags of the requests that landed and still await their answer, oldest first. See _BoardGateAnswer.
+        unsigned char _tagsToReply[MAX_REQUESTS_IN_FLIGHT];
+
+        /// @brief Amount of _tagsToReply used.
+        int _tagsToReplyCount = 0;
         /////////////////////////////////////////
+        /// @brief Forgets the gate's deadline so the tower never wakes a gate that is gone.
+        ~cGateFoundation();
+
         /**
          * @brief Get the status of this gate.
          * See GateStatus for possible values this can
@@ -121,9 +226,12 @@ class cGateFoundation
          * @brief Function that verifies the arrival to make
          * sure its the correct plane that docked to the gate.
          * @param arrivedPacket 
+         * @param arrivedView
+         * View opened over the arrived plane. Gates read
+         * their passengers from it without copying.
          * @return Execution 
          */
-        Execution _VerifyArrival(unsigned char planeID, unsigned short* arrivedPlane, int planeSize);
+        Execution _VerifyArrival(unsigned char planeID, unsigned short* arrivedPlane, int planeSize, cPacketView* arrivedView);
 
         /**
          * @brief Function that Queues an error answer
@@ -150,6 +258,50 @@ class cGateFoundation
          * @return Execution 
          */
         Execution _CanPlaneTaxiOnSlave();
+
+        /**
+         * @brief Remembers a request that departed
+         * with a sequence tag, so its answer can
+         * be matched to it.
+         * @param sequenceTag
+         * Tag the request carried.
+         * @return Execution::Passed = Tracked | Execution::Failed = Too many requests in flight
+         */
+        Execution _TrackRequest(unsigned char sequenceTag);
+
+        /**
+         * @brief Matches a tagged answer to the
+         * request in flight carrying that tag, and
+         * forgets that request.
+         * @param sequenceTag
+         * Tag the answer carried.
+         * @return Execution::Passed = Matched | Execution::Failed = No request carries that tag
+         */
+        Execution _MatchAnswer(unsigned char sequenceTag);
+
+        /**
+         * @brief Remembers the tag of a request that
+         * landed, so its answer carries it. Answers
+         * board in the order their requests landed.
+         * @param sequenceTag
+         * Tag the request carried.
+         * @return Execution::Passed = Remembered | Execution::Failed = Too many requests to answer
+         */
+        Execution _QueueReply(unsigned char sequenceTag);
+
+        /**
+         * @brief Takes the tag of the oldest request
+         * still to answer.
+         * @return Its tag. NO_SEQUENCE_TAG if none.
+         */
+        int _NextReply();
+
+        /**
+         * @brief Get the amount of tagged requests
+         * of this gate that await their answer.
+         * @return Amount of requests in flight.
+         */
+        int GetRequestsInFlight();
  };
 
 //=============================================//
@@ -191,6 +343,19 @@ class cGate_Ping: public cGateFoundation
      * @return Execution 
      */
     Execution _GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize);
+    /**
+     * @brief Builds the answer to the request
+     * that docked through _DockMasterPlaneArrival.
+     * This function is called when that answer
+     * leaves the slave terminal's taxiway.
+     * 
+     * @param departingPlane 
+     * Array of chunks where the packet will be placed
+     * @param planeSize 
+     * The size of the packet to send.
+     * @return Execution 
+     */
+    Execution _GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize);
     /**
      * @brief Attempt to dock a plane
      * carrying the answer to the request
@@ -267,6 +432,19 @@ class cGate_Status: public cGateFoundation
      * @return Execution 
      */
     Execution _GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize);
+    /**
+     * @brief Builds the answer to the request
+     * that docked through _DockMasterPlaneArrival.
+     * This function is called when that answer
+     * leaves the slave terminal's taxiway.
+     * 
+     * @param departingPlane 
+     * Array of chunks where the packet will be placed
+     * @param planeSize 
+     * The size of the packet to send.
+     * @return Execution 
+     */
+    Execution _GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize);
     /**
      * @brief Attempt to dock a plane
      * carrying the answer to the request
@@ -344,6 +522,19 @@ class cGate_ID: public cGateFoundation
      * @return Execution 
      */
     Execution _GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize);
+    /**
+     * @brief Builds the answer to the request
+     * that docked through _DockMasterPlaneArrival.
+     * This function is called when that answer
+     * leaves the slave terminal's taxiway.
+     * 
+     * @param departingPlane 
+     * Array of chunks where the packet will be placed
+     * @param planeSize 
+     * The size of the packet to send.
+     * @return Execution 
+     */
+    Execution _GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize);
     /**
      * @brief Attempt to dock a plane
      * carrying the answer to the request
@@ -425,16 +616,38 @@ class cGate_UniversalInfo: public cGateFoundation
         /// @brief The status to send in requests
         std::string _gitRepository = "";//BFIO_GIT_REPOSITORY;
         /// @brief The status received from any terminals
-        std::string _receivedGitRepository = 0;
+        std::string _receivedGitRepository = "";
         /// @brief The status to reply to the other airport's master terminal.
         std::string _repositoryToSend = "";//BFIO_GIT_REPOSITORY;
 
         /// @brief The status to send in requests
         std::string _nameOfDevice = "";//EVICE_NAME;
         /// @brief The status received from any terminals
-        std::string _receivedDeviceName = 0;
+        std::string _receivedDeviceName = "";
         /// @brief The status to reply to the other airport's master terminal.
         std::string _deviceNameToSend = "";//DEVICE_NAME;
+
+        /// @brief The hardware revision received from any terminals
+        std::string _receivedRevision = "";
+
+        /// @brief Passengers of the plane that is landing. Only become the received values once its check is verified.
+        unsigned long long _stagedID = 0;
+        unsigned long long _stagedBFIO = 0;
+        unsigned char _stagedType = 0;
+        unsigned char _stagedStatus = 0;
+        std::string _stagedGitRepository = "";
+        std::string _stagedDeviceName = "";
+        std::string _stagedRevision = "";
+        /// @brief Amount of segments staged from the plane that is landing.
+        int _stagedSegments = 0;
+
+        /// @brief SegmentArrivalCallback of this gate. Decodes one segment into the staged values.
+        static Execution _StageSegment(void* gate, unsigned char planeID, int segmentNumber, cSegmentView* segment);
+        /// @brief PlaneLandingCallback of this gate. Commits or throws away the staged values.
+        static void _LandStagedPlane(void* gate, unsigned char planeID, bool landed);
+
+        /// @brief Builds the plane requests and answers both carry.
+        Execution _SeatPassengers(unsigned short* departingPlane, int* planeSize);
   public:
     bool built = false;
     /// @brief Constructor
@@ -455,6 +668,19 @@ class cGate_UniversalInfo: public cGateFoundation
      * @return Execution 
      */
     Execution _GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize);
+    /**
+     * @brief Builds the answer to the request
+     * that docked through _DockMasterPlaneArrival.
+     * This function is called when that answer
+     * leaves the slave terminal's taxiway.
+     * 
+     * @param departingPlane 
+     * Array of chunks where the packet will be placed
+     * @param planeSize 
+     * The size of the packet to send.
+     * @return Execution 
+     */
+    Execution _GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize);
     /**
      * @brief Attempt to dock a plane
      * carrying the answer to the request
@@ -497,8 +723,276 @@ class cGate_UniversalInfo: public cGateFoundation
      * @return Execution::Passed = Reading worked | Execution::Bypassed = Nothing to read.
      */
     Execution Read();
+
+    /**
+     * @brief Makes this gate unload the passengers
+     * of UniversalInfo planes landing on that
+     * terminal while they are still landing. The
+     * received values are set, and the gate becomes
+     * GateStatus::AvailableArrival, in the same call
+     * that lands the plane's Check chunk.
+     * @param terminal
+     * The terminal planes land on.
+     * @return Execution 
+     */
+    Execution DockCutThrough(cTerminal* terminal);
+
+    /**
+     * @brief Get the values the last UniversalInfo
+     * plane carried.
+     * @return Execution::Passed = Values placed | Execution::Bypassed = Nothing to read.
+     */
+    Execution ReadInfo(unsigned long long* deviceID, unsigned char* deviceType, std::string* deviceName, std::string* revision);
 };
 
 #pragma endregion
+
+#pragma region SPECIFIC
+/**
+ * @brief Class used to set the response curve
+ * and radial deadzone of a joystick. Requests
+ * landing on this device are applied to its
+ * joysticks, and answered with what was applied.
+ * Call the Request method to set those of the
+ * other device.
+ */
+class cGate_ResponseCurve: public cGateFoundation
+{
+  private:
+        /// @brief The settings to send in requests
+        cResponseCurveSettings _settings;
+        /// @brief The settings received from any terminals
+        cResponseCurveSettings _receivedSettings;
+        /// @brief The settings to reply to the other airport's master terminal.
+        cResponseCurveSettings _settingsToReply;
+  public:
+    bool built = false;
+    /// @brief Constructor
+    cGate_ResponseCurve();
+    /// @brief Time base handler of the object.
+    /// @return 
+    Execution Update();
+    /**
+     * @brief This method places the departing of a plane
+     * into a departing buffer to be sent on the runway.
+     * This function is called when the plane is taking off
+     * and finished taxiing.
+     * 
+     * @param departingPlane 
+     * Array of chunks where the packet will be placed
+     * @param planeSize 
+     * The size of the packet to send.
+     * @return Execution 
+     */
+    Execution _GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize);
+    /**
+     * @brief Builds the answer to the request
+     * that docked through _DockMasterPlaneArrival.
+     * This function is called when that answer
+     * leaves the slave terminal's taxiway.
+     * 
+     * @param departingPlane 
+     * Array of chunks where the packet will be placed
+     * @param planeSize 
+     * The size of the packet to send.
+     * @return Execution 
+     */
+    Execution _GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize);
+    /**
+     * @brief Attempt to dock a plane
+     * carrying the answer to the request
+     * sent through the Request function.
+     * 
+     * @param planeID
+     * The ID of the plane attempting to dock
+     * @param planeToDock
+     * Array of chunks.
+     * @param planeSize 
+     * Size of the plane (how big is the array of chunks)
+     * @return Execution 
+     */
+    Execution _DockSlavePlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize);
+
+    /**
+     * @brief Attempt to dock a function
+     * request to this gate. The settings it
+     * carries are applied to the joystick
+     * before it leaves the gate.
+     * 
+     * @param planeID
+     * The ID of the plane attempting to dock
+     * @param planeToDock
+     * Array of chunks.
+     * @param planeSize 
+     * Size of the plane (how big is the array of chunks)
+     * @return Execution 
+     */
+    Execution _DockMasterPlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize);
+
+    /**
+     * @brief The method called to send settings
+     * to the other device and await the ones it
+     * applied.
+     * @return Execution::Passed = settings are sending
+     */
+    Execution Request(const cResponseCurveSettings* settings);
+    /**
+     * @brief This reads if any passengers just
+     * finished unloading from the plane.
+     * @return Execution::Passed = Reading worked | Execution::Bypassed = Nothing to read.
+     */
+    Execution Read(cResponseCurveSettings* resultedSettings);
+};
+
+/**
+ * @brief Applies response curve settings to
+ * one of the joysticks, then gets back what
+ * it ended up using.
+ * @param settings
+ * What to apply.
+ * @param appliedSettings
+ * Where what the joystick uses is placed.
+ * @return Execution::Passed = Applied | Execution::Failed = No such joystick, curve or radial deadzone
+ */
+Execution ApplyResponseCurveSettings(const cResponseCurveSettings* settings, cResponseCurveSettings* appliedSettings);
+#pragma endregion
+#pragma endregion
+
+//=============================================//
+//	Docking
+//=============================================//
+#pragma region -Docking-
+/// @brief PlaneDockingCallback of planes answering a Request of that gate. Tagged answers must match a request in flight.
+template<class Gate>
+Execution _DockGateAnswer(void* gate, unsigned char planeID, unsigned short* plane, int planeSize, int sequenceTag)
+{
+    Gate* self = (Gate*)gate;
+
+    if(sequenceTag != NO_SEQUENCE_TAG && self->_MatchAnswer((unsigned char)sequenceTag) != Execution::Passed)
+    {
+        return Execution::Failed;
+    }
+    return self->_DockSlavePlaneArrival(planeID, plane, planeSize);
+}
+
+/// @brief PlaneDockingCallback of planes requesting that gate's function. Remembers the tag its answer echoes.
+template<class Gate>
+Execution _DockGateRequest(void* gate, unsigned char planeID, unsigned short* plane, int planeSize, int sequenceTag)
+{
+    Execution execution;
+    Gate* self = (Gate*)gate;
+
+    // Remembered first: its answer can start taxiing while it docks.
+    if(sequenceTag != NO_SEQUENCE_TAG && self->_QueueReply((unsigned char)sequenceTag) != Execution::Passed)
+    {
+        return Execution::Failed;
+    }
+
+    execution = self->_DockMasterPlaneArrival(planeID, plane, planeSize);
+    if(sequenceTag == NO_SEQUENCE_TAG || execution == Execution::Passed)
+    {
+        return execution;
+    }
+
+    // Unecessary: the answer of an earlier request still taxis. Its own boards right after.
+    if(execution == Execution::Unecessary)
+    {
+        return Execution::Passed;
+    }
+
+    // No answer taxis for it.
+    self->_tagsToReplyCount--;
+    return execution;
+}
+
+/**
+ * @brief PlaneBoardingCallback of the answers
+ * that gate sends to requests it got. They
+ * carry their request's tag. Requests that
+ * landed while the answer taxied get theirs
+ * on the taxiway right after.
+ */
+template<class Gate>
+Execution _BoardGateAnswer(void* gate, unsigned short* departingPlane, int* planeSize, int* sequenceTag)
+{
+    Execution execution;
+    Gate* self = (Gate*)gate;
+    int tagToReply = self->_NextReply();
+
+    if(*sequenceTag != NO_SEQUENCE_TAG)
+    {
+        *sequenceTag = tagToReply;
+    }
+    execution = self->_GetDepartingSlavePlane(departingPlane, planeSize);
+    if(self->_tagsToReplyCount > 0)
+    {
+        self->_CanPlaneTaxiOnSlave();
+    }
+    return execution;
+}
+
+/**
+ * @brief PlaneBoardingCallback of the requests
+ * that gate sends. Tagged requests are tracked
+ * until their answer docks.
+ * An answer can dock while a pipelined request
+ * still taxis. The gate then boards it anyway
+ * and keeps that answer available.
+ */
+template<class Gate>
+Execution _BoardGateRequest(void* gate, unsigned short* departingPlane, int* planeSize, int* sequenceTag)
+{
+    Execution execution;
+    Gate* self = (Gate*)gate;
+    GateStatus statusBeforeBoarding = self->status;
+
+    if(self->_departureQueuedInFlight && statusBeforeBoarding == GateStatus::AvailableArrival)
+    {
+        self->status = GateStatus::JustLeft;
+    }
+    self->_departureQueuedInFlight = false;
+
+    execution = self->_GetDepartingMasterPlane(departingPlane, planeSize);
+    if(execution == Execution::Passed && *sequenceTag != NO_SEQUENCE_TAG)
+    {
+        execution = self->_TrackRequest((unsigned char)*sequenceTag);
+    }
+
+    if(statusBeforeBoarding == GateStatus::AvailableArrival)
+    {
+        self->status = GateStatus::AvailableArrival;
+    }
+    return execution;
+}
+
+/**
+ * @brief Docks a gate at both terminals, under
+ * its gateID. Answers landing on the master
+ * terminal go to _DockSlavePlaneArrival and
+ * its requests board through
+ * _GetDepartingMasterPlane. Requests landing
+ * on the slave terminal go to
+ * _DockMasterPlaneArrival and their answers
+ * board through _GetDepartingSlavePlane.
+ * @param masterTerminal
+ * Terminal that sends requests and gets their answers.
+ * @param slaveTerminal
+ * Terminal that gets requests.
+ * @param gate
+ * The gate. Must outlive both terminals.
+ * @return Execution::Passed = Gate docked | Execution::Incompatibility = The gate's ID is not supported
+ */
+template<class Gate>
+Execution DockGate(cTerminal* masterTerminal, cTerminal* slaveTerminal, Gate* gate)
+{
+    Execution execution;
+
+    execution = masterTerminal->SetDockingGate(gate->gateID, gate, _DockGateAnswer<Gate>, _BoardGateRequest<Gate>);
+    if(execution != Execution::Passed)
+    {
+        return execution;
+    }
+    return slaveTerminal->SetDockingGate(gate->gateID, gate, _DockGateRequest<Gate>, _BoardGateAnswer<Gate>);
+}
 #pragma endregion
 #endif
\ No newline at end of file
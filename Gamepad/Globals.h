@@ -29,6 +29,7 @@
 
 #include <iostream>
 #include <cstring>
+#include <atomic>
 #include <Adafruit_NeoPixel.h>
 #include <Arduino.h>
 
@@ -40,9 +41,14 @@
 #include "Chunk.h"
 #include "Data.h"
 #include "Packet.h"
+#include "PlaneSchema.h"
 #include "Terminal.h"
 #include "Gates.h"
 #include "Runway.h"
+#include "Tower.h"
+#include "Scheduler.h"
+#include "Sampler.h"
+#include "AdcScan.h"
 
 #include "Switch.h"
 #include "Joystick.h"
@@ -58,6 +64,11 @@
 #include "_UNIT_TEST_Chunk.h"
 #include "_UNIT_TEST_Joystick.h"
 #include "_UNIT_TEST_Packet.h"
+#include "_UNIT_TEST_Terminal.h"
+#include "_UNIT_TEST_Tower.h"
+#include "_UNIT_TEST_Scheduler.h"
+#include "_UNIT_TEST_Sampler.h"
+#include "_UNIT_TEST_AdcScan.h"
 #include "_UNIT_TEST.h"
 
 ///@brief RGB LED uses GPIO 48
@@ -101,7 +112,30 @@ Adafruit_NeoPixel WS2812(RGB_COUNT, RGB_PIN, NEO_GRB + NEO_KHZ800);
  */
 RGB Rgb;
 #pragma endregion
+#pragma region --- Analog Scan ---
+///@brief Pins the ADC scanner converts, in channel order.
+const unsigned char ADC_SCAN_PINS[ADC_SCAN_CHANNELS] = {LEFT_JOYSTICK_X_PIN, LEFT_JOYSTICK_Y_PIN, RIGHT_JOYSTICK_X_PIN, RIGHT_JOYSTICK_Y_PIN};
+/**
+ * @brief Converts the joysticks' axes
+ * continuously, in the background, and
+ * hands their latest scan to the joysticks.
+ * Started by ScheduleApplication.
+ */
+cAdcScanner AdcScanner(ADC_SCAN_PINS, ADC_SCAN_CHANNELS);
+#pragma endregion
 #pragma region --- Controls ---
+/**
+ * @brief Response tables of the left
+ * joystick, and the settings they are
+ * built from. Only LeftJoystick uses them.
+ */
+cJoystickShaping LeftJoystickShaping;
+/**
+ * @brief Response tables of the right
+ * joystick, and the settings they are
+ * built from. Only RightJoystick uses them.
+ */
+cJoystickShaping RightJoystickShaping;
 /**
  * @brief Class allowing easy readings
  * and interfacing of Gamepad's
@@ -194,6 +228,31 @@ cDepartureRunway MasterDepartureRunway;
  */
 cDepartureRunway SlaveDepartureRunway;
 #pragma endregion
+#pragma region --- Tower ---
+/**
+ * @brief Watches the deadlines of every
+ * plane that departed and wakes their
+ * gates if they do not come back in time.
+ */
+cTower Tower;
+#pragma endregion
+#pragma region --- Scheduler ---
+/**
+ * @brief Runs the interfaces and handlers
+ * of the application at their own rate.
+ * See ScheduleApplication.
+ */
+cScheduler Scheduler;
+#pragma endregion
+#pragma region --- Sampler ---
+/**
+ * @brief Hands the latest snapshot of the
+ * inputs to whoever needs them, lock-free,
+ * from whichever core sampled them.
+ * See SampleInputs.
+ */
+cInputSampler Sampler;
+#pragma endregion
 #pragma region --- Gates ---
 /**
  * @brief This object handles the 
@@ -205,6 +264,13 @@ cDepartureRunway SlaveDepartureRunway;
  * handle the ping functions both ways.
  */
 cGate_Ping Gate_Ping;
+/**
+ * @brief This object handles the
+ * response curve gate. Requests that
+ * land on it set the response curve and
+ * radial deadzone of a joystick.
+ */
+cGate_ResponseCurve Gate_ResponseCurve;
 #pragma endregion
 
 #pragma region Functions
@@ -224,10 +290,18 @@ Execution InitializeProject()
     Chunk = cChunk();
     Data = cData();
     Packet = cPacket();
-    SlaveTerminal = cTerminal();
-    MasterTerminal = cTerminal();
+    // In place: a terminal is too big to be built as a temporary on the loop task's stack.
+    SlaveTerminal.Reset();
+    SlaveTerminal.UndockGates();
+    Tower = cTower();
+    Scheduler = cScheduler();
+    MasterTerminal.Reset();
+    MasterTerminal.UndockGates();
     
     Gate_Ping = cGate_Ping();
+    DockGate(&MasterTerminal, &SlaveTerminal, &Gate_Ping);
+    Gate_ResponseCurve = cGate_ResponseCurve();
+    DockGate(&MasterTerminal, &SlaveTerminal, &Gate_ResponseCurve);
 
     MasterDepartureRunway = cDepartureRunway();
     SlaveDepartureRunway = cDepartureRunway();
@@ -238,8 +312,8 @@ Execution InitializeProject()
     Button4 = cSwitch(BUTTON_4_PIN);
     Button5 = cSwitch(BUTTON_5_PIN);
 
-    LeftJoystick = cJoystick(LEFT_JOYSTICK_X_PIN, LEFT_JOYSTICK_Y_PIN, LEFT_JOYSTICK_SWITCH_PIN);
-    RightJoystick = cJoystick(RIGHT_JOYSTICK_X_PIN, RIGHT_JOYSTICK_Y_PIN, RIGHT_JOYSTICK_SWITCH_PIN);
+    LeftJoystick = cJoystick(LEFT_JOYSTICK_X_PIN, LEFT_JOYSTICK_Y_PIN, LEFT_JOYSTICK_SWITCH_PIN, &LeftJoystickShaping);
+    RightJoystick = cJoystick(RIGHT_JOYSTICK_X_PIN, RIGHT_JOYSTICK_Y_PIN, RIGHT_JOYSTICK_SWITCH_PIN, &RightJoystickShaping);
 
     return Execution::Passed;
 }
@@ -311,12 +385,43 @@ Execution TestInitialization()
       return Execution::Failed;
     }
 
+    if(!Tower.built)
+    {
+      Serial.println("Project test: -> Tower OBJECT FAIL");
+      return Execution::Failed;
+    }
+
+    if(!Scheduler.built)
+    {
+      Serial.println("Project test: -> Scheduler OBJECT FAIL");
+      return Execution::Failed;
+    }
+
+
+    if(!AdcScanner.built)
+    {
+      Serial.println("Project test: -> AdcScanner OBJECT FAIL");
+      return Execution::Failed;
+    }
+
+    if(!Sampler.built)
+    {
+      Serial.println("Project test: -> Sampler OBJECT FAIL");
+      return Execution::Failed;
+    }
+
     if(!Gate_Ping.built)
     {
       Serial.println("Project test: -> Gate_Ping OBJECT FAIL");
       return Execution::Failed;
     }
 
+    if(!Gate_ResponseCurve.built)
+    {
+      Serial.println("Project test: -> Gate_ResponseCurve OBJECT FAIL");
+      return Execution::Failed;
+    }
+
     if(!Button1.built)
     {
       Serial.println("Project test: -> Button1 OBJECT FAIL");
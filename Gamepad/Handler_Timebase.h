@@ -28,12 +28,49 @@
 //=============================================//
 #include "Globals.h"
 
+/// @brief Joysticks and switches are sampled at 1 kHz. On the ESP32, by their own task instead. See SampleInputs.
+#define INPUTS_PERIOD_US 1000
+#define INPUTS_BUDGET_US 300
+/// @brief The protocol runs on every received byte and gate deadline.
+#define PROTOCOL_BUDGET_US 500
+/// @brief The RGB LED is refreshed at 60 Hz.
+#define RGB_PERIOD_US 16667
+#define RGB_BUDGET_US 500
+/// @brief How often, in microseconds, the UART is polled while idling. About a byte at 115200 baud.
+#define IDLE_POLL_US 100
+
+/**
+ * @brief ID of each task ScheduleApplication
+ * gives to the Scheduler. Earlier tasks run
+ * first when several are due.
+ */
+enum ApplicationTask
+{
+#if !defined(ARDUINO_ARCH_ESP32)
+    InputsTask,
+#endif
+    ProtocolTask,
+    RGBTask
+};
+
+/**
+ * @brief Gives every interface and handler
+ * of the application to the Scheduler, with
+ * its period and time budget. Call it once,
+ * after InitializeProject.
+ * On the ESP32, the inputs are sampled on
+ * the other core by InputSamplingTask.
+ * @return Execution::Passed = Every task added | Execution::Failed = The scheduler refused one or the sampling task could not start
+ */
+Execution ScheduleApplication();
+
 /**
  * @brief This function is the core callback
- * function of your application. It is executed
- * each X amount of clock cycles and executes all
- * the interfaces or handlers within your
- * program.
+ * function of your application. Call it from
+ * the loop. It runs the interfaces or handlers
+ * that are due, then idles until the next one is,
+ * until a gate's plane is late or until a byte
+ * arrives, whichever comes first.
  */
 void ApplicationCallback();
 
@@ -31,6 +31,8 @@
  */
 void InterfaceJoysticks()
 {
+    // Once for both joysticks, so all 4 axes come from the same scan.
+    AdcScanner.Swap();
     LeftJoystick.Update();
     RightJoystick.Update();
 }
\ No newline at end of file
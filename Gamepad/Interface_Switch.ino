@@ -31,5 +31,9 @@
  */
 void InterfaceSwitch()
 {
-    // TO DO
+    Button1.Update();
+    Button2.Update();
+    Button3.Update();
+    Button4.Update();
+    Button5.Update();
 }
\ No newline at end of file
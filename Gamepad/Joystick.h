@@ -33,6 +33,31 @@
 #define _JOY_MAX_VAL 2048
 #define _JOY_MIN_VAL -2048
 #define _JOY_MID_VAL 0
+/// @brief Resolution of the joysticks' ADC.
+#define _JOY_ADC_BITS 12
+/// @brief Fractional bits of the axis coefficients. Q15: 1 << _JOY_Q is 1.0
+#define _JOY_Q 15
+
+/**
+ * @brief Deadzone and trim of one axis, as
+ * fixed point coefficients computed once by
+ * CalculateJoystickAxisCoefficients. Applying
+ * them only takes integer multiplies and adds.
+ * Defaults to no deadzone and no trim.
+ */
+struct cJoystickAxisCoefficients
+{
+    /// @brief Axis values from -deadzone to deadzone become _JOY_MID_VAL.
+    int deadzone = 0;
+    /// @brief Q15 of (_JOY_MAX_VAL - deadzone) / _JOY_MAX_VAL
+    int deadzoneScale = 1 << _JOY_Q;
+    /// @brief Q15 of deadzone. Pulls the scaled axis back towards the middle.
+    int deadzoneOffset = 0;
+    /// @brief Q15 of (_JOY_MAX_VAL - |trim|) / _JOY_MAX_VAL
+    int trimScale = 1 << _JOY_Q;
+    /// @brief Q15 of trim.
+    int trimOffset = 0;
+};
 
 /**
  * @brief Function that executes mathematics to
@@ -69,11 +94,631 @@ Execution CalculateJoystickAxisDeadzone(int* axisToModify, int Deadzone);
  */
 Execution CalculateJoystickAxisTrim(int* axisToModify, int Trim);
 
+/**
+ * @brief Computes the fixed point coefficients
+ * of an axis's deadzone and trim. Call it when
+ * they change, not on each sample.
+ * Deadzones and trims past _JOY_MAX_VAL are
+ * treated as _JOY_MAX_VAL.
+ * @param Deadzone
+ * Deadzone of the axis. Must be positive.
+ * @param Trim
+ * Trim of the axis.
+ * @param coefficients
+ * Where the coefficients are placed.
+ * @return Execution::Passed = Placed | Execution::Failed = Negative deadzone
+ */
+Execution CalculateJoystickAxisCoefficients(int Deadzone, int Trim, cJoystickAxisCoefficients* coefficients);
+
+/**
+ * @brief Applies the deadzone then the trim of
+ * an axis, in integers only. Gives exactly what
+ * CalculateJoystickAxisDeadzone followed by
+ * CalculateJoystickAxisTrim gives.
+ * @param axisToModify
+ * Pointer to the axis that will be modified.
+ * Must be within _JOY_MIN_VAL and _JOY_MAX_VAL.
+ * @param coefficients
+ * Computed by CalculateJoystickAxisCoefficients.
+ * @return Execution
+ */
+Execution ApplyJoystickAxisCoefficients(int* axisToModify, const cJoystickAxisCoefficients* coefficients);
+
+//=============================================//
+//	Response
+//=============================================//
+/// @brief Entries of a response table. One per value the ADC gives.
+#define JOYSTICK_RESPONSE_TABLE_SIZE (1 << _JOY_ADC_BITS)
+
+/// @brief The axis follows the stick.
+#define JOYSTICK_CURVE_LINEAR 0
+/// @brief Finer near the middle, faster near the ends. Cubic.
+#define JOYSTICK_CURVE_EXPO 1
+/// @brief Finer near the middle and near the ends. Smoothstep.
+#define JOYSTICK_CURVE_S 2
+/// @brief Goes through cJoystickResponse::points.
+#define JOYSTICK_CURVE_CUSTOM 3
+/// @brief Amount of curves. See cJoystick::SetResponseCurve
+#define JOYSTICK_CURVE_COUNT 4
+
+/// @brief Strength at which a curve is followed entirely. 0 is a straight line.
+#define JOYSTICK_CURVE_MAX_STRENGTH 255
+/// @brief Points of JOYSTICK_CURVE_CUSTOM, evenly spread from the middle to the end of the travel.
+#define JOYSTICK_CURVE_POINTS 8
+/// @brief Largest radial deadzone. Keeps its rescaling within 32 bits integers.
+#define JOYSTICK_MAX_RADIAL_DEADZONE (_JOY_MAX_VAL / 2)
+
+/**
+ * @brief Response curve of both axes of a
+ * joystick. Defaults to a straight line.
+ */
+struct cJoystickResponse
+{
+    /// @brief See JOYSTICK_CURVE_LINEAR
+    unsigned char curve = JOYSTICK_CURVE_LINEAR;
+    /// @brief 0 to JOYSTICK_CURVE_MAX_STRENGTH. Blends the curve with a straight line.
+    unsigned char strength = JOYSTICK_CURVE_MAX_STRENGTH;
+    /// @brief Output of JOYSTICK_CURVE_CUSTOM, 0 to 255, at 1/8 to 8/8 of the travel. The middle stays 0.
+    unsigned char points[JOYSTICK_CURVE_POINTS] = {32, 64, 96, 128, 159, 191, 223, 255};
+};
+
+/**
+ * @brief Radial deadzone of a joystick, as
+ * computed once by CalculateJoystickRadialDeadzone.
+ * Defaults to none.
+ */
+struct cJoystickRadialDeadzone
+{
+    /// @brief Sticks closer than that to the middle are centered.
+    int deadzone = 0;
+    /// @brief Q15 of _JOY_MAX_VAL / (_JOY_MAX_VAL - deadzone)
+    int scale = 1 << _JOY_Q;
+};
+
+/**
+ * @brief Puts an axis through a response
+ * curve. Both signs are shaped the same way.
+ * @param axis
+ * From _JOY_MIN_VAL to _JOY_MAX_VAL.
+ * @param response
+ * The curve. Must be valid.
+ * @return The shaped axis, within the same range.
+ */
+int CalculateJoystickResponse(int axis, const cJoystickResponse* response);
+
+/**
+ * @brief Fills the response table of an axis:
+ * the axis value each ADC value becomes once
+ * its deadzone, the response curve, then its
+ * trim are applied. Call it when one of them
+ * changes. Sampling the axis is then a single
+ * lookup.
+ * With a straight line, gives exactly what
+ * ApplyJoystickAxisCoefficients gives.
+ * @param Deadzone
+ * Deadzone of the axis. Must be positive.
+ * @param Trim
+ * Trim of the axis.
+ * @param response
+ * The response curve.
+ * @param table
+ * JOYSTICK_RESPONSE_TABLE_SIZE entries. Entry 0 is _JOY_MIN_VAL.
+ * @return Execution::Passed = Filled | Execution::Failed = Negative deadzone or no such curve
+ */
+Execution BuildJoystickResponseTable(int Deadzone, int Trim, const cJoystickResponse* response, short* table);
+
+/**
+ * @brief Computes the radial deadzone's
+ * rescaling. Call it when it changes.
+ * @param Deadzone
+ * 0 to JOYSTICK_MAX_RADIAL_DEADZONE.
+ * @param radial
+ * Where it is placed.
+ * @return Execution::Passed = Placed | Execution::Failed = Out of range
+ */
+Execution CalculateJoystickRadialDeadzone(int Deadzone, cJoystickRadialDeadzone* radial);
+
+/**
+ * @brief Length of the (x, y) vector, without
+ * a square root. max(a, (7a + 4b) / 8) of the
+ * largest and smallest of |x| and |y|. At most
+ * 0.8% longer than the real length (a = 8 and
+ * b = 4 give 9 for 8.94), and at most 4%
+ * shorter past 64 LSB.
+ */
+static inline int ApproximateJoystickMagnitude(int x, int y)
+{
+    int a = x < 0 ? -x : x;
+    int b = y < 0 ? -y : y;
+    if(a < b)
+    {
+        int largest = b;
+        b = a;
+        a = largest;
+    }
+    int blended = (7 * a + 4 * b) >> 3;
+    return blended > a ? blended : a;
+}
+
+//=============================================//
+//	Settings
+//=============================================//
+/**
+ * @brief Everything a joystick shapes its axes
+ * with. Handed as a whole from the task setting
+ * them to the one sampling the joystick.
+ */
+struct cJoystickSettings
+{
+    int xDeadzone = 0;
+    int yDeadzone = 0;
+    int xTrim = 0;
+    int yTrim = 0;
+    /// @brief 0 to JOYSTICK_MAX_RADIAL_DEADZONE.
+    int radialDeadzone = 0;
+    cJoystickResponse response;
+};
+
+/// @brief Amount of words settings are handed in.
+#define JOYSTICK_SETTINGS_WORDS (sizeof(cJoystickSettings) / sizeof(unsigned int))
+static_assert(sizeof(cJoystickSettings) % sizeof(unsigned int) == 0, "cJoystickSettings must be made of whole words");
+
+/**
+ * @brief Response tables of one joystick, and
+ * the settings they are built from. Only the
+ * task sampling the joystick builds and reads
+ * the tables. Other tasks hand it settings
+ * through a seqlock, so a sample never sees a
+ * table or a deadzone half rebuilt.
+ * Declared once per joystick and given to it,
+ * so copying the joystick never copies them.
+ * @attention
+ * Only one task may Publish.
+ */
+class cJoystickShaping
+ {
+    private:
+        /// @brief Odd while settings are being published. Incremented twice per Publish.
+        std::atomic<unsigned int> _sequence;
+
+        /// @brief The settings, word by word, so no access is ever a data race.
+        std::atomic<unsigned int> _words[JOYSTICK_SETTINGS_WORDS];
+
+    public:
+        /// @brief Read by cResponseTableStage for the X axis.
+        short xTable[JOYSTICK_RESPONSE_TABLE_SIZE];
+        /// @brief Read by cResponseTableStage for the Y axis.
+        short yTable[JOYSTICK_RESPONSE_TABLE_SIZE];
+
+        //////////////////////////////////////////////
+        cJoystickShaping();
+        //////////////////////////////////////////////
+
+        /**
+         * @brief Hands settings to the task sampling
+         * the joystick. Never waits.
+         * @param settings
+         * Settings to use from its next sample on.
+         * @return Execution::Passed = Published
+         */
+        Execution Publish(const cJoystickSettings* settings);
+
+        /**
+         * @brief Gets the settings last published,
+         * if they are not the ones already taken.
+         * Never returns settings that were half
+         * published.
+         * @param resultedSettings
+         * Where the settings are placed.
+         * @param version
+         * Version of the settings already taken, 0 at first. Updated.
+         * @return Execution::Passed = Newer settings placed | Execution::Unecessary = Nothing new | Execution::Bypassed = Raced a Publish, take them on the next sample
+         */
+        Execution Take(cJoystickSettings* resultedSettings, unsigned int* version);
+ };
+
+//=============================================//
+//	Pipeline
+//=============================================//
+/// @brief Default mode. Axes are oversampled and filtered, go through the radial deadzone, then through their response table.
+#define JOYSTICK_MODE_CALIBRATED 0
+/// @brief Always returns 0 / released. Nothing is read.
+#define JOYSTICK_MODE_BYPASSED 1
+/// @brief Axes are read without deadzones, trim nor response curve.
+#define JOYSTICK_MODE_RAW 2
+/// @brief Amount of modes. See cJoystick::SetMode
+#define JOYSTICK_MODE_COUNT 3
+
+/// @brief ADC reads averaged into each axis value. The ADC scanner does them, see ADC_SCAN_CONVERSIONS_PER_PIN.
+#define JOYSTICK_OVERSAMPLING ADC_SCAN_CONVERSIONS_PER_PIN
+/// @brief Longest cMovingAverageStage.
+#define JOYSTICK_MOVING_AVERAGE_MAX_LENGTH 8
+/// @brief Fractional bits cAdaptiveFilterStage keeps between samples, so small moves are not lost.
+#define _JOY_FILTER_FRACTION_BITS 8
+/// @brief Q15 smoothing of the calibrated mode's filter when the axis is still. Lower is smoother.
+#define JOYSTICK_FILTER_MIN_ALPHA 1024
+/// @brief Q15 added to it per LSB per sample the axis moves. Higher follows fast moves sooner.
+#define JOYSTICK_FILTER_BETA 1024
+
+/**
+ * @brief What the filter stages remember of
+ * an axis between samples. Each filter has its
+ * own members, so a pipeline may use each
+ * filter once. Cleared when the mode changes.
+ */
+struct cJoystickAxisFilter
+{
+    /// @brief false until cMovingAverageStage saw a sample.
+    bool averagePrimed = false;
+    int averageHistory[JOYSTICK_MOVING_AVERAGE_MAX_LENGTH] = {};
+    int averageIndex = 0;
+    int averageSum = 0;
+
+    /// @brief false until cMedianOf3Stage saw a sample.
+    bool medianPrimed = false;
+    /// @brief The 2 samples before the current one. Newest first.
+    int medianHistory[2] = {};
+
+    /// @brief false until cAdaptiveFilterStage saw a sample.
+    bool adaptivePrimed = false;
+    /// @brief Filtered axis, with _JOY_FILTER_FRACTION_BITS fractional bits.
+    int adaptiveFiltered = 0;
+    /// @brief Last sample, with _JOY_FILTER_FRACTION_BITS fractional bits.
+    int adaptivePrevious = 0;
+    /// @brief Smoothed LSB per sample the axis moves, signed, with _JOY_FILTER_FRACTION_BITS fractional bits.
+    int adaptiveVelocity = 0;
+};
+
+/**
+ * @brief What the stages of a pipeline know
+ * about the axis going through it.
+ */
+struct cJoystickAxis
+{
+    /// @brief Analog pin the axis is read from.
+    int pin = -1;
+    /// @brief Channel of the pin in the ADC scanner's scans. -1 if it is not scanned.
+    int channel = -1;
+    /// @brief Scan cScanReadStage reads the axis from. Set by cJoystick::Update.
+    const cAdcScan* scan = nullptr;
+    /// @brief Read by cResponseTableStage. In the joystick's cJoystickShaping.
+    const short* responseTable = nullptr;
+    /// @brief Deadzone and trim of the axis. See CalculateJoystickAxisCoefficients.
+    cJoystickAxisCoefficients coefficients;
+    /// @brief What the filter stages remember.
+    cJoystickAxisFilter filter;
+};
+
+/**
+ * @brief Stage reading the axis from its ADC,
+ * centered on _JOY_MID_VAL. What came before
+ * it in the pipeline is ignored.
+ */
+struct cReadAxisStage
+{
+    static inline int Process(int, cJoystickAxis* input)
+    {
+        return analogRead(input->pin) - _JOY_MAX_VAL;
+    }
+};
+
+/**
+ * @brief Stage taking the axis from the ADC
+ * scanner's front scan, centered on
+ * _JOY_MID_VAL. The ADC already averaged
+ * ADC_SCAN_CONVERSIONS_PER_PIN conversions into
+ * it, in the background, so nothing waits on
+ * the ADC. What came before it in the pipeline
+ * is ignored.
+ */
+struct cScanReadStage
+{
+    static inline int Process(int, cJoystickAxis* input)
+    {
+        return input->scan->values[input->channel] - _JOY_MAX_VAL;
+    }
+};
+
+/**
+ * @brief Stage reading the axis Samples times
+ * in a row and keeping their rounded average.
+ * Averaging N reads divides white ADC noise by
+ * about the square root of N. All the reads are
+ * done in the same Update: no latency is added,
+ * each Update just takes longer.
+ * @tparam Samples
+ * ADC reads per axis value, from 1 to 64.
+ */
+template<int Samples>
+struct cOversampleReadStage
+{
+    static_assert(Samples > 0 && Samples <= 64, "cOversampleReadStage takes 1 to 64 samples");
+
+    static inline int Process(int, cJoystickAxis* input)
+    {
+        int sum = 0;
+        for(int sample = 0; sample < Samples; sample++)
+        {
+            sum += analogRead(input->pin);
+        }
+        return (sum + Samples / 2) / Samples - _JOY_MAX_VAL;
+    }
+};
+
+/// @brief Stage holding the axis in the middle.
+struct cCenterAxisStage
+{
+    static inline int Process(int, cJoystickAxis*)
+    {
+        return _JOY_MID_VAL;
+    }
+};
+
+/// @brief Stage applying the axis's deadzone then its trim.
+struct cCalibrateAxisStage
+{
+    static inline int Process(int axis, cJoystickAxis* input)
+    {
+        ApplyJoystickAxisCoefficients(&axis, &input->coefficients);
+        return axis;
+    }
+};
+
+/**
+ * @brief Stage looking the axis up in its
+ * response table: deadzone, response curve and
+ * trim in a single load.
+ */
+struct cResponseTableStage
+{
+    static inline int Process(int axis, cJoystickAxis* input)
+    {
+        int index = axis - _JOY_MIN_VAL;
+        index = index < 0 ? 0 : (index >= JOYSTICK_RESPONSE_TABLE_SIZE ? JOYSTICK_RESPONSE_TABLE_SIZE - 1 : index);
+        return input->responseTable[index];
+    }
+};
+
+/**
+ * @brief Stage keeping only the Bits most
+ * significant bits of the axis, to hide ADC
+ * noise. Rounds towards the middle so both
+ * signs get the same steps.
+ * @tparam Bits
+ * Bits kept, from 1 to _JOY_ADC_BITS.
+ */
+template<int Bits>
+struct cQuantizeAxisStage
+{
+    static_assert(Bits > 0 && Bits <= _JOY_ADC_BITS, "cQuantizeAxisStage keeps 1 to _JOY_ADC_BITS bits");
+    static constexpr int step = 1 << (_JOY_ADC_BITS - Bits);
+
+    static inline int Process(int axis, cJoystickAxis*)
+    {
+        return (axis / step) * step;
+    }
+};
+
+/**
+ * @brief Stage averaging the last Length axis
+ * values. Delays moves by (Length - 1) / 2
+ * samples, so only short ones stay under a
+ * sample of latency.
+ * @tparam Length
+ * Values averaged, from 1 to JOYSTICK_MOVING_AVERAGE_MAX_LENGTH.
+ */
+template<int Length>
+struct cMovingAverageStage
+{
+    static_assert(Length > 0 && Length <= JOYSTICK_MOVING_AVERAGE_MAX_LENGTH, "cMovingAverageStage is longer than JOYSTICK_MOVING_AVERAGE_MAX_LENGTH");
+
+    static inline int Process(int axis, cJoystickAxis* input)
+    {
+        cJoystickAxisFilter* filter = &input->filter;
+
+        if(!filter->averagePrimed)
+        {
+            for(int index = 0; index < Length; index++)
+            {
+                filter->averageHistory[index] = axis;
+            }
+            filter->averageSum = axis * Length;
+            filter->averageIndex = 0;
+            filter->averagePrimed = true;
+        }
+
+        filter->averageSum += axis - filter->averageHistory[filter->averageIndex];
+        filter->averageHistory[filter->averageIndex] = axis;
+        filter->averageIndex = (filter->averageIndex + 1) % Length;
+
+        // Rounded to the closest, away from the middle on ties, like both signs should.
+        return (filter->averageSum + (filter->averageSum < 0 ? -Length / 2 : Length / 2)) / Length;
+    }
+};
+
+/**
+ * @brief Stage keeping the median of the last
+ * 3 axis values. Removes single sample spikes
+ * completely, but delays moves by a sample.
+ */
+struct cMedianOf3Stage
+{
+    static inline int Process(int axis, cJoystickAxis* input)
+    {
+        cJoystickAxisFilter* filter = &input->filter;
+
+        if(!filter->medianPrimed)
+        {
+            filter->medianHistory[0] = axis;
+            filter->medianHistory[1] = axis;
+            filter->medianPrimed = true;
+        }
+
+        int a = axis;
+        int b = filter->medianHistory[0];
+        int c = filter->medianHistory[1];
+        filter->medianHistory[1] = b;
+        filter->medianHistory[0] = a;
+
+        int low = a < b ? a : b;
+        int high = a < b ? b : a;
+        return c < low ? low : (c > high ? high : c);
+    }
+};
+
+/**
+ * @brief Stage smoothing the axis with a low-pass
+ * whose strength follows the axis's speed, like
+ * the 1 euro filter. Still, the axis is heavily
+ * smoothed and ADC noise stops causing changes.
+ * Moving, the filter opens until it follows the
+ * axis as is, so fast moves get no latency.
+ * @tparam MinAlpha
+ * Q15 weight of a new sample when still. 1 << _JOY_Q disables the filter.
+ * @tparam Beta
+ * Q15 added to that weight per LSB per sample the axis moves.
+ */
+template<int MinAlpha, int Beta>
+struct cAdaptiveFilterStage
+{
+    static_assert(MinAlpha > 0 && MinAlpha <= (1 << _JOY_Q), "cAdaptiveFilterStage's MinAlpha is a Q15 from 0 to 1");
+    static_assert(Beta >= 0, "cAdaptiveFilterStage's Beta cannot be negative");
+
+    static inline int Process(int axis, cJoystickAxis* input)
+    {
+        cJoystickAxisFilter* filter = &input->filter;
+        int sample = axis * (1 << _JOY_FILTER_FRACTION_BITS);
+
+        if(!filter->adaptivePrimed)
+        {
+            filter->adaptiveFiltered = sample;
+            filter->adaptivePrevious = sample;
+            filter->adaptiveVelocity = 0;
+            filter->adaptivePrimed = true;
+        }
+
+        int derivative = sample - filter->adaptivePrevious;
+        filter->adaptivePrevious = sample;
+
+        // Smoothed while signed, so noise mostly cancels out and does not open the filter.
+        filter->adaptiveVelocity += (derivative - filter->adaptiveVelocity) / 4;
+        int speed = filter->adaptiveVelocity < 0 ? -filter->adaptiveVelocity : filter->adaptiveVelocity;
+
+        long long alpha = MinAlpha + (((long long)speed * Beta) >> _JOY_FILTER_FRACTION_BITS);
+        if(alpha > (1 << _JOY_Q))
+        {
+            alpha = 1 << _JOY_Q;
+        }
+
+        filter->adaptiveFiltered += (int)(((long long)(sample - filter->adaptiveFiltered) * alpha) / (1 << _JOY_Q));
+
+        // Back to whole LSB, rounded to the closest.
+        return (filter->adaptiveFiltered + (1 << (_JOY_FILTER_FRACTION_BITS - 1))) >> _JOY_FILTER_FRACTION_BITS;
+    }
+};
+
+/// @brief Filter of JOYSTICK_MODE_CALIBRATED. Any filter stage fits here.
+typedef cAdaptiveFilterStage<JOYSTICK_FILTER_MIN_ALPHA, JOYSTICK_FILTER_BETA> cJoystickNoiseFilterStage;
+
+/**
+ * @brief Processing an axis goes through, as a
+ * list of stages chosen at compile time. Each
+ * stage gets what the one before returned.
+ * Everything is resolved and inlined by the
+ * compiler: a stage that is not listed costs
+ * nothing and none of them are virtual.
+ *
+ * Example: cJoystickPipeline<cReadAxisStage, cQuantizeAxisStage<8>>
+ *
+ * A stage is any type with:
+ * static inline int Process(int axis, cJoystickAxis* input)
+ */
+template<typename... Stages> struct cJoystickPipeline
+{
+    static inline int Process(int axis, cJoystickAxis*)
+    {
+        return axis;
+    }
+};
+
+template<typename First, typename... Rest> struct cJoystickPipeline<First, Rest...>
+{
+    static inline int Process(int axis, cJoystickAxis* input)
+    {
+        return cJoystickPipeline<Rest...>::Process(First::Process(axis, input), input);
+    }
+};
+
+/**
+ * @brief Pair stage leaving both axes as they
+ * are. Pair stages shape both axes of a
+ * joystick together, between the pipeline each
+ * axis goes through and its shaping pipeline.
+ * A pair stage is any type with:
+ * static inline void Process(int* x, int* y, const cJoystickRadialDeadzone* radial)
+ */
+struct cNoPairStage
+{
+    static inline void Process(int*, int*, const cJoystickRadialDeadzone*)
+    {
+    }
+};
+
+/**
+ * @brief Pair stage applying a radial
+ * deadzone. Sticks within it are centered.
+ * Past it, both axes are scaled by the same
+ * amount, so the direction is kept and
+ * diagonals are not pulled towards the axes
+ * like with per axis deadzones.
+ * Runs before the response tables. Corners are
+ * past the stick's circle, so they can leave
+ * it beyond _JOY_MAX_VAL, by up to the scale.
+ * cResponseTableStage clamps them to the
+ * table's ends.
+ */
+struct cRadialDeadzoneStage
+{
+    static inline void Process(int* x, int* y, const cJoystickRadialDeadzone* radial)
+    {
+        if(radial->deadzone == 0)
+        {
+            return;
+        }
+
+        int magnitude = ApproximateJoystickMagnitude(*x, *y);
+        if(magnitude <= radial->deadzone)
+        {
+            *x = _JOY_MID_VAL;
+            *y = _JOY_MID_VAL;
+            return;
+        }
+
+        // Q15 gain bringing the magnitude from [deadzone, max] to [0, max]. Below the scale, so at most 2.0 and no overflow.
+        // The one division of each sample past the deadzone.
+        int gain = (magnitude - radial->deadzone) * radial->scale / magnitude;
+        *x = *x * gain / (1 << _JOY_Q);
+        *y = *y * gain / (1 << _JOY_Q);
+    }
+};
+
+/// @brief Pipeline of JOYSTICK_MODE_CALIBRATED, up to the pair stage.
+typedef cJoystickPipeline<cScanReadStage, cJoystickNoiseFilterStage> cCalibratedJoystickPipeline;
+/// @brief Pipeline of JOYSTICK_MODE_CALIBRATED, after the pair stage.
+typedef cJoystickPipeline<cResponseTableStage> cCalibratedJoystickShaping;
+/// @brief Pipeline of JOYSTICK_MODE_BYPASSED
+typedef cJoystickPipeline<cCenterAxisStage> cBypassedJoystickPipeline;
+/// @brief Pipeline of JOYSTICK_MODE_RAW
+typedef cJoystickPipeline<cScanReadStage> cRawJoystickPipeline;
+
 /**
  * @brief The cJoystick class allows
  * the handling of a joystick on a PCB.
  * It reads and stores data each time its
  * update function is called.
+ * @attention
+ * Settings may be set from another task than
+ * the one calling Update, but only from one.
  */
 class cJoystick
  {       
@@ -97,19 +742,84 @@ class cJoystick
         /// @brief Deazone to apply to the Y axis. If within that deadzone, 0 is returned.
         int _yDeadzone = 0;
 
-        /// @brief 0: Normal functions 1: Bypassed (always return 0)
-        unsigned char _mode = 0;
+        /// @brief Response curve of both axes. Built into their response tables.
+        cJoystickResponse _response;
+        /// @brief Radial deadzone set. See _radial for the one in use.
+        int _radialDeadzone = 0;
+
+        /// @brief Response tables and settings handed to Update. nullptr if the joystick was not built.
+        cJoystickShaping* _shaping = nullptr;
+
+        /// @brief Pin and coefficients of the X axis. Coefficients and response table are refreshed by Update when _xDeadzone or _xTrim were set.
+        cJoystickAxis _xInput;
+        /// @brief Pin and coefficients of the Y axis. Coefficients and response table are refreshed by Update when _yDeadzone or _yTrim were set.
+        cJoystickAxis _yInput;
+
+        /// @brief Radial deadzone in use, applied before the response tables. Only Update changes it.
+        cJoystickRadialDeadzone _radial;
+        /// @brief Settings the tables, coefficients and _radial were built from. Only Update changes them.
+        cJoystickSettings _applied;
+        /// @brief Version of _applied. See cJoystickShaping::Take.
+        unsigned int _appliedVersion = 0;
+
+        /**
+         * @brief Computes an axis's coefficients and
+         * rebuilds its response table.
+         * Only called when a setting changed.
+         */
+        void _RefreshAxis(cJoystickAxis* input, short* table, int deadzone, int trim, const cJoystickResponse* response);
+
+        /// @brief Hands the settings to Update, through _shaping.
+        void _PublishSettings();
+
+        /**
+         * @brief Rebuilds what the settings handed
+         * since the last sample changed. Only called
+         * by the task sampling the joystick.
+         * @param everything
+         * true to rebuild everything, even if nothing changed.
+         */
+        void _ApplySettings(bool everything);
+
+        /// @brief 0: Normal functions 1: Bypassed (always return 0) 2: Raw (no deadzone nor trim)
+        unsigned char _mode = JOYSTICK_MODE_CALIBRATED;
 
-        /// @brief Pin used for the X axis
-        int _analogXPin = -1;
-        int _analogYPin = -1;
         int _switchPin = -1;
 
+        /// @brief Update of the current mode. Set by SetMode, so Update never checks the mode.
+        Execution (cJoystick::*_update)() = nullptr;
+
+        /**
+         * @brief Puts both axes through a pipeline,
+         * then both through a pair stage, then each
+         * through a shaping pipeline, and reads the
+         * switch. One instance per mode.
+         * @tparam Pipeline
+         * See cJoystickPipeline.
+         * @tparam PairStage
+         * See cNoPairStage.
+         * @tparam Shaping
+         * See cJoystickPipeline.
+         * @tparam ReadSwitch
+         * false to leave the switch released.
+         */
+        template<class Pipeline, class PairStage, class Shaping, bool ReadSwitch>
+        Execution _UpdateWith()
+        {
+            _xAxis = Pipeline::Process(_xAxis, &_xInput);
+            _yAxis = Pipeline::Process(_yAxis, &_yInput);
+            PairStage::Process(&_xAxis, &_yAxis, &_radial);
+            _xAxis = Shaping::Process(_xAxis, &_xInput);
+            _yAxis = Shaping::Process(_yAxis, &_yInput);
+            _switch = ReadSwitch ? digitalRead(_switchPin) : false;
+            return Execution::Passed;
+        }
+
     public:
         /// @brief set to true if the class is constructed.
         bool built = false;
         //////////////////////////////////////////////
-        cJoystick(int pinAxisX, int pinAxisY, int pinSwitch);
+        cJoystick(int pinAxisX, int pinAxisY, int pinSwitch, cJoystickShaping* shaping);
         cJoystick();
         //////////////////////////////////////////////
 
@@ -120,6 +830,7 @@ class cJoystick
          * @param newMode 
          * 0: Default, regular functionning
          * 1: Bypassed (always return 0 / released)
+         * 2: Raw (no deadzone nor trim)
          * @return Execution 
          */
         Execution SetMode(unsigned char newMode);
@@ -131,6 +842,7 @@ class cJoystick
          * @param currentMode 
          * 0: Default, regular functionning
          * 1: Bypassed (always return 0 / released)
+         * 2: Raw (no deadzone nor trim)
          * @return Execution 
          */
         Execution GetMode(unsigned char* currentMode);
@@ -214,6 +926,54 @@ class cJoystick
          */
         Execution GetTrim_Y(int* currentTrim);
 
+        /**
+         * @brief Sets the response curve of both
+         * axes. Their response tables are rebuilt
+         * once, by the next Update.
+         * @param newCurve
+         * See JOYSTICK_CURVE_LINEAR.
+         * @param newStrength
+         * 0 (straight line) to JOYSTICK_CURVE_MAX_STRENGTH (the whole curve).
+         * @return Execution::Passed = Set | Execution::Unecessary = Already set | Execution::Failed = No such curve
+         */
+        Execution SetResponseCurve(unsigned char newCurve, unsigned char newStrength);
+        /**
+         * @brief Sets the points JOYSTICK_CURVE_CUSTOM
+         * goes through.
+         * @param newPoints
+         * JOYSTICK_CURVE_POINTS outputs, 0 to 255, at
+         * 1/8 to 8/8 of the travel.
+         * @return Execution::Passed = Set | Execution::Unecessary = Already set
+         */
+        Execution SetResponsePoints(const unsigned char* newPoints);
+        /**
+         * @brief Gets the response curve of both
+         * axes, with its strength and points.
+         * @param currentResponse
+         * Where it is placed.
+         * @return Execution 
+         */
+        Execution GetResponse(cJoystickResponse* currentResponse);
+
+        /**
+         * @brief Sets the joystick's radial deadzone.
+         * Sticks closer than it to the middle are
+         * centered, whatever their direction. 0 to
+         * only use the deadzones of each axis.
+         * @param newDeadZone
+         * 0 to JOYSTICK_MAX_RADIAL_DEADZONE.
+         * @return Execution::Passed = Set | Execution::Unecessary = Already set | Execution::Failed = Out of range
+         */
+        Execution SetRadialDeadZone(int newDeadZone);
+        /**
+         * @brief Gets the joystick's radial deadzone.
+         * Default value is 0.
+         * @param currentDeadZone
+         * Where it is placed.
+         * @return Execution 
+         */
+        Execution GetRadialDeadZone(int* currentDeadZone);
+
         /**
          * @brief Get the current X axis. The value is
          * updated when Update() is called.
@@ -263,7 +1023,12 @@ class cJoystick
         /**
          * @brief Time base function which needs to be
          * called at a constant interval in order to
-         * update the joystick's values.
+         * update the joystick's values. The axes are
+         * taken from the ADC scanner's front scan, so
+         * swap it first. See InterfaceJoysticks.
+         * Settings set since the last call are
+         * applied first, so only the task calling
+         * Update ever touches the response tables.
          * @return Execution 
          */
         Execution Update();
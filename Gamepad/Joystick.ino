@@ -44,30 +44,9 @@ Execution CalculateJoystickAxisDeadzone(int* axisToModify, int Deadzone)
 {
     if(Deadzone > 0)
     {
-        int oldAxis = *axisToModify;
-        double maxAxisWithDeadzone = _JOY_MAX_VAL - (double) Deadzone;
-        double currentAxis = (double)(*axisToModify);
-
-        if(oldAxis <= Deadzone && oldAxis >= -Deadzone)
-        {
-            *axisToModify = _JOY_MID_VAL;
-            return Execution::Passed;
-        }
-        else
-        {
-            // Converts deadzone offset applied so the axis is still from -2048 to 2048
-            currentAxis = ((currentAxis * maxAxisWithDeadzone) / _JOY_MAX_VAL);
-            if(oldAxis < 0)
-            {
-                currentAxis = currentAxis + (double) Deadzone;
-            }
-            else
-            {
-                currentAxis = currentAxis - (double) Deadzone;
-            }   
-            *axisToModify = (int)currentAxis;
-            return Execution::Passed;
-        }
+        cJoystickAxisCoefficients coefficients;
+        CalculateJoystickAxisCoefficients(Deadzone, 0, &coefficients);
+        return ApplyJoystickAxisCoefficients(axisToModify, &coefficients);
     }
     else
     {
@@ -99,38 +78,297 @@ Execution CalculateJoystickAxisTrim(int* axisToModify, int Trim)
 {
     if(Trim != 0)
     {
-        if(*axisToModify == _JOY_MID_VAL)
+        cJoystickAxisCoefficients coefficients;
+        CalculateJoystickAxisCoefficients(0, Trim, &coefficients);
+        return ApplyJoystickAxisCoefficients(axisToModify, &coefficients);
+    }
+    else
+    {
+        return Execution::Unecessary;
+    }
+}
+
+/**
+ * @brief Computes the fixed point coefficients
+ * of an axis's deadzone and trim. Call it when
+ * they change, not on each sample.
+ * Deadzones and trims past _JOY_MAX_VAL are
+ * treated as _JOY_MAX_VAL.
+ * @param Deadzone
+ * Deadzone of the axis. Must be positive.
+ * @param Trim
+ * Trim of the axis.
+ * @param coefficients
+ * Where the coefficients are placed.
+ * @return Execution::Passed = Placed | Execution::Failed = Negative deadzone
+ */
+Execution CalculateJoystickAxisCoefficients(int Deadzone, int Trim, cJoystickAxisCoefficients* coefficients)
+{
+    if(Deadzone < 0)
+    {
+        return Execution::Failed;
+    }
+
+    // Past the end of the axis, the scale would go negative.
+    if(Deadzone > _JOY_MAX_VAL)
+    {
+        Deadzone = _JOY_MAX_VAL;
+    }
+    if(Trim > _JOY_MAX_VAL)
+    {
+        Trim = _JOY_MAX_VAL;
+    }
+    if(Trim < -_JOY_MAX_VAL)
+    {
+        Trim = -_JOY_MAX_VAL;
+    }
+
+    // _JOY_MAX_VAL is a power of 2 below 1 << _JOY_Q, so these scales are exact.
+    coefficients->deadzone = Deadzone;
+    coefficients->deadzoneScale = ((_JOY_MAX_VAL - Deadzone) << _JOY_Q) / _JOY_MAX_VAL;
+    coefficients->deadzoneOffset = Deadzone << _JOY_Q;
+    coefficients->trimScale = ((_JOY_MAX_VAL - (Trim < 0 ? -Trim : Trim)) << _JOY_Q) / _JOY_MAX_VAL;
+    coefficients->trimOffset = Trim * (1 << _JOY_Q);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Applies the deadzone then the trim of
+ * an axis, in integers only. Gives exactly what
+ * CalculateJoystickAxisDeadzone followed by
+ * CalculateJoystickAxisTrim gives.
+ * @param axisToModify
+ * Pointer to the axis that will be modified.
+ * Must be within _JOY_MIN_VAL and _JOY_MAX_VAL.
+ * @param coefficients
+ * Computed by CalculateJoystickAxisCoefficients.
+ * @return Execution
+ */
+Execution ApplyJoystickAxisCoefficients(int* axisToModify, const cJoystickAxisCoefficients* coefficients)
+{
+    int axis = *axisToModify;
+
+    if(axis <= coefficients->deadzone && axis >= -coefficients->deadzone)
+    {
+        axis = _JOY_MID_VAL;
+    }
+    else
+    {
+        // Converts deadzone offset applied so the axis is still from -2048 to 2048
+        int scaledAxis = axis * coefficients->deadzoneScale;
+        if(axis < 0)
         {
-            *axisToModify = Trim;
-            return Execution::Passed;
+            scaledAxis += coefficients->deadzoneOffset;
         }
-        
-        double maxValue = 0;
-        double resultAxis = (double) *axisToModify;
-        double trim = (double)Trim;
-        
-        if(Trim > 0){
-            maxValue = _JOY_MAX_VAL - trim;
+        else
+        {
+            scaledAxis -= coefficients->deadzoneOffset;
         }
-        else{
-            maxValue = _JOY_MAX_VAL + trim;
+        // Divided, not shifted: rounds towards 0 like the (int) casts did.
+        axis = scaledAxis / (1 << _JOY_Q);
+    }
+
+    *axisToModify = (axis * coefficients->trimScale + coefficients->trimOffset) / (1 << _JOY_Q);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Puts an axis through a response
+ * curve. Both signs are shaped the same way.
+ * @param axis
+ * From _JOY_MIN_VAL to _JOY_MAX_VAL.
+ * @param response
+ * The curve. Must be valid.
+ * @return The shaped axis, within the same range.
+ */
+int CalculateJoystickResponse(int axis, const cJoystickResponse* response)
+{
+    // Both signs share the curve of the positive half. 64 bits: t^3 does not fit in 32.
+    long long travel = axis < 0 ? -axis : axis;
+    long long curved = travel;
+    const long long full = _JOY_MAX_VAL;
+
+    switch(response->curve)
+    {
+        case JOYSTICK_CURVE_EXPO:
+            curved = travel * travel * travel / (full * full);
+            break;
+
+        case JOYSTICK_CURVE_S:
+            curved = (3 * travel * travel * full - 2 * travel * travel * travel) / (full * full);
+            break;
+
+        case JOYSTICK_CURVE_CUSTOM:
+        {
+            // Straight lines between the points. The middle is an implicit point at 0.
+            const int width = _JOY_MAX_VAL / JOYSTICK_CURVE_POINTS;
+            int segment = (int)travel / width;
+            if(segment >= JOYSTICK_CURVE_POINTS)
+            {
+                curved = response->points[JOYSTICK_CURVE_POINTS - 1] * full / 255;
+                break;
+            }
+            long long from = segment == 0 ? 0 : response->points[segment - 1] * full / 255;
+            long long to = response->points[segment] * full / 255;
+            curved = from + (to - from) * (travel - segment * width) / width;
+            break;
         }
-        resultAxis = ((resultAxis * maxValue)/_JOY_MAX_VAL) + trim;
-        *axisToModify = (int)resultAxis;
-        return Execution::Passed;
+
+        default:
+            break;
     }
-    else
+
+    // Blended with the straight line by the strength.
+    curved = travel + (curved - travel) * response->strength / JOYSTICK_CURVE_MAX_STRENGTH;
+    return axis < 0 ? -(int)curved : (int)curved;
+}
+
+/**
+ * @brief Fills the response table of an axis:
+ * the axis value each ADC value becomes once
+ * its deadzone, the response curve, then its
+ * trim are applied. Call it when one of them
+ * changes. Sampling the axis is then a single
+ * lookup.
+ * With a straight line, gives exactly what
+ * ApplyJoystickAxisCoefficients gives.
+ * @param Deadzone
+ * Deadzone of the axis. Must be positive.
+ * @param Trim
+ * Trim of the axis.
+ * @param response
+ * The response curve.
+ * @param table
+ * JOYSTICK_RESPONSE_TABLE_SIZE entries. Entry 0 is _JOY_MIN_VAL.
+ * @return Execution::Passed = Filled | Execution::Failed = Negative deadzone or no such curve
+ */
+Execution BuildJoystickResponseTable(int Deadzone, int Trim, const cJoystickResponse* response, short* table)
+{
+    cJoystickAxisCoefficients deadzone;
+    cJoystickAxisCoefficients trim;
+
+    if(response->curve >= JOYSTICK_CURVE_COUNT || CalculateJoystickAxisCoefficients(Deadzone, 0, &deadzone) != Execution::Passed)
+    {
+        return Execution::Failed;
+    }
+    CalculateJoystickAxisCoefficients(0, Trim, &trim);
+
+    // The trim comes last so it offsets the curve instead of being bent by it.
+    for(int index = 0; index < JOYSTICK_RESPONSE_TABLE_SIZE; index++)
+    {
+        int axis = index + _JOY_MIN_VAL;
+        ApplyJoystickAxisCoefficients(&axis, &deadzone);
+        axis = CalculateJoystickResponse(axis, response);
+        ApplyJoystickAxisCoefficients(&axis, &trim);
+        table[index] = (short)axis;
+    }
+    return Execution::Passed;
+}
+
+/**
+ * @brief Computes the radial deadzone's
+ * rescaling. Call it when it changes.
+ * @param Deadzone
+ * 0 to JOYSTICK_MAX_RADIAL_DEADZONE.
+ * @param radial
+ * Where it is placed.
+ * @return Execution::Passed = Placed | Execution::Failed = Out of range
+ */
+Execution CalculateJoystickRadialDeadzone(int Deadzone, cJoystickRadialDeadzone* radial)
+{
+    if(Deadzone < 0 || Deadzone > JOYSTICK_MAX_RADIAL_DEADZONE)
+    {
+        return Execution::Failed;
+    }
+
+    radial->deadzone = Deadzone;
+    radial->scale = (_JOY_MAX_VAL << _JOY_Q) / (_JOY_MAX_VAL - Deadzone);
+    return Execution::Passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+cJoystickShaping::cJoystickShaping()
+{
+    _sequence.store(0);
+    for(unsigned int word = 0; word < JOYSTICK_SETTINGS_WORDS; word++)
+    {
+        _words[word].store(0);
+    }
+}
+
+/**
+ * @brief Hands settings to the task sampling
+ * the joystick. Never waits.
+ * @param settings
+ * Settings to use from its next sample on.
+ * @return Execution::Passed = Published
+ */
+Execution cJoystickShaping::Publish(const cJoystickSettings* settings)
+{
+    unsigned int words[JOYSTICK_SETTINGS_WORDS];
+    unsigned int sequence = _sequence.load(std::memory_order_relaxed);
+
+    memcpy(words, settings, sizeof(words));
+
+    // Odd: Take bypasses them until they are whole. The release stores keep the words after it.
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    for(unsigned int word = 0; word < JOYSTICK_SETTINGS_WORDS; word++)
+    {
+        _words[word].store(words[word], std::memory_order_release);
+    }
+    _sequence.store(sequence + 2, std::memory_order_release);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Gets the settings last published,
+ * if they are not the ones already taken.
+ * Never returns settings that were half
+ * published.
+ * @param resultedSettings
+ * Where the settings are placed.
+ * @param version
+ * Version of the settings already taken, 0 at first. Updated.
+ * @return Execution::Passed = Newer settings placed | Execution::Unecessary = Nothing new | Execution::Bypassed = Raced a Publish, take them on the next sample
+ */
+Execution cJoystickShaping::Take(cJoystickSettings* resultedSettings, unsigned int* version)
+{
+    unsigned int words[JOYSTICK_SETTINGS_WORDS];
+    unsigned int before = _sequence.load(std::memory_order_acquire);
+
+    if(before == *version)
     {
         return Execution::Unecessary;
     }
+
+    // The sample goes on with the settings it has, it does not wait for the other task.
+    if((before & 1) != 0)
+    {
+        return Execution::Bypassed;
+    }
+
+    // Acquire loads: if one saw a word of the next settings, the sequence below saw it too.
+    for(unsigned int word = 0; word < JOYSTICK_SETTINGS_WORDS; word++)
+    {
+        words[word] = _words[word].load(std::memory_order_acquire);
+    }
+
+    if(_sequence.load(std::memory_order_relaxed) != before)
+    {
+        return Execution::Bypassed;
+    }
+
+    memcpy(resultedSettings, words, sizeof(words));
+    *version = before;
+    return Execution::Passed;
 }
 
 /////////////////////////////////////////////////////////////////////////////
-cJoystick::cJoystick(int pinAxisX, int pinAxisY, int pinSwitch)
+cJoystick::cJoystick(int pinAxisX, int pinAxisY, int pinSwitch, cJoystickShaping* shaping)
 {
     if(pinAxisX < 46){
-        _analogXPin = pinAxisX;
-        pinMode(_analogXPin, INPUT);
+        _xInput.pin = pinAxisX;
+        pinMode(_xInput.pin, INPUT);
     }
     else{
         built = false;
@@ -138,14 +376,33 @@ cJoystick::cJoystick(int pinAxisX, int pinAxisY, int pinSwitch)
     }
 
     if(pinAxisY < 46 && pinAxisX != pinAxisY){
-        _analogYPin = pinAxisY;
-        pinMode(_analogYPin, INPUT);
+        _yInput.pin = pinAxisY;
+        pinMode(_yInput.pin, INPUT);
     }
     else{
         built = false;
         return;
     }
 
+    // The axes are only ever read from the ADC scanner.
+    if(AdcScanner.GetChannel(_xInput.pin, &_xInput.channel) != Execution::Passed || AdcScanner.GetChannel(_yInput.pin, &_yInput.channel) != Execution::Passed){
+        built = false;
+        return;
+    }
+
+    if(shaping == nullptr){
+        built = false;
+        return;
+    }
+
+    // The tables stay where they were declared, wherever the joystick object is copied.
+    _shaping = shaping;
+    _xInput.responseTable = _shaping->xTable;
+    _yInput.responseTable = _shaping->yTable;
+    // Nothing samples the joystick yet, so its tables are built right away.
+    _PublishSettings();
+    _ApplySettings(true);
+
     if(pinSwitch < 46 && pinSwitch != pinAxisY && pinSwitch != pinAxisX){
         _switchPin = pinSwitch;
         pinMode(_switchPin, INPUT_PULLUP);
@@ -155,11 +412,79 @@ cJoystick::cJoystick(int pinAxisX, int pinAxisY, int pinSwitch)
         return;
     }
 
+    _update = &cJoystick::_UpdateWith<cCalibratedJoystickPipeline, cRadialDeadzoneStage, cCalibratedJoystickShaping, true>;
     built = true;
 }
 
 cJoystick::cJoystick()
 {
+    _update = &cJoystick::_UpdateWith<cCalibratedJoystickPipeline, cRadialDeadzoneStage, cCalibratedJoystickShaping, true>;
+}
+
+/**
+ * @brief Computes an axis's coefficients and
+ * rebuilds its response table.
+ * Only called when a setting changed.
+ */
+void cJoystick::_RefreshAxis(cJoystickAxis* input, short* table, int deadzone, int trim, const cJoystickResponse* response)
+{
+    CalculateJoystickAxisCoefficients(deadzone, trim, &input->coefficients);
+    BuildJoystickResponseTable(deadzone, trim, response, table);
+}
+
+/**
+ * @brief Hands the settings to Update, through
+ * _shaping.
+ */
+void cJoystick::_PublishSettings()
+{
+    cJoystickSettings settings;
+
+    if(_shaping == nullptr)
+    {
+        return;
+    }
+
+    settings.xDeadzone = _xDeadzone;
+    settings.yDeadzone = _yDeadzone;
+    settings.xTrim = _xTrim;
+    settings.yTrim = _yTrim;
+    settings.radialDeadzone = _radialDeadzone;
+    settings.response = _response;
+    _shaping->Publish(&settings);
+}
+
+/**
+ * @brief Rebuilds what the settings handed
+ * since the last sample changed. Only called
+ * by the task sampling the joystick.
+ * @param everything
+ * true to rebuild everything, even if nothing changed.
+ */
+void cJoystick::_ApplySettings(bool everything)
+{
+    cJoystickSettings settings = _applied;
+
+    if(_shaping->Take(&settings, &_appliedVersion) != Execution::Passed && !everything)
+    {
+        return;
+    }
+
+    // Rebuilding a table is 4096 entries, so only the ones whose settings changed are.
+    bool responseChanged = everything || memcmp(&settings.response, &_applied.response, sizeof(cJoystickResponse)) != 0;
+    if(responseChanged || settings.xDeadzone != _applied.xDeadzone || settings.xTrim != _applied.xTrim)
+    {
+        _RefreshAxis(&_xInput, _shaping->xTable, settings.xDeadzone, settings.xTrim, &settings.response);
+    }
+    if(responseChanged || settings.yDeadzone != _applied.yDeadzone || settings.yTrim != _applied.yTrim)
+    {
+        _RefreshAxis(&_yInput, _shaping->yTable, settings.yDeadzone, settings.yTrim, &settings.response);
+    }
+    if(everything || settings.radialDeadzone != _applied.radialDeadzone)
+    {
+        CalculateJoystickRadialDeadzone(settings.radialDeadzone, &_radial);
+    }
+    _applied = settings;
 }
 
 /**
@@ -169,15 +494,33 @@ cJoystick::cJoystick()
  * @param newMode 
  * 0: Default, regular functionning
  * 1: Bypassed (always return 0 / released)
+ * 2: Raw (no deadzone nor trim)
  * @return Execution 
  */
 Execution cJoystick::SetMode(unsigned char newMode)
 {
-    if(newMode < 2)
+    // Indexed by mode. Each mode is its own pipeline instance.
+    static Execution (cJoystick::* const updates[JOYSTICK_MODE_COUNT])() =
+    {
+        &cJoystick::_UpdateWith<cCalibratedJoystickPipeline, cRadialDeadzoneStage, cCalibratedJoystickShaping, true>,
+        &cJoystick::_UpdateWith<cBypassedJoystickPipeline, cNoPairStage, cJoystickPipeline<>, false>,
+        &cJoystick::_UpdateWith<cRawJoystickPipeline, cNoPairStage, cJoystickPipeline<>, true>
+    };
+
+    if(newMode < JOYSTICK_MODE_COUNT)
     {
         if(newMode != _mode)
         {
             _mode = newMode;
+            _update = updates[newMode];
+            // Filters start over from the first sample of the new pipeline.
+            _xInput.filter = cJoystickAxisFilter();
+            _yInput.filter = cJoystickAxisFilter();
+            if(newMode == JOYSTICK_MODE_BYPASSED)
+            {
+                // Get functions return 0 / released right away, not after the next Update.
+                _UpdateWith<cBypassedJoystickPipeline, cNoPairStage, cJoystickPipeline<>, false>();
+            }
             return Execution::Passed;
         }
         else
@@ -199,6 +542,7 @@ Execution cJoystick::SetMode(unsigned char newMode)
  * @param currentMode 
  * 0: Default, regular functionning
  * 1: Bypassed (always return 0 / released)
+ * 2: Raw (no deadzone nor trim)
  * @return Execution 
  */
 Execution cJoystick::GetMode(unsigned char* currentMode)
@@ -224,6 +568,7 @@ Execution cJoystick::SetDeadZone_X(int newDeadZone)
             newDeadZone = -newDeadZone;
         }
         _xDeadzone = newDeadZone;
+        _PublishSettings();
         return Execution::Passed;
     }
     else
@@ -248,6 +593,7 @@ Execution cJoystick::SetDeadZone_Y(int newDeadZone)
             newDeadZone = -newDeadZone;
         }
         _yDeadzone = newDeadZone;
+        _PublishSettings();
         return Execution::Passed;
     }
     else
@@ -296,6 +642,7 @@ Execution cJoystick::SetTrim_X(int newTrim)
     if(newTrim != _xTrim)
     {
         _xTrim = newTrim;
+        _PublishSettings();
         return Execution::Passed;
     }
     else
@@ -316,6 +663,7 @@ Execution cJoystick::SetTrim_Y(int newTrim)
     if(newTrim != _yTrim)
     {
         _yTrim = newTrim;
+        _PublishSettings();
         return Execution::Passed;
     }
     else
@@ -352,6 +700,107 @@ Execution cJoystick::GetTrim_Y(int* currentTrim)
     return Execution::Passed;
 }
 
+/**
+ * @brief Sets the response curve of both
+ * axes. Their response tables are rebuilt
+ * once, by the next Update.
+ * @param newCurve
+ * See JOYSTICK_CURVE_LINEAR.
+ * @param newStrength
+ * 0 (straight line) to JOYSTICK_CURVE_MAX_STRENGTH (the whole curve).
+ * @return Execution::Passed = Set | Execution::Unecessary = Already set | Execution::Failed = No such curve
+ */
+Execution cJoystick::SetResponseCurve(unsigned char newCurve, unsigned char newStrength)
+{
+    if(newCurve >= JOYSTICK_CURVE_COUNT)
+    {
+        return Execution::Failed;
+    }
+
+    if(newCurve == _response.curve && newStrength == _response.strength)
+    {
+        return Execution::Unecessary;
+    }
+
+    _response.curve = newCurve;
+    _response.strength = newStrength;
+    _PublishSettings();
+    return Execution::Passed;
+}
+/**
+ * @brief Sets the points JOYSTICK_CURVE_CUSTOM
+ * goes through.
+ * @param newPoints
+ * JOYSTICK_CURVE_POINTS outputs, 0 to 255, at
+ * 1/8 to 8/8 of the travel.
+ * @return Execution::Passed = Set | Execution::Unecessary = Already set
+ */
+Execution cJoystick::SetResponsePoints(const unsigned char* newPoints)
+{
+    if(memcmp(_response.points, newPoints, JOYSTICK_CURVE_POINTS) == 0)
+    {
+        return Execution::Unecessary;
+    }
+
+    memcpy(_response.points, newPoints, JOYSTICK_CURVE_POINTS);
+    // Other curves do not use them.
+    if(_response.curve == JOYSTICK_CURVE_CUSTOM)
+    {
+        _PublishSettings();
+    }
+    return Execution::Passed;
+}
+/**
+ * @brief Gets the response curve of both
+ * axes, with its strength and points.
+ * @param currentResponse
+ * Where it is placed.
+ * @return Execution 
+ */
+Execution cJoystick::GetResponse(cJoystickResponse* currentResponse)
+{
+    *currentResponse = _response;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Sets the joystick's radial deadzone.
+ * Sticks closer than it to the middle are
+ * centered, whatever their direction. 0 to
+ * only use the deadzones of each axis.
+ * @param newDeadZone
+ * 0 to JOYSTICK_MAX_RADIAL_DEADZONE.
+ * @return Execution::Passed = Set | Execution::Unecessary = Already set | Execution::Failed = Out of range
+ */
+Execution cJoystick::SetRadialDeadZone(int newDeadZone)
+{
+    if(newDeadZone == _radialDeadzone)
+    {
+        return Execution::Unecessary;
+    }
+
+    if(newDeadZone < 0 || newDeadZone > JOYSTICK_MAX_RADIAL_DEADZONE)
+    {
+        return Execution::Failed;
+    }
+
+    _radialDeadzone = newDeadZone;
+    _PublishSettings();
+    return Execution::Passed;
+}
+/**
+ * @brief Gets the joystick's radial deadzone.
+ * Default value is 0.
+ * @param currentDeadZone
+ * Where it is placed.
+ * @return Execution 
+ */
+Execution cJoystick::GetRadialDeadZone(int* currentDeadZone)
+{
+    *currentDeadZone = _radialDeadzone;
+    return Execution::Passed;
+}
+
 /**
  * @brief Get the current X axis. The value is
  * updated when Update() is called.
@@ -363,16 +812,8 @@ Execution cJoystick::GetTrim_Y(int* currentTrim)
  */
 Execution cJoystick::GetCurrentAxis_X(int* currentAxis)
 {
-    if(_mode == 0)
-    {
-        *currentAxis = _xAxis;
-        return Execution::Passed;
-    }
-    else
-    {
-        *currentAxis = 0;
-        return Execution::Passed;
-    }
+    *currentAxis = _xAxis;
+    return Execution::Passed;
 }
 /**
  * @brief Get the current Y axis. The value is
@@ -385,16 +826,8 @@ Execution cJoystick::GetCurrentAxis_X(int* currentAxis)
  */
 Execution cJoystick::GetCurrentAxis_Y(int* currentAxis)
 {
-    if(_mode == 0)
-    {
-        *currentAxis = _yAxis;
-        return Execution::Passed;
-    }
-    else
-    {
-        *currentAxis = 0;
-        return Execution::Passed;
-    }
+    *currentAxis = _yAxis;
+    return Execution::Passed;
 }
 /**
  * @brief Get the current state of the joystick's
@@ -405,16 +838,8 @@ Execution cJoystick::GetCurrentAxis_Y(int* currentAxis)
  */
 Execution cJoystick::GetCurrentSwitch(bool* currentSwitchState)
 {
-    if(_mode == 0)
-    {
-        *currentSwitchState = _switch;
-        return Execution::Passed;
-    }
-    else
-    {
-        *currentSwitchState = false;
-        return Execution::Passed;
-    }
+    *currentSwitchState = _switch;
+    return Execution::Passed;
 }
 
 /**
@@ -452,37 +877,22 @@ Execution cJoystick::GetEverything(int* currentAxisX, int* currentAxisY, bool* c
 /**
  * @brief Time base function which needs to be
  * called at a constant interval in order to
- * update the joystick's values.
+ * update the joystick's values. The axes are
+ * taken from the ADC scanner's front scan, so
+ * swap it first. See InterfaceJoysticks.
+ * Settings set since the last call are
+ * applied first, so only the task calling
+ * Update ever touches the response tables.
  * @return Execution 
  */
 Execution cJoystick::Update()
 {
     if(built)
     {
-        if(_mode == 0)
-        {
-            _xAxis = analogRead(_analogXPin) - 2048;
-            _yAxis = analogRead(_analogYPin) - 2048;
-            _switch = digitalRead(_switchPin);
-
-            // Converting unsigned value to signed value to keep 0 as not moving
-            // _xAxis = (int)(xAxis - _JOY_MAX_VAL);
-            // _yAxis = (int)(yAxis - _JOY_MAX_VAL);
-
-            CalculateJoystickAxisDeadzone(&_xAxis, _xDeadzone);
-            CalculateJoystickAxisDeadzone(&_yAxis, _yDeadzone);
-
-            CalculateJoystickAxisTrim(&_xAxis, _xTrim);
-            CalculateJoystickAxisTrim(&_yAxis, _yTrim);
-            return Execution::Passed;
-        }
-        else
-        {
-            _xAxis = _JOY_MID_VAL;
-            _yAxis = _JOY_MID_VAL;
-            _switch = _JOY_MID_VAL;
-            return Execution::Passed;
-        }
+        _ApplySettings(false);
+        _xInput.scan = AdcScanner.GetScan();
+        _yInput.scan = _xInput.scan;
+        return (this->*_update)();
     }
     else
     {
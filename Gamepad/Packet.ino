@@ -136,15 +136,12 @@ Execution cPacket::VerifyID(unsigned short* packet, int packetSize)
         return Execution::Crashed;
     }
 
-    for(unsigned char currentID; currentID < _AMOUNT_OF_SUPPORTED_ID; currentID++)
+    if(BFIO_ID_TABLE[result] == BFIOFunction_None)
     {
-        if(supportedBFIOIDs[currentID] == result)
-        {
-            return Execution::Passed;
-        }
+        return Execution::Incompatibility;
     }
 
-    return Execution::Incompatibility;
+    return Execution::Passed;
 }
 /**
  * @brief Gets the amount of parameters inside
@@ -156,8 +153,6 @@ Execution cPacket::VerifyID(unsigned short* packet, int packetSize)
  */
 Execution cPacket::GetAmountOfParameters(unsigned short* packet, int packetSize, unsigned char* resultedParamCount)
 {
-    Execution execution;
-    int result = 0;
     unsigned char divisionCounter;
     divisionCounter = 0;
     *resultedParamCount = 0;
@@ -181,21 +176,19 @@ Execution cPacket::GetAmountOfParameters(unsigned short* packet, int packetSize,
     }
     else
     {
+        unsigned char invalidChunks = 0;
         for(int currentChunk = 0; currentChunk < packetSize; currentChunk++)
         {
-            result = 0;
-            execution = Chunk.ToType(packet[currentChunk], &result);
-            if(execution != Execution::Passed)
-            {
-                // An error occured while checking for Div chunks
-                Device.SetErrorMessage(DIV_COUNTING);
-                return Execution::Crashed;
-            }
-
-            if(result == ChunkType::Div)
-            {
-                divisionCounter++;
-            }
+            unsigned char chunkClass = cChunk::ClassOf(packet[currentChunk]);
+            invalidChunks |= (chunkClass == 0);
+            divisionCounter += (chunkClass == cChunk::ClassOf(ChunkType::Div));
+        }
+
+        if(invalidChunks)
+        {
+            // An error occured while checking for Div chunks
+            Device.SetErrorMessage(DIV_COUNTING);
+            return Execution::Crashed;
         }
 
         switch(divisionCounter)
@@ -232,8 +225,6 @@ Execution cPacket::GetAmountOfParameters(unsigned short* packet, int packetSize,
 Execution cPacket::GetParameterSegmentFromBytes(unsigned char* bytesToConvert, unsigned short* resultedSegment, int byteCount, int resultedSegmentSize)
 {
     Execution execution;
-    unsigned char result = 255;
-    unsigned short chunk = 0;
 
     if(resultedSegmentSize < (byteCount + 1))
     {
@@ -244,24 +235,12 @@ Execution cPacket::GetParameterSegmentFromBytes(unsigned char* bytesToConvert, u
     // Set first chunk as a div chunk
     resultedSegment[0] = ChunkType::Div;
 
-    for(int currentByte = 0; currentByte < resultedSegmentSize; currentByte++)
+    // If the buffer is oversized, the rest is left untouched.
+    execution = Chunk.ToChunks(bytesToConvert, byteCount, &resultedSegment[1], ChunkType::Byte);
+    if(execution != Execution::Passed)
     {
-        if(currentByte < byteCount)
-        {
-            unsigned char byte = bytesToConvert[currentByte];
-            execution = Chunk.ToChunk(byte, &chunk, ChunkType::Byte);
-            if(execution != Execution::Passed)
-            {
-                Device.SetErrorMessage(INTERNAL_CHUNK_CONVERTION_FAIL);
-                return Execution::Crashed;
-            }
-            resultedSegment[currentByte+1] = chunk;
-        }
-        else
-        {
-            // If the buffer is oversized, it will be filled with 0s.
-            // resultedSegment[currentByte+1] = 0;
-        }
+        Device.SetErrorMessage(INTERNAL_CHUNK_CONVERTION_FAIL);
+        return Execution::Crashed;
     }
 
     return Execution::Passed;
@@ -348,7 +327,6 @@ Execution cPacket::CreateFromSegments(unsigned char functionID, unsigned short*
     Execution execution;
     unsigned short chunkResult = 0;
     unsigned char checksum = functionID;
-    unsigned char byteOfChunk = 0;
     int type = 0;
     bool requiresDivChunk = false;
 
@@ -381,18 +359,19 @@ Execution cPacket::CreateFromSegments(unsigned char functionID, unsigned short*
     }
     resultedPacket[0] = chunkResult;
 
+    // Make sure every chunk is valid before copying them
+    unsigned char typeBitmap = 0;
+    execution = Chunk.ToTypes(paramSegments, sizeOfParamSegments, &typeBitmap);
+    if(execution != Execution::Passed)
+    {
+        Device.SetErrorMessage("370:Packet Chunk.ToTypes      ");
+        return Execution::Failed;
+    }
+
     // Calculate checksum and save chunks in resultedChunk
     for(int i=0; i<sizeOfParamSegments; i++)
     {
-        unsigned short currentChunk = paramSegments[i];
-        execution = Chunk.ToByte(currentChunk, &byteOfChunk);
-        if(execution != Execution::Passed)
-        {
-            Device.SetErrorMessage("370:Packet Chunk.ToByte       ");
-            return Execution::Failed;
-        }
-
-        checksum = checksum + byteOfChunk;
+        checksum = checksum + (unsigned char)paramSegments[i];
         resultedPacket[i+1] = paramSegments[i];
     }
 
@@ -455,32 +434,27 @@ Execution cPacket::GetBytesFromParameterSegment(unsigned short* paramSegment, in
         return Execution::Failed;      
     }
 
-    // - Convert to bytes - //
-    for(int index = 1; index < sizeOfParameterSegment; index++)
+    // - Only Byte chunks may follow - //
+    unsigned char typeBitmap = 0;
+    execution = Chunk.ToTypes(&paramSegment[1], sizeOfParameterSegment-1, &typeBitmap);
+    if(execution != Execution::Passed)
     {
-        unsigned char extractedByte = 0;
-        unsigned short currentChunk = paramSegment[index];
-        execution = Chunk.ToType(currentChunk, &resultedChunkType);
-        if(execution != Execution::Passed)
-        {
-            Device.SetErrorMessage("Packet:428 -> Chunk.ToType");
-            return Execution::Crashed;
-        }
-
-        if(resultedChunkType != ChunkType::Byte)
-        {
-            Device.SetErrorMessage("Packet:434");
-            return Execution::Failed;
-        }
+        Device.SetErrorMessage("Packet:445 -> Chunk.ToTypes");
+        return Execution::Crashed;
+    }
 
-        execution = Chunk.ToByte(currentChunk, &extractedByte);
-        if(execution != Execution::Passed)
-        {
-            Device.SetErrorMessage("Packet:442 -> Chunk.ToByte");
-            return Execution::Crashed;
-        }
+    if(typeBitmap != CHUNK_TYPE_BIT(ChunkType::Byte))
+    {
+        Device.SetErrorMessage("Packet:451");
+        return Execution::Failed;
+    }
 
-        resultedBytes[index-1] = extractedByte;
+    // - Convert to bytes - //
+    execution = Chunk.ToBytes(&paramSegment[1], sizeOfParameterSegment-1, resultedBytes);
+    if(execution != Execution::Passed)
+    {
+        Device.SetErrorMessage("Packet:459 -> Chunk.ToBytes");
+        return Execution::Crashed;
     }
 
     return Execution::Passed;
@@ -490,6 +464,11 @@ Execution cPacket::GetBytesFromParameterSegment(unsigned short* paramSegment, in
  * @brief Gets a specific segment from a
  * given packet/plane in bytes.
  * A segment is an array of unsigned char
+ * @attention
+ * This indexes the whole array each time it is
+ * called. If more than one segment is needed,
+ * use @ref IndexPlane once and the indexed
+ * GetBytes instead.
  * @param packet
  * An array of segment or parameter segment or validated packet to get an array of bytes from.
  * @param packetSize 
@@ -503,114 +482,55 @@ Execution cPacket::GetBytesFromParameterSegment(unsigned short* paramSegment, in
 Execution cPacket::GetBytes(unsigned short* packet, int packetSize, int segmentNumber, unsigned char* resultParameter, int sizeOfResultParameter)
 {
     Execution execution;
-    int extractedType = 0;
-    unsigned char extractedByte = 0;
-    unsigned char parameterSize = 0;
-    unsigned char currentParameter = 0;
-    int calculatedSizeOfParameter = 0;
-    bool CheckChunkFound = false;
-    bool StartChunkFound = false;
-    bool divChunkFound = false;
-    int indexAtWhichDivWasFound = 0;
+    cPlaneIndex planeIndex;
 
-    // if(sizeOfResultParameter < (packetSize-3)) // There is 3 useless passengers in there.
-    // {
-        // Device.SetErrorMessage("497:Packet Buffer too small   ");
-        // 
-        // return Execution::Failed;
-    // }
-
-    for (int index = 0; index < packetSize; index++)
+    execution = _IndexSegments(packet, packetSize, &planeIndex);
+    if(execution != Execution::Passed)
     {
-        unsigned short extractedChunk = packet[index];
+        return execution;
+    }
 
-        // - Check Type - //
-        execution = Chunk.ToType(extractedChunk, &extractedType);
-        if(execution != Execution::Passed)
-        {
-            Device.SetErrorMessage("503:Packet -> Chunk.ToType");
-            return Execution::Crashed;
-        }
+    return GetBytes(&planeIndex, packet, segmentNumber, resultParameter, sizeOfResultParameter);
+}
 
-        execution = Chunk.ToByte(extractedChunk, &extractedByte);
-        if(execution != Execution::Passed)
-        {
-            Device.SetErrorMessage("512:Packet -> Chunk.ToByte");
-            return Execution::Crashed;
-        }
+/**
+ * @brief Gets a specific segment's bytes using
+ * an index made by @ref IndexPlane. The segment
+ * is located without scanning the plane.
+ * @param planeIndex
+ * The index made from that plane.
+ * @param plane
+ * The plane that was indexed.
+ * @param segmentNumber
+ * Which segment to extract bytes from. STARTS AT 1.
+ * @param resultParameter
+ * Array of bytes where the parameter will be stored.
+ * @param sizeOfResultParameter
+ * How much space is available to store that array.
+ * @return Execution::Passed = Worked | Execution::Failed = No such segment | Execution::Crashed = Array too small
+ */
+Execution cPacket::GetBytes(cPlaneIndex* planeIndex, unsigned short* plane, int segmentNumber, unsigned char* resultParameter, int sizeOfResultParameter)
+{
+    if(segmentNumber < 1 || segmentNumber > planeIndex->parameterCount)
+    {
+        Device.SetErrorMessage("542:Packet -> Not Enough Param");
+        return Execution::Failed;
+    }
 
-        switch(extractedType)
-        {
-            case(ChunkType::Start):
-                if(!StartChunkFound)
-                {
-                    StartChunkFound = true;
-                }
-                else
-                {
-                    Device.SetErrorMessage("530:Packet -> Multiple Starts ");
-                    return Execution::Failed;
-                }
-                break;
-            case(ChunkType::Check):
-                if(!CheckChunkFound)
-                {
-                    CheckChunkFound = true;
-                }
-                else
-                {
-                    Device.SetErrorMessage("527:Packet -> Multiple Ends   ");
-                    return Execution::Crashed;
-                }
-                break;
-            case(ChunkType::Byte):
-                if(divChunkFound)
-                {
-                    // First byte
-                    divChunkFound = false;
-                }
+    int offset = planeIndex->segmentOffsets[segmentNumber-1];
+    int length = planeIndex->segmentLengths[segmentNumber-1];
 
-                if(currentParameter == segmentNumber)
-                {
-                    calculatedSizeOfParameter++;
-                    if(calculatedSizeOfParameter > sizeOfResultParameter)
-                    {
-                        Device.SetErrorMessage("539:Packet -> Param Too Big   ");
-                        Serial.println(calculatedSizeOfParameter);
-                        Device.SetStatus(Status::HardwareError);
-                        return Execution::Crashed;
-                    }
-                    else
-                    {
-                        resultParameter[index - indexAtWhichDivWasFound] = extractedByte;
-                    }
-                }
-                
-                break;
-            case(ChunkType::Div):
-                if(!divChunkFound)
-                {
-                    // found the start of a parameter!
-                    divChunkFound = true;
-                    currentParameter++;
-
-                    if(currentParameter == segmentNumber)
-                    {
-                        indexAtWhichDivWasFound = index+1;
-                    }
-                }
-                else
-                {
-                    Device.SetErrorMessage("555:Packet -> Consecutive Divs");
-                    return Execution::Crashed;
-                }
-                break;
-        }
+    if(length > sizeOfResultParameter)
+    {
+        Device.SetErrorMessage("551:Packet -> Param Too Big   ");
+        Device.SetStatus(Status::HardwareError);
+        return Execution::Crashed;
     }
-    if(segmentNumber > currentParameter)
+
+    // Chunks were already validated when the plane was indexed.
+    for(int index = 0; index < length; index++)
     {
-        Device.SetErrorMessage("569:Packet -> Not Enough Param");
-        return Execution::Failed;
+        resultParameter[index] = (unsigned char)(plane[offset + index] & 0x00FF);
     }
 
     return Execution::Passed;
@@ -633,168 +553,640 @@ Execution cPacket::GetBytes(unsigned short* packet, int packetSize, int segmentN
 Execution cPacket::FullyAnalyze(unsigned short* packetToAnalyze, int* resultedPacketsize, int* amountOfParameters, unsigned char* packetID)
 {
     Execution execution;
-    int extractedType = 0;
-    unsigned char extractedByte = 0;
-    unsigned char extractedCheckSum = 0;
-    unsigned char calculatedCheckSum = 0;
-    int calculatedParamCount = 0;
-    bool divChunkFound = false;
-    bool StartChunkFound = false;
-    bool CheckChunkFound = false;
-
-    #pragma region STEP_1 = Can we get the ID successfully?
-    execution = GetID(packetToAnalyze, 2, packetID);
+    cPlaneIndex planeIndex;
+
+    // The size of the plane is unknown. The index stops at its Check chunk.
+    execution = IndexPlane(packetToAnalyze, MAX_PLANE_PASSENGER_CAPACITY, &planeIndex);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("Packet:543 -> Packet.GetID    ");
-        return Execution::Crashed;
+        return execution;
     }
-    #pragma endregion
 
-    #pragma region STEP_2 = Is the second chunk a div chunk.
-    execution = Chunk.ToType(packetToAnalyze[1], &extractedType);
+    *packetID = planeIndex.planeID;
+    *resultedPacketsize = planeIndex.planeSize;
+    *amountOfParameters = planeIndex.parameterCount;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Validates a plane in a single pass
+ * and records where each of its segments are.
+ * @param plane
+ * The plane to index. Scanning stops at its Check chunk.
+ * @param planeSize
+ * How many chunks can be read from plane at most.
+ * @param resultedIndex
+ * Where the segment table and plane informations are placed.
+ * @param check
+ * What the Check chunk carries.
+ * @return Execution::Passed = Valid plane | Execution::Failed = Invalid structure or checksum | Execution::Incompatibility = Not in BFIO ids | Execution::Crashed = Corrupted chunks
+ */
+Execution cPacket::IndexPlane(unsigned short* plane, int planeSize, cPlaneIndex* resultedIndex, PlaneCheck check)
+{
+    Execution execution;
+    int firstType = 0;
+
+    if(planeSize < 2)
+    {
+        Device.SetErrorMessage("615:Packet -> Plane too small ");
+        return Execution::Failed;
+    }
+
+    #pragma region STEP_1 = Does the plane start with a Start chunk
+    execution = Chunk.ToType(plane[0], &firstType);
     if(execution != Execution::Passed)
     {
-        TestFailed("553:Packet -> Chunk.ToType    ");
+        Device.SetErrorMessage("623:Packet -> Chunk.ToType    ");
         return Execution::Crashed;
     }
 
-    if(extractedType != ChunkType::Div && extractedType != ChunkType::Check)
+    if(firstType != ChunkType::Start)
     {
-        Device.SetErrorMessage("559:Packet -> Incorrect Chunk.");
+        Device.SetErrorMessage("629:Packet -> No Start chunk  ");
         return Execution::Failed;
     }
     #pragma endregion
 
-    #pragma region STEP_3 = Is the ID valid
-    execution = VerifyID(packetToAnalyze, 2);
+    #pragma region STEP_2 = Index every segment until the Check chunk
+    execution = _IndexSegments(plane, planeSize, resultedIndex);
     if(execution != Execution::Passed)
     {
-        if(execution == Execution::Incompatibility)
-        {
-            Device.SetErrorMessage("572:Packet: Unsupported Plane.");
-            Device.SetStatus(Status::CompatibilityError);
-            return Execution::Incompatibility;
-        }
+        return execution;
+    }
 
-        Device.SetErrorMessage("569:Packet -> Packet.VerifyID");
+    if(!resultedIndex->checkFound)
+    {
+        Device.SetErrorMessage("643:Packet -> Corrupted Plane.");
         return Execution::Crashed;
     }
+
+    if(resultedIndex->planeSize > MAX_PLANE_PASSENGER_CAPACITY)
+    {
+        Device.SetErrorMessage("625:Packet -> Plane too big   ");
+        return Execution::Failed;
+    }
     #pragma endregion
 
-    #pragma region STEP_4 = If plane is empty, get checksum, compare and return immediately.
-    if(extractedType == ChunkType::Check)
+    #pragma region STEP_3 = Are the segments valid
+    if(resultedIndex->freeByteCount != 0)
+    {
+        Device.SetErrorMessage(FREE_BYTES_IN_PACKET);
+        return Execution::Failed;
+    }
+
+    if(resultedIndex->parameterCount != 0 && resultedIndex->segmentLengths[resultedIndex->parameterCount-1] == 0)
     {
-        *resultedPacketsize = 2;
-        *amountOfParameters = 0;
+        Device.SetErrorMessage("657:Packet -> Empty parameter ");
+        return Execution::Failed;
+    }
+    #pragma endregion
 
+    #pragma region STEP_4 = Does the checksum match
+    unsigned char expectedCheck = resultedIndex->calculatedCheckSum;
+    if(check == PlaneCheck::CRC8)
+    {
+        // Only paid for in CRC8 mode, the sum comes free with the segment pass.
+        GetCRC8(plane, resultedIndex->planeSize - 1, &expectedCheck);
+    }
 
-        execution = Chunk.ToByte(packetToAnalyze[1], &extractedCheckSum);
-        if(execution != Execution::Passed)
-        {
-            Device.SetErrorMessage("575:Packet -> Chunk.ToByte");
-            return Execution::Crashed;
-        }
+    if(expectedCheck != resultedIndex->receivedCheckSum)
+    {
+        Device.SetErrorMessage("665:Packet -> Invalid checksum");
+        return Execution::Failed;
+    }
+    #pragma endregion
 
-        if(extractedCheckSum != *packetID)
+    #pragma region STEP_5 = Is the ID valid
+    execution = VerifyID(plane, resultedIndex->planeSize);
+    if(execution != Execution::Passed)
+    {
+        if(execution == Execution::Incompatibility)
         {
-            Device.SetErrorMessage("581:Packet -> Checksm mismatch");
-            return Execution::Failed;
+            Device.SetErrorMessage("676:Packet: Unsupported Plane.");
+            Device.SetStatus(Status::CompatibilityError);
+            return Execution::Incompatibility;
         }
 
-        return Execution::Passed;
+        Device.SetErrorMessage("681:Packet -> Packet.VerifyID");
+        return Execution::Crashed;
     }
     #pragma endregion
 
-    #pragma region STEP_5 = Calculate checksum, check div segments until checkChunk is found.
-    for (int index = 0; index < MAX_PLANE_PASSENGER_CAPACITY; index++)
+    return Execution::Passed;
+}
+
+/**
+ * @brief CRC-8 carried by the Check chunk of
+ * a plane in PlaneCheck::CRC8 mode. Covers
+ * the Start chunk and every chunk up to the
+ * Check chunk. Unlike the sum, swapped bytes
+ * and moved Div chunks change it.
+ * @param chunks
+ * The plane, from its Start chunk.
+ * @param count
+ * Amount of chunks before the Check chunk.
+ * @param resultedCRC
+ * Where the CRC is placed.
+ * @return Execution::Passed
+ */
+Execution cPacket::GetCRC8(unsigned short* chunks, int count, unsigned char* resultedCRC)
+{
+    unsigned char crc = 0;
+    for(int index = 0; index < count; index++)
+    {
+        crc = UpdateCRC8(crc, chunks[index]);
+    }
+    *resultedCRC = crc;
+    return Execution::Passed;
+}
+
+/**
+ * @brief The single pass used by IndexPlane and
+ * GetBytes. Every chunk's type and byte is
+ * read once. The checksum is calculated on the
+ * way and each Div chunk opens a new entry in
+ * the segment table.
+ * @param chunks
+ * Plane, or array of segments, to index.
+ * @param chunkCount
+ * How many chunks can be read at most. Stops early at a Check chunk.
+ * @param resultedIndex
+ * Where the results are placed.
+ * @return Execution::Passed = Indexed | Execution::Failed = Invalid structure | Execution::Crashed = Corrupted chunks
+ */
+Execution cPacket::_IndexSegments(unsigned short* chunks, int chunkCount, cPlaneIndex* resultedIndex)
+{
+    int extractedType = 0;
+    unsigned char extractedByte = 0;
+    bool previousWasDiv = false;
+
+    resultedIndex->planeID = 0;
+    resultedIndex->planeSize = 0;
+    resultedIndex->parameterCount = 0;
+    resultedIndex->calculatedCheckSum = 0;
+    resultedIndex->receivedCheckSum = 0;
+    resultedIndex->startFound = false;
+    resultedIndex->checkFound = false;
+    resultedIndex->freeByteCount = 0;
+
+    for(int index = 0; index < chunkCount; index++)
     {
-        unsigned short UNSAFE_extractedChunk = packetToAnalyze[index];
+        unsigned short extractedChunk = chunks[index];
 
         // - Check Type - //
-        execution = Chunk.ToType(UNSAFE_extractedChunk, &extractedType);
-        if(execution != Execution::Passed)
+        unsigned char chunkClass = cChunk::ClassOf(extractedChunk);
+        if(chunkClass == 0)
         {
-            Device.SetErrorMessage("618:Packet -> Chunk.ToType");
+            Device.SetErrorMessage("709:Packet -> Chunk.ClassOf");
             return Execution::Crashed;
         }
+        extractedType = (chunkClass - 1) << 8;
 
         // - Extract byte - //
-        execution = Chunk.ToByte(UNSAFE_extractedChunk, &extractedByte);
-        if(execution != Execution::Passed)
-        {
-            Device.SetErrorMessage("674:Packet -> Chunk.ToByte");
-            return Execution::Crashed;
-        }
+        extractedByte = (unsigned char)extractedChunk;
 
         switch(extractedType)
         {
             case(ChunkType::Start):
-                if(!StartChunkFound)
-                {
-                    StartChunkFound = true;
-                    *packetID = extractedByte;
-                }
-                else
+                if(resultedIndex->startFound)
                 {
-                    Device.SetErrorMessage("631:Packet -> Multiple Starts ");
+                    Device.SetErrorMessage("750:Packet -> Multiple Starts ");
                     return Execution::Failed;
                 }
+                resultedIndex->startFound = true;
+                resultedIndex->planeID = extractedByte;
                 break;
+
             case(ChunkType::Check):
-                if(!CheckChunkFound)
-                {
-                    CheckChunkFound = true;
-                    extractedCheckSum = extractedByte;
-                    *amountOfParameters = calculatedParamCount;
-                    *resultedPacketsize = index+1;
-
-                    if(calculatedCheckSum != extractedCheckSum)
-                    {
-                        Device.SetErrorMessage("655:Packet -> Invalid checksum");
-                        return Execution::Failed;
-                    }
-                    else
-                    {
-                        // YOUPIIIII
-                        return Execution::Passed;
-                    }
-                }
-                else
+                // End of the plane. Whatever comes after is not part of it.
+                resultedIndex->checkFound = true;
+                resultedIndex->receivedCheckSum = extractedByte;
+                resultedIndex->planeSize = index + 1;
+                return Execution::Passed;
+
+            case(ChunkType::Div):
+                if(previousWasDiv)
                 {
-                    Device.SetErrorMessage("643:Packet -> Multiple Ends   ");
+                    Device.SetErrorMessage("767:Packet -> Consecutive Divs");
                     return Execution::Crashed;
                 }
-                break;
-            case(ChunkType::Byte):
-                if(divChunkFound)
+
+                if(resultedIndex->parameterCount >= MAX_PLANE_PARAMETER_COUNT)
                 {
-                    // First byte
-                    divChunkFound = false;
+                    Device.SetErrorMessage("773:Packet -> Too many params ");
+                    return Execution::Failed;
                 }
+
+                resultedIndex->segmentOffsets[resultedIndex->parameterCount] = (unsigned short)(index + 1);
+                resultedIndex->segmentLengths[resultedIndex->parameterCount] = 0;
+                resultedIndex->parameterCount++;
                 break;
-            case(ChunkType::Div):
-                if(!divChunkFound)
+
+            case(ChunkType::Byte):
+                if(resultedIndex->parameterCount == 0)
                 {
-                    // found the start of a parameter!
-                    divChunkFound = true;
-                    calculatedParamCount++;
+                    resultedIndex->freeByteCount++;
                 }
                 else
                 {
-                    Device.SetErrorMessage("664:Packet -> Consecutive Divs");
-                    return Execution::Crashed;
+                    resultedIndex->segmentLengths[resultedIndex->parameterCount-1]++;
                 }
                 break;
         }
-    
+
+        previousWasDiv = (extractedType == ChunkType::Div);
+
         // - calculate checksum - //
-        calculatedCheckSum = calculatedCheckSum + extractedByte;
+        resultedIndex->calculatedCheckSum = resultedIndex->calculatedCheckSum + extractedByte;
     }
-    #pragma endregion
 
-    // Hum... well that isnt good...
-    Device.SetErrorMessage("697:Packet -> Corrupted Plane.");
-    return Execution::Crashed;
+    resultedIndex->planeSize = chunkCount;
+    return Execution::Passed;
+}
+////////////////////////////////////////////////////////////
+/// @brief Construct an empty view. Size() is 0.
+cSegmentView::cSegmentView()
+{
+}
+
+/**
+ * @brief Construct a view over Byte chunks
+ * that were already validated.
+ * @param chunks
+ * First Byte chunk of the segment.
+ * @param size
+ * How many Byte chunks the segment holds.
+ */
+cSegmentView::cSegmentView(unsigned short* chunks, int size)
+{
+    _chunks = chunks;
+    _size = size;
+}
+
+/// @brief How many bytes the segment holds.
+int cSegmentView::Size()
+{
+    return _size;
+}
+
+/**
+ * @brief Assembles byteCount bytes, little endian,
+ * into one value. This is the byte order cData
+ * uses for every type.
+ */
+unsigned long long cSegmentView::_ReadLittleEndian(int byteCount)
+{
+    unsigned long long result = 0;
+    for(int index = 0; index < byteCount; index++)
+    {
+        result = result | ((unsigned long long)(_chunks[index] & 0x00FF) << (8*index));
+    }
+    return result;
+}
+
+/**
+ * @brief Get a single byte of the segment.
+ * @param index
+ * Which byte. STARTS AT 0.
+ * @param resultedByte
+ * Where the byte will be placed.
+ * @return Execution::Passed = Worked | Execution::Failed = Index outside of the segment
+ */
+Execution cSegmentView::GetByte(int index, unsigned char* resultedByte)
+{
+    if(index < 0 || index >= _size)
+    {
+        return Execution::Failed;
+    }
+
+    *resultedByte = (unsigned char)(_chunks[index] & 0x00FF);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(bool* value)
+{
+    if(_size < 1) return Execution::Failed;
+    *value = (bool)(_chunks[0] & 0x00FF);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(unsigned char* value)
+{
+    if(_size < 1) return Execution::Failed;
+    *value = (unsigned char)_ReadLittleEndian(1);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(char* value)
+{
+    if(_size < 1) return Execution::Failed;
+    *value = (char)_ReadLittleEndian(1);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(unsigned short* value)
+{
+    if(_size < 2) return Execution::Failed;
+    *value = (unsigned short)_ReadLittleEndian(2);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(short* value)
+{
+    if(_size < 2) return Execution::Failed;
+    *value = (short)_ReadLittleEndian(2);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(unsigned int* value)
+{
+    if(_size < 4) return Execution::Failed;
+    *value = (unsigned int)_ReadLittleEndian(4);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(int* value)
+{
+    if(_size < 4) return Execution::Failed;
+    *value = (int)_ReadLittleEndian(4);
+    return Execution::Passed;
+}
+
+/// @attention Like cData, (unsigned) longs always travel as 8 bytes.
+Execution cSegmentView::ToData(unsigned long* value)
+{
+    if(_size < 8) return Execution::Failed;
+    *value = (unsigned long)_ReadLittleEndian(8);
+    return Execution::Passed;
+}
+
+/// @attention Like cData, (unsigned) longs always travel as 8 bytes.
+Execution cSegmentView::ToData(long* value)
+{
+    if(_size < 8) return Execution::Failed;
+    *value = (long)(long long)_ReadLittleEndian(8);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(unsigned long long* value)
+{
+    if(_size < 8) return Execution::Failed;
+    *value = _ReadLittleEndian(8);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(long long* value)
+{
+    if(_size < 8) return Execution::Failed;
+    *value = (long long)_ReadLittleEndian(8);
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(float* value)
+{
+    if(_size < (int)sizeof(float)) return Execution::Failed;
+    unsigned int bits = (unsigned int)_ReadLittleEndian(sizeof(float));
+    memcpy(value, &bits, sizeof(float));
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(double* value)
+{
+    if(_size < 8) return Execution::Failed;
+    unsigned long long bits = _ReadLittleEndian(8);
+    memcpy(value, &bits, sizeof(double));
+    return Execution::Passed;
+}
+
+Execution cSegmentView::ToData(std::string& value)
+{
+    value.clear();
+    value.reserve(_size);
+    for(int index = 0; index < _size; index++)
+    {
+        value += static_cast<char>(_chunks[index] & 0x00FF);
+    }
+    return Execution::Passed;
+}
+////////////////////////////////////////////////////////////
+/// @brief Construct a closed view.
+cPacketView::cPacketView()
+{
+}
+
+/**
+ * @brief Validates and indexes a plane.
+ * See @ref cPacket::IndexPlane.
+ * @param plane
+ * The plane to look at. It is not copied.
+ * @param planeSize
+ * How many chunks can be read from plane at most.
+ * @param check
+ * What the Check chunk carries.
+ * @return Execution Same values as cPacket::IndexPlane.
+ */
+Execution cPacketView::Open(unsigned short* plane, int planeSize, PlaneCheck check)
+{
+    Execution execution;
+
+    built = false;
+    execution = Packet.IndexPlane(plane, planeSize, &_index, check);
+    if(execution != Execution::Passed)
+    {
+        return execution;
+    }
+
+    _plane = plane;
+    built = true;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Opens a plane that was already
+ * validated and indexed, like the planes
+ * a cTerminal hands out. Nothing is scanned.
+ * @param plane
+ * The plane to look at. It is not copied.
+ * @param planeIndex
+ * Its index. It is copied.
+ * @return Execution::Passed = Opened | Execution::Failed = Index is not of a whole plane
+ */
+Execution cPacketView::Open(unsigned short* plane, cPlaneIndex* planeIndex)
+{
+    built = false;
+    if(!planeIndex->startFound || !planeIndex->checkFound)
+    {
+        return Execution::Failed;
+    }
+
+    _index = *planeIndex;
+    _plane = plane;
+    built = true;
+    return Execution::Passed;
+}
+
+/// @brief The ID of the opened plane.
+unsigned char cPacketView::GetID()
+{
+    return _index.planeID;
+}
+
+/// @brief Total amount of chunks of the opened plane.
+int cPacketView::GetSize()
+{
+    return _index.planeSize;
+}
+
+/// @brief How many parameter segments the opened plane has.
+int cPacketView::GetParameterCount()
+{
+    return _index.parameterCount;
+}
+
+/**
+ * @brief Get a view over one of the plane's segments.
+ * @param segmentNumber
+ * Which segment. STARTS AT 1.
+ * @param resultedSegment
+ * Where the segment's view will be placed.
+ * @return Execution::Passed = Worked | Execution::Failed = No such segment | Execution::Crashed = View is not opened
+ */
+Execution cPacketView::GetSegment(int segmentNumber, cSegmentView* resultedSegment)
+{
+    if(!built)
+    {
+        return Execution::Crashed;
+    }
+
+    if(segmentNumber < 1 || segmentNumber > _index.parameterCount)
+    {
+        return Execution::Failed;
+    }
+
+    *resultedSegment = cSegmentView(&_plane[_index.segmentOffsets[segmentNumber-1]], _index.segmentLengths[segmentNumber-1]);
+    return Execution::Passed;
+}
+////////////////////////////////////////////////////////////
+/// @brief Construct an idle builder.
+cPacketBuilder::cPacketBuilder()
+{
+}
+
+/**
+ * @brief Starts a new plane in the given buffer.
+ * Writes its Start chunk.
+ * @param functionID
+ * ID given to the plane's Start chunk.
+ * @param resultedPlane
+ * Buffer the plane is built into.
+ * @param sizeOfResultedPlane
+ * How many chunks that buffer can hold. See PLANE_SIZE.
+ * @return Execution::Passed = Started | Execution::Failed = Buffer cannot even hold Start and Check
+ */
+Execution cPacketBuilder::Begin(unsigned char functionID, unsigned short* resultedPlane, int sizeOfResultedPlane)
+{
+    built = false;
+
+    if(sizeOfResultedPlane < PLANE_SIZE(0, 0) || sizeOfResultedPlane > MAX_PLANE_PASSENGER_CAPACITY)
+    {
+        Device.SetErrorMessage(INTERNAL_BUFFER_SIZE_ERROR);
+        return Execution::Failed;
+    }
+
+    _plane = resultedPlane;
+    _capacity = sizeOfResultedPlane;
+    _checkSum = functionID;
+    _plane[0] = ChunkType::Start + functionID;
+    _size = 1;
+
+    built = true;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Adds a Div chunk followed by one
+ * Byte chunk per given byte.
+ * @param bytes
+ * Bytes of the parameter, usually from cData::ToBytes.
+ * @param byteCount
+ * How many bytes the parameter has. Must be at least 1.
+ * @return Execution::Passed = Added | Execution::Failed = Would not leave room for the Check chunk | Execution::Crashed = Begin was not called
+ */
+Execution cPacketBuilder::AddSegment(unsigned char* bytes, int byteCount)
+{
+    if(!built)
+    {
+        Device.SetErrorMessage(INTERNAL_PACKET_BUILDING_FAIL);
+        return Execution::Crashed;
+    }
+
+    // Div + bytes, and one chunk must stay free for the Check chunk.
+    if(byteCount < 1 || (_size + byteCount + 2) > _capacity)
+    {
+        Device.SetErrorMessage(INTERNAL_BUFFER_SIZE_ERROR);
+        return Execution::Failed;
+    }
+
+    unsigned short* cursor = &_plane[_size];
+    *cursor++ = ChunkType::Div;
+    for(int index = 0; index < byteCount; index++)
+    {
+        cursor[index] = bytes[index];
+        _checkSum += bytes[index];
+    }
+
+    _size += byteCount + 1;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Writes the Check chunk. The plane is
+ * then ready for take off.
+ * @param resultedPlaneSize
+ * Where the final amount of chunks will be placed.
+ * @param check
+ * What the Check chunk carries.
+ * @return Execution::Passed = Finished | Execution::Crashed = Begin was not called
+ */
+Execution cPacketBuilder::Finish(int* resultedPlaneSize, PlaneCheck check)
+{
+    if(!built)
+    {
+        Device.SetErrorMessage(INTERNAL_PACKET_BUILDING_FAIL);
+        return Execution::Crashed;
+    }
+
+    if(check == PlaneCheck::CRC8)
+    {
+        Packet.GetCRC8(_plane, _size, &_checkSum);
+    }
+    _plane[_size++] = ChunkType::Check + _checkSum;
+    *resultedPlaneSize = _size;
+    built = false;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Drops the plane being built, so a
+ * plane missing segments is never finished.
+ * Finish fails until the next Begin.
+ * @return Execution::Passed = Dropped | Execution::Unecessary = Nothing was being built
+ */
+Execution cPacketBuilder::Abort()
+{
+    if(!built)
+    {
+        return Execution::Unecessary;
+    }
+
+    _size = 0;
+    built = false;
+    return Execution::Passed;
+}
+
+/// @brief Amount of chunks written so far.
+int cPacketBuilder::GetSize()
+{
+    return _size;
 }
 #pragma endregion
\ No newline at end of file
@@ -0,0 +1,194 @@
+/**
+ * @file Scheduler.h
+ * @author Lyam (Lyam.brs@gmail.com)
+ * @brief This file contains the cooperative
+ * scheduler class. Each task runs at its own
+ * fixed rate, or when signaled, and the time
+ * it takes is measured against its budget.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef SCHEDULER_H
+  #define SCHEDULER_H
+//=============================================//
+//	Include
+//=============================================//
+#include "Globals.h"
+
+/// @brief Most tasks the scheduler can run. One per interface is enough.
+#define MAX_SCHEDULED_TASKS 8
+
+/// @brief Period of a task that only runs when signaled. See cScheduler::Signal.
+#define EVENT_DRIVEN_TASK 0
+
+/// @brief Budget of a task that can take as long as it wants.
+#define NO_TASK_BUDGET 0
+
+/// @brief What a task runs. Tasks are cooperative: they must return quickly.
+typedef void (*TaskCallback)();
+
+/// @brief Where the scheduler gets the time, in microseconds. micros() unless told otherwise.
+typedef unsigned long (*SchedulerClock)();
+
+/**
+ * @brief One task of the scheduler and what
+ * was measured on it. Times are in
+ * microseconds.
+ */
+struct cTask
+{
+    TaskCallback callback = nullptr;
+    /// @brief Time between 2 runs. EVENT_DRIVEN_TASK if it only runs when signaled.
+    unsigned long period = 0;
+    /// @brief Time a run should take at most. NO_TASK_BUDGET if unlimited.
+    unsigned long budget = 0;
+    /// @brief Clock value at which it is due next. For event driven tasks, when it was signaled.
+    unsigned long nextRunAt = 0;
+    /// @brief Event driven tasks only. Set by Signal until it ran.
+    bool signaled = false;
+
+    /// @brief Amount of times it ran.
+    unsigned long runs = 0;
+    /// @brief Time its last run took.
+    unsigned long lastRuntime = 0;
+    /// @brief Longest time a run took.
+    unsigned long longestRuntime = 0;
+    /// @brief Sum of the time its runs took.
+    unsigned long long totalRuntime = 0;
+    /// @brief How late its last run started, after the last period boundary or after being signaled.
+    unsigned long lastJitter = 0;
+    /// @brief Latest a run started.
+    unsigned long worstJitter = 0;
+    /// @brief Amount of runs that took longer than its budget.
+    unsigned long overruns = 0;
+    /// @brief Amount of periods that went by without it running.
+    unsigned long skippedPeriods = 0;
+};
+
+/**
+ * @brief Class that runs the application's
+ * tasks cooperatively, from the loop.
+ * Periodic tasks keep a fixed rate: a late
+ * run does not push the next ones back. Tasks
+ * run in the order they were added, so the
+ * first ones have priority when several are due.
+ * Times survive the clock wrapping around.
+ */
+class cScheduler
+ {
+    private:
+        /// @brief The tasks, in the order they were added. Their index is their ID.
+        cTask _tasks[MAX_SCHEDULED_TASKS];
+
+        /// @brief Amount of tasks in _tasks.
+        int _taskCount = 0;
+
+        /// @brief Where the time comes from.
+        SchedulerClock _clock = nullptr;
+
+        /// @brief true if time a is before time b, even across a clock wrap.
+        static bool _IsBefore(unsigned long a, unsigned long b) { return (long)(a - b) < 0; }
+
+        /// @brief micros() as a SchedulerClock.
+        static unsigned long _Micros() { return micros(); }
+
+        /**
+         * @brief Runs a task and measures it.
+         * @param task
+         * The task.
+         * @param dueAt
+         * When it should have started.
+         */
+        void _Run(cTask* task, unsigned long dueAt);
+
+    public:
+        /// @brief set to true if the class is constructed.
+        bool built = false;
+
+        //////////////////////////////////////////////
+        cScheduler();
+        /**
+         * @brief Scheduler running on another
+         * clock than micros(). Used by the unit
+         * tests to control time.
+         * @param clock
+         * Gives the time, in microseconds.
+         */
+        cScheduler(SchedulerClock clock);
+        //////////////////////////////////////////////
+
+        /**
+         * @brief Time base function executed in
+         * the loop. Runs every task that is due
+         * and every task that was signaled.
+         * @return Execution::Passed = At least one task ran | Execution::Bypassed = Nothing was due | Execution::Unecessary = No tasks
+         */
+        Execution _Handle();
+
+        /**
+         * @brief Adds a task. Its ID is the amount
+         * of tasks added before it. Periodic tasks
+         * are due right away, then every period.
+         * @param callback
+         * What the task runs.
+         * @param period
+         * Microseconds between 2 runs. EVENT_DRIVEN_TASK to only run when signaled.
+         * @param budget
+         * Microseconds a run should take at most. NO_TASK_BUDGET if unlimited.
+         * @return Execution::Passed = Task added | Execution::Failed = Scheduler full or no callback
+         */
+        Execution AddTask(TaskCallback callback, unsigned long period, unsigned long budget);
+
+        /**
+         * @brief Has an event driven task run on
+         * the next _Handle. Signaling it again
+         * before it ran does nothing.
+         * @attention
+         * Call it from the loop, not from an ISR.
+         * @param taskID
+         * ID of the task.
+         * @return Execution::Passed = Signaled | Execution::Unecessary = Already signaled | Execution::Failed = No such event driven task
+         */
+        Execution Signal(int taskID);
+
+        /**
+         * @brief Get how long until a task is due.
+         * The loop can idle that long.
+         * @param microsecondsLeft
+         * Where the time is placed. 0 if a task is already due.
+         * @return Execution::Passed = Time placed | Execution::Unecessary = Nothing periodic nor signaled
+         */
+        Execution GetTimeUntilNextTask(unsigned long* microsecondsLeft);
+
+        /**
+         * @brief Get a copy of a task and of what
+         * was measured on it.
+         * @param taskID
+         * ID of the task.
+         * @param resultedTask
+         * Where the copy is placed.
+         * @return Execution::Passed = Copied | Execution::Failed = No such task
+         */
+        Execution GetTask(int taskID, cTask* resultedTask);
+
+        /// @brief Clears what was measured on every task. Their schedule is kept.
+        Execution ResetStatistics();
+
+        /// @brief Amount of tasks added.
+        int GetTaskCount();
+ };
+
+#endif
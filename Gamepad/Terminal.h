@@ -28,8 +28,102 @@
 //=============================================//
 #include "Globals.h"
 
-#define SIZE_OF_DEPARTURE_TAXIWAY 20
+/// @brief Planes each taxiway lane holds. Must be a power of 2.
+#define SIZE_OF_DEPARTURE_TAXIWAY 32
+static_assert((SIZE_OF_DEPARTURE_TAXIWAY & (SIZE_OF_DEPARTURE_TAXIWAY - 1)) == 0, "SIZE_OF_DEPARTURE_TAXIWAY must be a power of 2");
 #define SIZE_OF_ARRIVAL_PLANE 100
+/// @brief Sequence tag of a plane that was sent without one.
+#define NO_SEQUENCE_TAG -1
+
+/**
+ * @brief Called with each parameter segment of
+ * a plane as soon as the chunk after its last
+ * Byte chunk lands, while the rest of the plane
+ * is still landing. The plane's check is not
+ * verified yet: only stage what is decoded.
+ * @param gate
+ * The gate given to SetCutThroughGate.
+ * @param planeID
+ * ID of the landing plane.
+ * @param segmentNumber
+ * Which segment. STARTS AT 1.
+ * @param segment
+ * The segment's bytes. Only valid during the call.
+ * @return Execution::Failed drops the plane. Anything else keeps it landing.
+ */
+typedef Execution (*SegmentArrivalCallback)(void* gate, unsigned char planeID, int segmentNumber, cSegmentView* segment);
+
+/**
+ * @brief Called once a plane whose segments
+ * were given to a SegmentArrivalCallback is
+ * done landing.
+ * @param gate
+ * The gate given to SetCutThroughGate.
+ * @param planeID
+ * ID of the plane.
+ * @param landed
+ * true = Check verified, commit what was staged.
+ * false = Plane dropped, throw it away.
+ */
+typedef void (*PlaneLandingCallback)(void* gate, unsigned char planeID, bool landed);
+
+/**
+ * @brief A gate that takes the passengers of
+ * its planes while they are still landing.
+ * See cTerminal::SetCutThroughGate.
+ */
+struct cCutThroughGate
+{
+    void* gate = nullptr;
+    SegmentArrivalCallback onSegment = nullptr;
+    PlaneLandingCallback onLanding = nullptr;
+};
+
+/**
+ * @brief Called with a plane that just landed
+ * and whose check was verified. This is where
+ * a gate's _Dock...PlaneArrival is called.
+ * @param gate
+ * The gate given to SetDockingGate.
+ * @param planeID
+ * ID of the plane.
+ * @param plane
+ * The plane, straight on the arrival runway. Its Check chunk carries the additive sum.
+ * @param planeSize
+ * Amount of chunks. The sequence tag is already removed.
+ * @param sequenceTag
+ * Tag the plane carried. NO_SEQUENCE_TAG if untagged.
+ * @return What the gate's dock method returned.
+ */
+typedef Execution (*PlaneDockingCallback)(void* gate, unsigned char planeID, unsigned short* plane, int planeSize, int sequenceTag);
+
+/**
+ * @brief Called when a plane that taxied with
+ * that ID is about to take off. This is where
+ * a gate's _GetDeparting...Plane is called.
+ * @param gate
+ * The gate given to SetDockingGate.
+ * @param departingPlane
+ * Where the plane is built.
+ * @param planeSize
+ * Where its amount of chunks is placed.
+ * @param sequenceTag
+ * Tag the terminal adds once the plane is built. NO_SEQUENCE_TAG if untagged.
+ * Answers replace it with the tag of the request they answer.
+ * @return What the gate returned.
+ */
+typedef Execution (*PlaneBoardingCallback)(void* gate, unsigned short* departingPlane, int* planeSize, int* sequenceTag);
+
+/**
+ * @brief A gate planes of one ID are routed to.
+ * See cTerminal::SetDockingGate.
+ */
+struct cDockingGate
+{
+    void* gate = nullptr;
+    PlaneDockingCallback onArrival = nullptr;
+    PlaneBoardingCallback onDeparture = nullptr;
+};
 
 
 /**
@@ -40,20 +134,43 @@ class cTerminal
  {       
     private:
         /**
-         * @brief Private variable that stores
-         * the current count of the checksum ever
-         * since the start packet was received.
-         * 
-         * Used in the final comparaison for packet
-         * integrity.
+         * @brief The 2 arrival runways. A plane lands
+         * on one while the last plane that landed
+         * waits on the other. They swap each time a
+         * plane lands, so nothing is ever copied.
          */
-        unsigned short _ArrivalIDBuffer[SIZE_OF_ARRIVAL_PLANE];
+        unsigned short _ArrivalIDBuffer[2][SIZE_OF_ARRIVAL_PLANE];
+
+        /// @brief Segment table of each arrival runway, filled as chunks land.
+        cPlaneIndex _arrivalIndexes[2];
+
+        /// @brief Arrival runway the next chunks land on. The other one holds the last plane that landed.
+        unsigned char _landingRunway = 0;
+
+        /// @brief Amount of chunks that landed so far on _landingRunway.
+        int _landingSize = 0;
+
+        /// @brief Set when the last chunk that landed was a Div chunk.
+        bool _previousWasDiv = false;
 
         /**
-         * @brief list of the function's ID
-         * that needs to be sent in order of newest to most urgent.
+         * @brief Ring buffer of the function IDs
+         * waiting to depart, one per lane. Planes
+         * leave in the order they were queued.
          */
-        unsigned char _DepartureIDBuffer[SIZE_OF_DEPARTURE_TAXIWAY];
+        unsigned char _DepartureIDBuffer[TaxiwayLaneCount][SIZE_OF_DEPARTURE_TAXIWAY];
+
+        /// @brief micros() at which each plane of _DepartureIDBuffer started taxiing.
+        unsigned long _taxiingSince[TaxiwayLaneCount][SIZE_OF_DEPARTURE_TAXIWAY];
+
+        /// @brief Index of the oldest plane of each lane.
+        unsigned char _taxiwayHeads[TaxiwayLaneCount] = {0};
+
+        /// @brief Amount of planes in each lane.
+        unsigned char _taxiwaySizes[TaxiwayLaneCount] = {0};
+
+        /// @brief 1 bit per function ID, set while that plane is on the taxiway.
+        unsigned long _taxiingPlanes[256 / 32] = {0};
 
         /**
          * @brief The current mode.
@@ -62,29 +179,120 @@ class cTerminal
          */
         unsigned char _currentMode = 0;
 
-        /**
-         * @brief 
-         * Checksum currently being calculated
-         * as the plane is landing on the arrival
-         * runway.
-         */
-        unsigned char _calculatedChecksum = 0;
+        /// @brief CRC-8 currently being calculated as the plane is landing. See cPacket::UpdateCRC8.
+        unsigned char _calculatedCRC = 0;
+
+        /// @brief Additive sum of the last plane that landed, tag excluded. Gates decode with it, see _DockArrival.
+        unsigned char _landedCheckSum = 0;
 
         /**
          * @brief This private member indicates
          * exactly how many planes are on the
-         * departing taxiway. Each time a plane is queued
-         * through the PutPlaneOnTaxiway method this
-         * increases until the max of the buffer is met.
+         * departing taxiway, all lanes together.
+         * Each time a plane is queued through the
+         * PutPlaneOnTaxiway method this increases.
          * GetNextDepartingPlaneID will decrease it.
          */
         int _amountOfPlanesTaxiing = 0;
 
+        /// @brief The 2 UART bytes of the chunk being received. Same order as cChunk::ToUART.
+        unsigned char _uartChunk[2];
+
+        /// @brief Set once the first byte of _uartChunk was received.
+        bool _uartChunkStarted = false;
+
+        /// @brief How the chunk in _uartChunk is sent. Told by its first byte.
+        WireMode _uartChunkMode = WireMode::Unpacked;
+
+        /// @brief Gathers packed frames.
+        cPackedUARTReceiver _packedArrivals;
+
+        /// @brief Cut-through gate of each supported function. Indexed with BFIO_ID_TABLE.
+        cCutThroughGate _cutThroughGates[BFIOFunction_Count];
+
+        /// @brief Cut-through gate of the plane that is landing. nullptr if it has none.
+        cCutThroughGate* _landingGate = nullptr;
+
+        /**
+         * @brief Docking gate of each supported
+         * function. Indexed with BFIO_ID_TABLE, so
+         * unsupported IDs all share slot 0, which is
+         * never docked.
+         */
+        cDockingGate _dockingGates[BFIOFunction_Count];
+
+        /// @brief ID of the last plane that could not be handled. Carried by the HandlingError plane.
+        unsigned char _unhandledPlaneID = 0;
+
+        /// @brief Sequence tag of the last plane that could not be handled. The HandlingError plane echoes it.
+        int _unhandledSequenceTag = NO_SEQUENCE_TAG;
+
+        /// @brief Sequence tag of the last plane that landed. NO_SEQUENCE_TAG if untagged.
+        int _lastSequenceTag = NO_SEQUENCE_TAG;
+
+        /// @brief Sequence tag BoardPlane gives the next tagged plane.
+        unsigned char _nextSequenceTag = 0;
+
+        /// @brief Flags the next handshake this terminal boards carries.
+        unsigned char _handshakeFlags = 0;
+
+        /// @brief Set by Handshake until the answer lands. The handshake that lands meanwhile is the answer, not a request.
+        bool _awaitingHandshake = false;
+
+        /**
+         * @brief Tells if planes of that ID carry
+         * a sequence tag. Handshakes never do, as
+         * they are what agrees on sequenceTags.
+         */
+        bool _IsTagged(unsigned char planeID) { return sequenceTags && BFIO_ID_TABLE[planeID] != BFIOFunction_Handshake; }
+
+        /**
+         * @brief Gives the plane that just landed to
+         * the gate of its ID. Planes nobody handles
+         * are answered with a HandlingError plane.
+         * @return Execution::Passed = Docked | Execution::Unecessary = No gate, the plane stays available | Execution::Incompatibility = Unsupported ID | Otherwise what the gate returned
+         */
+        Execution _DockArrival();
+
+        /**
+         * @brief Gives the last segment of the landing
+         * plane to its cut-through gate. Called when
+         * the chunk after the segment lands.
+         * @return Execution::Passed = Given or no gate | Execution::Failed = The gate refused it
+         */
+        Execution _DeliverSegment();
+
+        /**
+         * @brief Tells the cut-through gate of the
+         * landing plane, if any, that it is done.
+         * @param landed
+         * true if the plane's check was verified.
+         */
+        void _EndCutThrough(bool landed);
+
+        /**
+         * @brief Stops the landing of the current
+         * plane. Its chunks are thrown away.
+         * @param reason
+         * Error message given to the device.
+         * @return Execution::Failed
+         */
+        Execution _DropArrival(const char* reason);
+
+        /**
+         * @brief Handles the Check chunk of the
+         * plane that is landing. The plane is
+         * already indexed, only its check and ID
+         * are left to verify.
+         * @return Execution::Passed = Plane landed | Execution::Failed = Wrong check | Execution::Incompatibility = Unsupported ID | Execution::Bypassed = Terminal is rejecting planes
+         */
+        Execution _LandPlane(unsigned char receivedCheck);
+
     public:
         /// @brief set to true if the class is constructed.
         bool built = false;
 
-        /// @brief Is set to true if a packet is ready for parsing
+        /// @brief Is set to true if a packet is ready for parsing. Set it back to false once handled.
         bool packetAvailable = false;
 
         /// @brief Is set to true if the function is currently receiving a packet
@@ -98,6 +306,64 @@ class cTerminal
 
         /// @brief Holds the ID of the packet that is currently being received. Defaults to 0.
         unsigned char receivingID = 0;
+
+        /**
+         * @brief How the last chunk arrived on the UART.
+         * Every mode is understood on arrival, the first
+         * byte of each chunk tells which one was used.
+         * Once WireMode::Protected, it stays so until a
+         * chunk cannot be read as protected, see
+         * _HandleUARTArrival.
+         * Answer a handshake in the mode it came in to
+         * accept that mode.
+         */
+        WireMode arrivalWireMode = WireMode::Unpacked;
+
+        /**
+         * @brief What the Check chunk of planes carries.
+         * Every handshake that lands sets it: PlaneCheck::CRC8
+         * if it has HANDSHAKE_CRC8, the additive sum otherwise.
+         */
+        PlaneCheck planeCheck = PlaneCheck::AdditiveSum;
+
+        /// @brief Amount of chunks that had a flipped bit corrected. WireMode::Protected only.
+        unsigned long correctedChunks = 0;
+
+        /// @brief Amount of chunks that could not be decoded and made the plane drop.
+        unsigned long rejectedChunks = 0;
+
+        /// @brief Most planes that were on the departure taxiway at once.
+        int mostPlanesTaxiing = 0;
+
+        /// @brief Amount of planes that left the taxiway through GetNextDepartingPlaneID.
+        unsigned long departedPlanes = 0;
+
+        /// @brief Sum of the time, in microseconds, departedPlanes spent taxiing.
+        unsigned long long totalTaxiTime = 0;
+
+        /// @brief Longest time, in microseconds, a plane spent taxiing.
+        unsigned long longestTaxiTime = 0;
+
+        /// @brief Amount of planes given to their docking gate.
+        unsigned long dockedPlanes = 0;
+
+        /// @brief Amount of planes with an unsupported ID. Each was answered with a HandlingError plane.
+        unsigned long unhandledPlanes = 0;
+
+        /**
+         * @brief Set to true once the handshake agreed
+         * on sequence tags. Planes then carry one last
+         * 1 byte parameter: their tag. Answers carry
+         * the tag of their request, so several requests
+         * of one function can be in flight and be
+         * answered in any order.
+         * Every handshake that lands sets it, like
+         * planeCheck. See Handshake.
+         */
+        bool sequenceTags = false;
+
+        /// @brief Handshake flags this terminal agrees to. Flags a handshake asks for outside of them are answered as refused.
+        unsigned char supportedHandshakeFlags = 0;
         //////////////////////////////////////////////
         cTerminal();
         //////////////////////////////////////////////
@@ -105,15 +371,36 @@ class cTerminal
         /**
          * @brief Method that gets incoming chunks
          * and stores them in the arrivals traffic buffer.
-         * This calculates the checksum as it goes,
-         * identifies when a start was received, compares
-         * check chunks and so on.
-         * @param newArrival
+         * Each chunk is handled in constant time: the
+         * checksum is kept up to date and segments are
+         * indexed as their Div chunks land. When the
+         * Check chunk lands, the plane is verified and
+         * becomes available already indexed.
+         * See GetLastArrivalView.
+         * @param newChunkArrival
          * Chunk that just arrived and needs to be queued.
-         * @return Execution::Passed chunk queued in buffer
+         * @return Execution::Passed = A plane landed | Execution::Bypassed = Chunk stored | Execution::Failed = Plane dropped | Execution::Incompatibility = Plane has an unsupported ID
          */
         Execution _HandlePlaneArrival(unsigned short newChunkArrival);
 
+        /**
+         * @brief Method that gets bytes as they are
+         * read from the UART, turns them back into
+         * chunks according to how they were sent,
+         * then gives the chunks to _HandlePlaneArrival.
+         * In WireMode::Protected, a chunk with one
+         * flipped bit is corrected. A chunk with
+         * two drops the plane right away instead
+         * of waiting for its check chunk.
+         * Once a chunk arrived protected, every chunk
+         * is read as protected until one without the
+         * flag cannot be corrected.
+         * @param arrivedByte
+         * Byte that was just read.
+         * @return Execution::Bypassed = Waiting for more bytes | Execution::Failed = Byte or chunk dropped | Otherwise what _HandlePlaneArrival returned.
+         */
+        Execution _HandleUARTArrival(unsigned char arrivedByte);
+
         /**
          * @brief Method that gets incoming chunks
          * and stores them in the arrivals traffic buffer.
@@ -130,7 +417,9 @@ class cTerminal
         /**
          * @brief This function returns a which plane ID
          * is next to the runway and is awaiting for
-         * takeoff.
+         * takeoff. It is the oldest plane of the
+         * Priority lane, or of the Bulk lane if the
+         * Priority lane is empty.
          * @attention
          * this function will remove the plane from the
          * taxiway. If you do not handle the plane, it's
@@ -138,21 +427,61 @@ class cTerminal
          * forever be waiting for its return.
          * @param idOfNextPlane 
          * The Id of the function to get the departing plane from.
-         * @return Execution 
+         * @return Execution::Passed = ID placed | Execution::Unecessary = No plane departing
          */
         Execution GetNextDepartingPlaneID(unsigned char* idOfNextPlane);
 
         /**
-         * @brief This method queues a packet to be sent eventually.
+         * @brief This method attempts to queue a plane to 
+         * be sent eventually on the taxiway, in the lane
+         * given by LaneOf.
          * 
-         * @attention this function will verify your packet.
+         * @attention this function will not verify your plane.
          * 
          * @param planeID 
          * Function ID that needs to be queued in the requests buffer.
-         * @return Execution 
+         * @return Execution::Unecessary = Plane already taxiing | Execution::Passed = Plane is now taxiing | Execution::Failed terminal status does not allow departures | Execution::Bypassed = Its lane is full.
          */
         Execution PutPlaneOnTaxiway(unsigned char planeID);
 
+        /**
+         * @brief Asks the other side for the given
+         * handshake flags. The handshake taxis, and
+         * the other terminal answers with the flags
+         * both sides support. Each terminal sets
+         * planeCheck and sequenceTags from them once
+         * the handshake lands on it.
+         * @param flags
+         * HANDSHAKE_CRC8, HANDSHAKE_SEQUENCE_TAGS or both. 0 asks for the defaults.
+         * @return Execution::Passed = Handshake taxiing | Otherwise what PutPlaneOnTaxiway returned
+         */
+        Execution Handshake(unsigned char flags);
+
+        /**
+         * @brief Lane of the departure taxiway a
+         * plane waits in. UniversalInfo and
+         * ErrorMessage planes are large and can
+         * wait, they go in TaxiwayLane::Bulk.
+         * @param planeID
+         * Function ID of the plane.
+         * @return The plane's lane.
+         */
+        static constexpr TaxiwayLane LaneOf(unsigned char planeID)
+        {
+            return (BFIO_ID_TABLE[planeID] == BFIOFunction_UniversalInfo || BFIO_ID_TABLE[planeID] == BFIOFunction_ErrorMessage) ? TaxiwayLane::Bulk : TaxiwayLane::Priority;
+        }
+
+        /**
+         * @brief Get how many planes are waiting
+         * in a lane of the departure taxiway.
+         * @param lane
+         * Which lane. TaxiwayLaneCount gives all lanes together.
+         * @param planesTaxiing
+         * Where the amount is placed.
+         * @return Execution::Passed = Amount placed | Execution::Failed = No such lane
+         */
+        Execution GetTaxiwayDepth(int lane, int* planesTaxiing);
+
         /**
          * @brief Puts the BFIO function ID of the
          * packet stored in the buffer in a pointer.
@@ -160,18 +489,125 @@ class cTerminal
          * or answer it is identified to.
          * @param idOfLastPacket 
          * Id of the packet (0-255)
-         * @return Execution 
+         * @return Execution::Passed = ID placed | Execution::Unecessary = No plane available
          */
         Execution GetLastPlaneID(unsigned char* idOfLastPacket);
 
+        /**
+         * @brief Makes a gate take the passengers of
+         * the planes with that ID as they land.
+         * Each segment is given to onSegment as soon
+         * as it is complete, then onLanding tells if
+         * the plane's check was good. Planes still
+         * land normally afterwards.
+         * @attention
+         * Segments are given before the plane is
+         * verified. Gates must only stage them until
+         * onLanding is called with true.
+         * @param planeID
+         * ID of the planes the gate takes.
+         * @param gate
+         * Given back to the callbacks. Usually the gate itself.
+         * @param onSegment
+         * Called with each segment. nullptr removes the gate.
+         * @param onLanding
+         * Called when the plane landed or was dropped.
+         * @return Execution::Passed = Gate set | Execution::Incompatibility = Unsupported ID
+         */
+        Execution SetCutThroughGate(unsigned char planeID, void* gate, SegmentArrivalCallback onSegment, PlaneLandingCallback onLanding);
+
+        /**
+         * @brief Routes the planes with that ID to
+         * a gate. Once set, planes that land are
+         * docked right away and do not stay available
+         * through packetAvailable.
+         * See DockGate in Gates.h to dock a gate object.
+         * @param planeID
+         * ID of the planes the gate handles.
+         * @param gate
+         * Given back to the callbacks. Usually the gate itself.
+         * @param onArrival
+         * Called with each plane that lands. nullptr removes the gate.
+         * @param onDeparture
+         * Called by BoardPlane. Can be nullptr if the gate never sends planes.
+         * @return Execution::Passed = Gate set | Execution::Incompatibility = Unsupported ID, or a plane the terminal builds
+         */
+        Execution SetDockingGate(unsigned char planeID, void* gate, PlaneDockingCallback onArrival, PlaneBoardingCallback onDeparture);
+
+        /**
+         * @brief Builds the plane of a function ID
+         * that left the taxiway, through its docking
+         * gate. Handshake and HandlingError planes
+         * are built by the terminal itself.
+         * @param planeID
+         * ID given by GetNextDepartingPlaneID.
+         * @param departingPlane
+         * Where the plane is built. MAX_PLANE_PASSENGER_CAPACITY chunks.
+         * @param planeSize
+         * Where its amount of chunks is placed.
+         * @return Execution::Passed = Plane built | Execution::Incompatibility = No gate sends that ID | Otherwise what the gate returned
+         */
+        Execution BoardPlane(unsigned char planeID, unsigned short* departingPlane, int* planeSize);
+
+        /**
+         * @brief Adds a sequence tag to a plane, as
+         * its last segment, and updates its check.
+         * Use it to tag answers with the tag of
+         * their request. See GetLastSequenceTag.
+         * @param plane
+         * The plane. It grows by 2 chunks.
+         * @param planeSize
+         * Its amount of chunks. Updated.
+         * @param sequenceTag
+         * The tag.
+         * @param check
+         * What the plane's Check chunk carries.
+         * @return Execution::Passed = Plane tagged | Execution::Failed = Plane too large
+         */
+        static Execution TagPlane(unsigned short* plane, int* planeSize, unsigned char sequenceTag, PlaneCheck check);
+
+        /**
+         * @brief Makes a plane's Check chunk carry
+         * the given check. Planes are built with the
+         * additive sum: only PlaneCheck::CRC8 rewrites it.
+         * @param plane
+         * The plane, Check chunk included.
+         * @param planeSize
+         * Its amount of chunks.
+         * @param check
+         * What the plane's Check chunk must carry.
+         * @return Execution::Passed = Check rewritten | Execution::Unecessary = Already the additive sum
+         */
+        static Execution SealPlane(unsigned short* plane, int planeSize, PlaneCheck check);
+
+        /**
+         * @brief Get the sequence tag the last plane
+         * that landed carried.
+         * @param sequenceTag
+         * Where the tag is placed.
+         * @return Execution::Passed = Tag placed | Execution::Unecessary = The plane was not tagged
+         */
+        Execution GetLastSequenceTag(unsigned char* sequenceTag);
+
         /**
          * @brief Resets this class to default value.
+         * Docked gates stay docked, see UndockGates.
+         * What a handshake negotiated is forgotten.
          * @attention
          * This will clear any buffers stored in this.
          * @return Execution 
          */
         Execution Reset();
 
+        /**
+         * @brief Removes every docking and cut-through
+         * gate. Planes then stay available through
+         * packetAvailable, like before any gate was
+         * docked.
+         * @return Execution::Passed
+         */
+        Execution UndockGates();
+
         /**
          * @brief Stores the last packet stored in
          * the buffer into an unsigned short packet
@@ -185,10 +621,26 @@ class cTerminal
          * Array of chunks where the packet will be stored
          * @param packetBufferSize 
          * Size of the chunk array
-         * @return Execution 
+         * @return Execution::Passed = Plane copied | Execution::Unecessary = No plane available | Execution::Failed = Buffer too small
          */
         Execution GetLastArrival(unsigned short* packetBuffer, int packetBufferSize);
 
+        /**
+         * @brief Opens a view over the last plane
+         * that landed, straight on the arrival runway.
+         * The plane was indexed while it landed, so
+         * nothing is copied or scanned again.
+         * 
+         * @attention
+         * The view stays valid until the next plane
+         * lands. This does not clear packetAvailable.
+         * 
+         * @param resultedView
+         * Where the opened view is placed.
+         * @return Execution::Passed = View opened | Execution::Unecessary = No plane available
+         */
+        Execution GetLastArrivalView(cPacketView* resultedView);
+
         /**
          * @brief Get the preliminary information of the
          * arriving packet that is currently being handled.
@@ -204,7 +656,8 @@ class cTerminal
          * Pointer to where the current chunk count will be stored
          * @param currentCheckSum 
          * Pointer to where the current check sum will be stored.
-         * @return Execution 
+         * It is the CRC-8 if planeCheck is PlaneCheck::CRC8.
+         * @return Execution::Passed = Informations placed | Execution::Unecessary = No plane is landing
          */
         Execution GetCurrentArrivalInfo(unsigned char* currentPacketID, int* currentChunkCount, unsigned char* currentCheckSum);
 
@@ -235,9 +688,11 @@ class cTerminal
          * @brief Checks if the plane can fit on the taxiway
          * (checks if the buffer has enough space for the request or answer)
          * @param planeSize 
-         * @return Execution 
+         * @param planeID
+         * Function ID of the plane. Only its lane needs room.
+         * @return Execution::Passed = Plane can taxi | Execution::Failed = Plane too large or its lane is full
          */
-        Execution CanPlaneTaxi(int planeSize);
+        Execution CanPlaneTaxi(int planeSize, unsigned char planeID);
 
         /**
          * @brief Method that returns Execution::Passed if the
@@ -246,7 +701,7 @@ class cTerminal
          * 
          * @param planeID 
          * ID of the plane to check for on the taxiway.
-         * @return Execution 
+         * @return Execution::Passed = Plane is taxiing | Execution::Failed = It is not
          */
         Execution IsPlaneOnDepartureTaxiway(unsigned char planeID);
  };
@@ -31,6 +31,7 @@
  */
 cTerminal::cTerminal()
 {
+    supportedHandshakeFlags = HANDSHAKE_CRC8 | HANDSHAKE_SEQUENCE_TAGS;
     built = true;
 }
 //////////////////////////////////////////////
@@ -38,86 +39,475 @@ cTerminal::cTerminal()
 /**
  * @brief Method that gets incoming chunks
  * and stores them in the arrivals traffic buffer.
- * This calculates the checksum as it goes,
- * identifies when a start was received, compares
- * check chunks and so on.
- * @param newArrival
+ * Each chunk is handled in constant time: the
+ * checksum is kept up to date and segments are
+ * indexed as their Div chunks land. When the
+ * Check chunk lands, the plane is verified and
+ * becomes available already indexed.
+ * See GetLastArrivalView.
+ * @param newChunkArrival
  * Chunk that just arrived and needs to be queued.
- * @return Execution::Passed chunk queued in buffer
+ * @return Execution::Passed = A plane landed | Execution::Bypassed = Chunk stored | Execution::Failed = Plane dropped | Execution::Incompatibility = Plane has an unsupported ID
  */
 Execution cTerminal::_HandlePlaneArrival(unsigned short newChunkArrival)
 {
-    Execution execution;
-    int chunkType;
-    unsigned char receivedByte;
+    unsigned char chunkClass = cChunk::ClassOf(newChunkArrival);
+    unsigned char receivedByte = (unsigned char)newChunkArrival;
+    cPlaneIndex* index = &_arrivalIndexes[_landingRunway];
 
-    #pragma region -Chunk analysis-
+    switch(chunkClass)
+    {
+        case(cChunk::ClassOf(ChunkType::Start)):
+        {
+            bool cutOff = receivingPacket;
+            unsigned char slot = BFIO_ID_TABLE[receivedByte];
 
-    // Get the chunk type.
-    execution = Chunk.ToType(newChunkArrival, &chunkType);
-    if(execution != Execution::Passed)
+            if(cutOff)
+            {
+                _EndCutThrough(false);
+            }
+
+            index->planeID = receivedByte;
+            index->planeSize = 0;
+            index->parameterCount = 0;
+            index->calculatedCheckSum = receivedByte;
+            index->receivedCheckSum = 0;
+            index->startFound = true;
+            index->checkFound = false;
+            index->freeByteCount = 0;
+
+            receivingPacket = true;
+            receivingID = receivedByte;
+            _calculatedCRC = cPacket::UpdateCRC8(0, newChunkArrival);
+            _previousWasDiv = false;
+            _ArrivalIDBuffer[_landingRunway][0] = newChunkArrival;
+            _landingSize = 1;
+            _landingGate = (_currentMode == 0 && _cutThroughGates[slot].onSegment != nullptr) ? &_cutThroughGates[slot] : nullptr;
+
+            if(cutOff)
+            {
+                // The packet that we were receiving suddently got cut off by this one.
+                Device.SetErrorMessage("89:Terminal -> Multiple Starts");
+                Device.SetStatus(Status::CommunicationError);
+                return Execution::Failed;
+            }
+            return Execution::Bypassed;
+        }
+
+        case(0):
+            if(receivingPacket)
+            {
+                return _DropArrival("99:Terminal -> Invalid chunk  ");
+            }
+            Device.SetErrorMessage(STRAY_CHUNK_RECEIVED);
+            return Execution::Failed;
+
+        default:
+            break;
+    }
+
+    if(!receivingPacket)
     {
-        Device.SetErrorMessage("60:Terminal -> Chunk.ToType ");
-        Device.SetStatus(Status::CommunicationError);
-        return execution;
+        Device.SetErrorMessage(STRAY_CHUNK_RECEIVED);
+        return Execution::Failed;
     }
 
-    // Get the chunk's byte data.
-    execution = Chunk.ToByte(newChunkArrival, &receivedByte);
-    if(execution != Execution::Passed)
+    if(chunkClass == cChunk::ClassOf(ChunkType::Check))
     {
-        Device.SetErrorMessage("69:Terminal -> Chunk.ToByte ");
-        Device.SetStatus(Status::CommunicationError);
-        return execution;    
+        return _LandPlane(receivedByte);
     }
-    #pragma endregion
-    
-    // Executed if we are already receiving packets.
-    if(receivingPacket)
+
+    // - Both checks are kept up to date as the plane lands - //
+    _calculatedCRC = cPacket::UpdateCRC8(_calculatedCRC, newChunkArrival);
+
+    if(chunkClass == cChunk::ClassOf(ChunkType::Byte))
     {
-        // If a start chunk is sent before end chunks, there is an issue.
-        if(chunkType ==  ChunkType::Start)
+        index->calculatedCheckSum += receivedByte;
+        _previousWasDiv = false;
+
+        // Rejecting terminals only keep track of the check.
+        if(_currentMode == 1)
         {
-            // The packet that we were receiving suddently got cut off by another.
-            Device.SetErrorMessage("82:Terminal -> Multiple Starts");
-            Device.SetStatus(Status::CommunicationError);
-            return Execution::Failed;
+            return Execution::Bypassed;
+        }
+
+        if(index->parameterCount == 0)
+        {
+            return _DropArrival(FREE_BYTES_IN_PACKET);
+        }
+        index->segmentLengths[index->parameterCount - 1]++;
+    }
+    else
+    {
+        if(_previousWasDiv)
+        {
+            return _DropArrival("143:Terminal -> Empty parameter");
         }
+        _previousWasDiv = true;
 
-        // End of packet received
-        if(chunkType == ChunkType::Check)
+        if(_currentMode == 1)
         {
-            receivingPacket = false;
+            return Execution::Bypassed;
+        }
 
-            // - Checksum not matching - //
-            if(_calculatedChecksum != receivedByte)
-            {
-                Device.SetErrorMessage("95:Terminal -> Check Mismatch.");
-                Device.SetStatus(Status::CommunicationError);
-                return Execution::Failed;
-            }
-            else
-            {
-                // - PLANE IS OK FOR ARRIVAL - //
-            }
+        if(index->parameterCount >= MAX_PLANE_PARAMETER_COUNT)
+        {
+            return _DropArrival("154:Terminal -> Too many params");
         }
 
-        // - STORE CHUNK - //
+        // The segment before this Div chunk is complete.
+        if(_DeliverSegment() != Execution::Passed)
+        {
+            return _DropArrival("160:Terminal -> Segment refused");
+        }
+        index->segmentOffsets[index->parameterCount] = (unsigned short)(_landingSize + 1);
+        index->segmentLengths[index->parameterCount] = 0;
+        index->parameterCount++;
     }
-    else
+
+    // - STORE CHUNK - //
+    // One slot is always kept for the Check chunk.
+    if(_landingSize >= SIZE_OF_ARRIVAL_PLANE - 1)
+    {
+        return _DropArrival("171:Terminal -> Plane too large");
+    }
+    _ArrivalIDBuffer[_landingRunway][_landingSize] = newChunkArrival;
+    _landingSize++;
+    return Execution::Bypassed;
+}
+
+/**
+ * @brief Stops the landing of the current
+ * plane. Its chunks are thrown away.
+ * @param reason
+ * Error message given to the device.
+ * @return Execution::Failed
+ */
+Execution cTerminal::_DropArrival(const char* reason)
+{
+    _EndCutThrough(false);
+    receivingPacket = false;
+    _landingSize = 0;
+    _previousWasDiv = false;
+    _arrivalIndexes[_landingRunway].startFound = false;
+
+    Device.SetErrorMessage(reason);
+    Device.SetStatus(Status::CommunicationError);
+    return Execution::Failed;
+}
+
+/**
+ * @brief Handles the Check chunk of the
+ * plane that is landing. The plane is
+ * already indexed, only its check and ID
+ * are left to verify.
+ * @param receivedCheck
+ * Byte carried by the Check chunk.
+ * @return Execution::Passed = Plane landed | Execution::Failed = Wrong check | Execution::Incompatibility = Unsupported ID | Execution::Bypassed = Terminal is rejecting planes
+ */
+Execution cTerminal::_LandPlane(unsigned char receivedCheck)
+{
+    cPlaneIndex* index = &_arrivalIndexes[_landingRunway];
+
+    // A Div chunk right before the Check chunk is an empty parameter.
+    if(_previousWasDiv)
+    {
+        return _DropArrival("214:Terminal -> Empty parameter");
+    }
+
+    // The last segment is complete. Its gate gets it before the check, in this same call.
+    // Unless it is a sequence tag, which is not the gate's.
+    if(!_IsTagged(receivingID) && _DeliverSegment() != Execution::Passed)
+    {
+        return _DropArrival("220:Terminal -> Segment refused");
+    }
+
+    // Handshakes say which check they carry, whatever was negotiated before.
+    // One without flags asks for the defaults. Rejecting terminals did not index them.
+    PlaneCheck arrivalCheck = planeCheck;
+    bool rejecting = _currentMode == 1;
+    bool handshake = !rejecting && BFIO_ID_TABLE[receivingID] == BFIOFunction_Handshake;
+    unsigned char handshakeFlags = 0;
+    if(handshake)
+    {
+        if(index->parameterCount == HANDSHAKE_PARAM_COUNT && index->segmentLengths[0] == 1)
+        {
+            handshakeFlags = (unsigned char)_ArrivalIDBuffer[_landingRunway][_landingSize - 1];
+        }
+        arrivalCheck = (handshakeFlags & HANDSHAKE_CRC8) ? PlaneCheck::CRC8 : PlaneCheck::AdditiveSum;
+    }
+
+    unsigned char expectedCheck = (arrivalCheck == PlaneCheck::CRC8) ? _calculatedCRC : index->calculatedCheckSum;
+
+    // - Checksum not matching - //
+    if(expectedCheck != receivedCheck)
+    {
+        return _DropArrival("235:Terminal -> Check Mismatch.");
+    }
+
+    // Only a handshake that passed its check renegotiates, to what both sides support.
+    if(handshake)
+    {
+        handshakeFlags &= supportedHandshakeFlags;
+        planeCheck = (handshakeFlags & HANDSHAKE_CRC8) ? PlaneCheck::CRC8 : PlaneCheck::AdditiveSum;
+        sequenceTags = (handshakeFlags & HANDSHAKE_SEQUENCE_TAGS) != 0;
+        if(_awaitingHandshake)
+        {
+            _awaitingHandshake = false;
+        }
+        else
+        {
+            // A request. The answer tells the other side what was agreed.
+            _handshakeFlags = handshakeFlags;
+            PutPlaneOnTaxiway(HANDSHAKE_PLANE_ID);
+        }
+    }
+
+    // Rejecting terminals did not index the tag either. The plane is not kept anyway.
+    _lastSequenceTag = NO_SEQUENCE_TAG;
+    if(!rejecting && _IsTagged(receivingID))
+    {
+        // The tag is the last segment. What is left is the plane as it would have been sent untagged.
+        if(index->parameterCount == 0 || index->segmentLengths[index->parameterCount - 1] != 1)
+        {
+            return _DropArrival("245:Terminal -> Missing tag   ");
+        }
+
+        unsigned char tag = (unsigned char)_ArrivalIDBuffer[_landingRunway][_landingSize - 1];
+        _lastSequenceTag = tag;
+        _landingSize -= 2;
+        index->parameterCount--;
+        index->calculatedCheckSum -= tag;
+        if(planeCheck == PlaneCheck::CRC8)
+        {
+            Packet.GetCRC8(_ArrivalIDBuffer[_landingRunway], _landingSize, &expectedCheck);
+        }
+        else
+        {
+            expectedCheck = index->calculatedCheckSum;
+        }
+        receivedCheck = expectedCheck;
+    }
+
+    receivingPacket = false;
+    _landedCheckSum = index->calculatedCheckSum;
+    index->calculatedCheckSum = expectedCheck;
+    index->receivedCheckSum = receivedCheck;
+    index->checkFound = true;
+    _ArrivalIDBuffer[_landingRunway][_landingSize] = ChunkType::Check + receivedCheck;
+    index->planeSize = _landingSize + 1;
+    _landingSize = 0;
+
+    if(BFIO_ID_TABLE[index->planeID] == BFIOFunction_None)
+    {
+        index->startFound = false;
+        Device.SetErrorMessage("249:Terminal -> Unsupported ID");
+        return _DockArrival();
+    }
+
+    if(rejecting)
+    {
+        index->startFound = false;
+        return Execution::Bypassed;
+    }
+
+    // - PLANE IS OK FOR ARRIVAL - //
+    _EndCutThrough(true);
+
+    // The next plane lands on the other runway so this one stays untouched.
+    _landingRunway ^= 1;
+    packetAvailable = true;
+    _DockArrival();
+    return Execution::Passed;
+}
+
+/**
+ * @brief Gives the plane that just landed to
+ * the gate of its ID. Planes nobody handles
+ * are answered with a HandlingError plane.
+ * @return Execution::Passed = Docked | Execution::Unecessary = No gate, the plane stays available | Execution::Incompatibility = Unsupported ID | Otherwise what the gate returned
+ */
+Execution cTerminal::_DockArrival()
+{
+    Execution execution;
+    unsigned char planeID = receivingID;
+    cDockingGate* gate = &_dockingGates[BFIO_ID_TABLE[planeID]];
+
+    if(BFIO_ID_TABLE[planeID] == BFIOFunction_None)
+    {
+        // No gate is touched. The other side is told which ID it was.
+        unhandledPlanes++;
+        _unhandledPlaneID = planeID;
+        _unhandledSequenceTag = _lastSequenceTag;
+        PutPlaneOnTaxiway(HANDLINGERROR_PLANE_ID);
+        return Execution::Incompatibility;
+    }
+
+    if(gate->onArrival == nullptr)
+    {
+        return Execution::Unecessary;
+    }
+
+    // The plane landed on the runway that was just left.
+    cPlaneIndex* index = &_arrivalIndexes[_landingRunway ^ 1];
+    unsigned short* plane = _ArrivalIDBuffer[_landingRunway ^ 1];
+
+    // Gates decode with the additive sum. The CRC-8 was already checked.
+    if(planeCheck == PlaneCheck::CRC8)
+    {
+        plane[index->planeSize - 1] = ChunkType::Check + _landedCheckSum;
+    }
+    execution = gate->onArrival(gate->gate, planeID, plane, index->planeSize, _lastSequenceTag);
+    packetAvailable = false;
+    dockedPlanes++;
+    return execution;
+}
+
+/**
+ * @brief Gives the last segment of the landing
+ * plane to its cut-through gate. Called when
+ * the chunk after the segment lands.
+ * @return Execution::Passed = Given or no gate | Execution::Failed = The gate refused it
+ */
+Execution cTerminal::_DeliverSegment()
+{
+    cPlaneIndex* index = &_arrivalIndexes[_landingRunway];
+    int segmentNumber = index->parameterCount;
+
+    if(_landingGate == nullptr || segmentNumber == 0)
+    {
+        return Execution::Passed;
+    }
+
+    cSegmentView segment(&_ArrivalIDBuffer[_landingRunway][index->segmentOffsets[segmentNumber - 1]], index->segmentLengths[segmentNumber - 1]);
+    if(_landingGate->onSegment(_landingGate->gate, index->planeID, segmentNumber, &segment) == Execution::Failed)
+    {
+        return Execution::Failed;
+    }
+    return Execution::Passed;
+}
+
+/**
+ * @brief Tells the cut-through gate of the
+ * landing plane, if any, that it is done.
+ * @param landed
+ * true if the plane's check was verified.
+ */
+void cTerminal::_EndCutThrough(bool landed)
+{
+    cCutThroughGate* gate = _landingGate;
+
+    if(gate == nullptr)
     {
-        if(chunkType == ChunkType::Start)
+        return;
+    }
+
+    _landingGate = nullptr;
+    if(gate->onLanding != nullptr)
+    {
+        gate->onLanding(gate->gate, receivingID, landed);
+    }
+}
+
+/**
+ * @brief Method that gets bytes as they are
+ * read from the UART, turns them back into
+ * chunks according to how they were sent,
+ * then gives the chunks to _HandlePlaneArrival.
+ * The first byte of a chunk tells how it was
+ * sent: 0 to 3 is WireMode::Unpacked, a set
+ * PROTECTED_UART_FLAG is WireMode::Protected
+ * and PACKED_UART_MARKER starts a
+ * WireMode::Packed frame.
+ * In WireMode::Protected, a chunk with one
+ * flipped bit is corrected. A chunk with
+ * two drops the plane right away instead
+ * of waiting for its check chunk.
+ * Once a chunk arrived protected, every chunk
+ * is read as protected, as their flag may be
+ * the bit that flipped. A chunk without the
+ * flag that cannot be corrected means the
+ * other side left WireMode::Protected: the
+ * plane drops and first bytes tell the mode
+ * again. 1 unpacked chunk in 32 can be
+ * corrected, so this can take a few chunks.
+ * @param arrivedByte
+ * Byte that was just read.
+ * @return Execution::Bypassed = Waiting for more bytes | Execution::Failed = Byte or chunk dropped | Otherwise what _HandlePlaneArrival returned.
+ */
+Execution cTerminal::_HandleUARTArrival(unsigned char arrivedByte)
+{
+    Execution execution;
+    unsigned short arrivedChunk;
+
+    if(!_uartChunkStarted && (_packedArrivals.IsReceiving() || (arrivedByte == PACKED_UART_MARKER && arrivalWireMode != WireMode::Protected)))
+    {
+        arrivalWireMode = WireMode::Packed;
+        execution = _packedArrivals.Receive(arrivedByte);
+        if(execution != Execution::Passed)
+        {
+            return execution;
+        }
+
+        for(int index = 0; index < _packedArrivals.planeSize; index++)
+        {
+            execution = _HandlePlaneArrival(_packedArrivals.plane[index]);
+        }
+        return execution;
+    }
+
+    if(!_uartChunkStarted)
+    {
+        // The first byte holds the chunk type. Anything else means we are between two chunks.
+        if((arrivedByte & (PROTECTED_UART_FLAG >> 8)) || arrivalWireMode == WireMode::Protected)
+        {
+            _uartChunkMode = WireMode::Protected;
+        }
+        else if(arrivedByte <= 3)
         {
-            #pragma region -Start of Arrival handling-
-            _calculatedChecksum = 0;
-            #pragma endregion
+            _uartChunkMode = WireMode::Unpacked;
         }
         else
         {
-            Device.SetErrorMessage(STRAY_CHUNK_RECEIVED);   
+            Device.SetErrorMessage(STRAY_CHUNK_RECEIVED);
+            return Execution::Failed;
         }
+
+        _uartChunk[1] = arrivedByte;
+        _uartChunkStarted = true;
+        return Execution::Bypassed;
     }
-  return Execution::Bypassed;
+
+    _uartChunk[0] = arrivedByte;
+    _uartChunkStarted = false;
+    arrivalWireMode = _uartChunkMode;
+
+    if(_uartChunkMode == WireMode::Protected)
+    {
+        bool corrected;
+        execution = Chunk.FromProtectedUART(_uartChunk, &arrivedChunk, &corrected);
+        if(execution != Execution::Passed)
+        {
+            // The plane cannot be trusted anymore. No need to wait for its check chunk.
+            rejectedChunks++;
+            if(!(_uartChunk[1] & (PROTECTED_UART_FLAG >> 8)))
+            {
+                arrivalWireMode = WireMode::Unpacked;
+            }
+            return _DropArrival("387:Terminal -> 2 flipped bits");
+        }
+
+        if(corrected)
+        {
+            correctedChunks++;
+        }
+    }
+    else
+    {
+        arrivedChunk = (_uartChunk[1] << 8) | _uartChunk[0];
+    }
+
+    return _HandlePlaneArrival(arrivedChunk);
 }
 
 /**
@@ -149,69 +539,190 @@ Execution cTerminal::_HandlePlaneDeparture(unsigned short* departingChunk)
  * Array of chunks where the packet will be stored
  * @param packetBufferSize 
  * Size of the chunk array
- * @return Execution 
+ * @return Execution::Passed = Plane copied | Execution::Unecessary = No plane available | Execution::Failed = Buffer too small
  */
 Execution cTerminal::GetLastArrival(unsigned short* packetBuffer, int packetBufferSize)
 {
-    return Execution::Failed;
+    unsigned char landedRunway = _landingRunway ^ 1;
+    int planeSize = _arrivalIndexes[landedRunway].planeSize;
+
+    if(!packetAvailable)
+    {
+        return Execution::Unecessary;
+    }
+
+    if(packetBufferSize < planeSize)
+    {
+        return Execution::Failed;
+    }
+
+    memcpy(packetBuffer, _ArrivalIDBuffer[landedRunway], planeSize * sizeof(unsigned short));
+    packetAvailable = false;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Opens a view over the last plane
+ * that landed, straight on the arrival runway.
+ * The plane was indexed while it landed, so
+ * nothing is copied or scanned again.
+ * 
+ * @attention
+ * The view stays valid until the next plane
+ * lands. This does not clear packetAvailable.
+ * 
+ * @param resultedView
+ * Where the opened view is placed.
+ * @return Execution::Passed = View opened | Execution::Unecessary = No plane available
+ */
+Execution cTerminal::GetLastArrivalView(cPacketView* resultedView)
+{
+    unsigned char landedRunway = _landingRunway ^ 1;
+
+    if(!packetAvailable)
+    {
+        return Execution::Unecessary;
+    }
+
+    return resultedView->Open(_ArrivalIDBuffer[landedRunway], &_arrivalIndexes[landedRunway]);
+}
+
+/**
+ * @brief Puts the BFIO function ID of the
+ * packet stored in the buffer in a pointer.
+ * This is used to identify which function
+ * or answer it is identified to.
+ * @param idOfLastPacket 
+ * Id of the packet (0-255)
+ * @return Execution::Passed = ID placed | Execution::Unecessary = No plane available
+ */
+Execution cTerminal::GetLastPlaneID(unsigned char* idOfLastPacket)
+{
+    if(!packetAvailable)
+    {
+        return Execution::Unecessary;
+    }
+
+    *idOfLastPacket = _arrivalIndexes[_landingRunway ^ 1].planeID;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Get the preliminary information of the
+ * arriving packet that is currently being handled.
+ * 
+ * @attention This function will return information
+ * on a packet that is currently being dealt with.
+ * The packet is not fully received when this function
+ * can be called.
+ * 
+ * @param currentPacketID
+ * Pointer to a variable where the current packet ID will be placed.
+ * @param currentChunkCount 
+ * Pointer to where the current chunk count will be stored
+ * @param currentCheckSum 
+ * Pointer to where the current check sum will be stored.
+ * It is the CRC-8 if planeCheck is PlaneCheck::CRC8.
+ * @return Execution::Passed = Informations placed | Execution::Unecessary = No plane is landing
+ */
+Execution cTerminal::GetCurrentArrivalInfo(unsigned char* currentPacketID, int* currentChunkCount, unsigned char* currentCheckSum)
+{
+    if(!receivingPacket)
+    {
+        return Execution::Unecessary;
+    }
+
+    *currentPacketID = receivingID;
+    *currentChunkCount = _landingSize;
+    *currentCheckSum = (planeCheck == PlaneCheck::CRC8) ? _calculatedCRC : _arrivalIndexes[_landingRunway].calculatedCheckSum;
+    return Execution::Passed;
 }
 
 /**
  * @brief This method attempts to queue a plane to 
- * be sent eventually on the taxiway.
+ * be sent eventually on the taxiway, in the lane
+ * given by LaneOf.
  * 
  * @attention this function will not verify your plane.
- * nor if the ID is available in the buffer list.
  * 
  * @param planeID 
  * The function ID corresponding to the plane request
  * that will try to enter the taxiway.
- * @return Execution::Unecessary = Plane already taxiing | Execution::Passed = Plane is now taxiing | Execution::Failed terminal status does not allow departures | Execution::Bypassed = Departure buffer is overflowing.
+ * @return Execution::Unecessary = Plane already taxiing | Execution::Passed = Plane is now taxiing | Execution::Failed terminal status does not allow departures | Execution::Bypassed = Its lane is full.
  */
 Execution cTerminal::PutPlaneOnTaxiway(unsigned char planeID)
 {
-    if(departureStatus == TerminalStatus::DepartureAvailable)
+    unsigned long planeBit = 1UL << (planeID & 31);
+    TaxiwayLane lane = LaneOf(planeID);
+
+    if(departureStatus != TerminalStatus::DepartureAvailable)
     {
-        for(int index = 0; index < SIZE_OF_DEPARTURE_TAXIWAY; index++)
+        if(departureStatus == TerminalStatus::NotEnoughSpace)
         {
-            unsigned char planeInTaxiway = _DepartureIDBuffer[index];
-    
-            if(planeID == planeInTaxiway)
-            {
-                // Plane is already taxiing.
-                return Execution::Unecessary;
-            }
+            return Execution::Bypassed;
+        }
+        return Execution::Failed;
+    }
 
-            if(index == _amountOfPlanesTaxiing)
-            {
-                _amountOfPlanesTaxiing++;
-                _DepartureIDBuffer[index] = planeID;
-                return Execution::Passed;
+    if(_taxiingPlanes[planeID >> 5] & planeBit)
+    {
+        // Plane is already taxiing.
+        return Execution::Unecessary;
+    }
 
-                // Plane is now taxiing.
-            }
-        }
-        departureStatus = TerminalStatus::NotEnoughSpace;
+    // Only that lane is full. Planes of the other one still taxi.
+    if(_taxiwaySizes[lane] == SIZE_OF_DEPARTURE_TAXIWAY)
+    {
         return Execution::Bypassed;
     }
-    else
+
+    // The new plane goes behind the last one of its lane.
+    unsigned char slot = (_taxiwayHeads[lane] + _taxiwaySizes[lane]) & (SIZE_OF_DEPARTURE_TAXIWAY - 1);
+    _DepartureIDBuffer[lane][slot] = planeID;
+    _taxiingSince[lane][slot] = micros();
+    _taxiwaySizes[lane]++;
+    _taxiingPlanes[planeID >> 5] |= planeBit;
+
+    _amountOfPlanesTaxiing++;
+    if(_amountOfPlanesTaxiing > mostPlanesTaxiing)
     {
-        if(departureStatus == TerminalStatus::NotEnoughSpace)
-        {
-            return Execution::Bypassed;
-        }
+        mostPlanesTaxiing = _amountOfPlanesTaxiing;
+    }
 
-        return Execution::Failed;
+    // Plane is now taxiing.
+    return Execution::Passed;
+}
+
+/**
+ * @brief Asks the other side for the given
+ * handshake flags. The handshake taxis, and
+ * the other terminal answers with the flags
+ * both sides support. Each terminal sets
+ * planeCheck and sequenceTags from them once
+ * the handshake lands on it.
+ * @param flags
+ * HANDSHAKE_CRC8, HANDSHAKE_SEQUENCE_TAGS or both. 0 asks for the defaults.
+ * @return Execution::Passed = Handshake taxiing | Otherwise what PutPlaneOnTaxiway returned
+ */
+Execution cTerminal::Handshake(unsigned char flags)
+{
+    Execution execution = PutPlaneOnTaxiway(HANDSHAKE_PLANE_ID);
+    if(execution != Execution::Passed)
+    {
+        return execution;
     }
-    // Plane can taxi.
 
-    return Execution::Failed;
+    _handshakeFlags = flags & supportedHandshakeFlags;
+    _awaitingHandshake = true;
+    return Execution::Passed;
 }
 
 /**
  * @brief This function returns a which plane ID
  * is next to the runway and is awaiting for
- * takeoff.
+ * takeoff. It is the oldest plane of the
+ * Priority lane, or of the Bulk lane if the
+ * Priority lane is empty.
  * @attention
  * this function will remove the plane from the
  * taxiway. If you do not handle the plane, it's
@@ -219,39 +730,331 @@ Execution cTerminal::PutPlaneOnTaxiway(unsigned char planeID)
  * forever be waiting for its return.
  * @param idOfNextPlane 
  * The Id of the function to get the departing plane from.
- * @return Execution::Unecessary = No plane departing |
+ * @return Execution::Passed = ID placed | Execution::Unecessary = No plane departing
  */
 Execution cTerminal::GetNextDepartingPlaneID(unsigned char* idOfNextPlane)
 {
-    if(_amountOfPlanesTaxiing > 0)
+    int lane = TaxiwayLane::Priority;
+
+    if(_amountOfPlanesTaxiing == 0)
     {
-        // Copy the ID of the plane thats next to the runway.
-        unsigned char departingPlaneID = _DepartureIDBuffer[_amountOfPlanesTaxiing-1];
+        return Execution::Unecessary;
+    }
 
-        // All the planes go forward just like traffic do
-        for(int index = 0; index < SIZE_OF_DEPARTURE_TAXIWAY-1; index++)
-        {
-            _DepartureIDBuffer[index] = _DepartureIDBuffer[index+1];
-        }
+    while(_taxiwaySizes[lane] == 0)
+    {
+        lane++;
+    }
 
-        // If the terminal previously had not enough space, its no longer the case
-        if(departureStatus == TerminalStatus::NotEnoughSpace)
+    // Copy the ID of the plane thats next to the runway.
+    unsigned char slot = _taxiwayHeads[lane];
+    unsigned char departingPlaneID = _DepartureIDBuffer[lane][slot];
+    unsigned long taxiTime = micros() - _taxiingSince[lane][slot];
+
+    _taxiwayHeads[lane] = (slot + 1) & (SIZE_OF_DEPARTURE_TAXIWAY - 1);
+    _taxiwaySizes[lane]--;
+    _taxiingPlanes[departingPlaneID >> 5] &= ~(1UL << (departingPlaneID & 31));
+
+    // There is 1 less plane that is taxiing.
+    _amountOfPlanesTaxiing--;
+    departedPlanes++;
+    totalTaxiTime += taxiTime;
+    if(taxiTime > longestTaxiTime)
+    {
+        longestTaxiTime = taxiTime;
+    }
+
+    *idOfNextPlane = departingPlaneID;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Get how many planes are waiting
+ * in a lane of the departure taxiway.
+ * @param lane
+ * Which lane. TaxiwayLaneCount gives all lanes together.
+ * @param planesTaxiing
+ * Where the amount is placed.
+ * @return Execution::Passed = Amount placed | Execution::Failed = No such lane
+ */
+Execution cTerminal::GetTaxiwayDepth(int lane, int* planesTaxiing)
+{
+    if(lane == TaxiwayLane::TaxiwayLaneCount)
+    {
+        *planesTaxiing = _amountOfPlanesTaxiing;
+        return Execution::Passed;
+    }
+
+    if(lane < 0 || lane >= TaxiwayLane::TaxiwayLaneCount)
+    {
+        return Execution::Failed;
+    }
+
+    *planesTaxiing = _taxiwaySizes[lane];
+    return Execution::Passed;
+}
+
+/**
+ * @brief Checks if the plane can fit on the taxiway
+ * (checks if the buffer has enough space for the request or answer)
+ * @param planeSize 
+ * @param planeID
+ * Function ID of the plane. Only its lane needs room.
+ * @return Execution::Passed = Plane can taxi | Execution::Failed = Plane too large or its lane is full
+ */
+Execution cTerminal::CanPlaneTaxi(int planeSize, unsigned char planeID)
+{
+    if(planeSize > MAX_PLANE_PASSENGER_CAPACITY || _taxiwaySizes[LaneOf(planeID)] >= SIZE_OF_DEPARTURE_TAXIWAY)
+    {
+        return Execution::Failed;
+    }
+    return Execution::Passed;
+}
+
+/**
+ * @brief Method that returns Execution::Passed if the
+ * specified plane is already queueing for departure.
+ * Otherwise, Execution::Failed is returned.
+ * 
+ * @param planeID 
+ * ID of the plane to check for on the taxiway.
+ * @return Execution::Passed = Plane is taxiing | Execution::Failed = It is not
+ */
+Execution cTerminal::IsPlaneOnDepartureTaxiway(unsigned char planeID)
+{
+    if(_taxiingPlanes[planeID >> 5] & (1UL << (planeID & 31)))
+    {
+        return Execution::Passed;
+    }
+    return Execution::Failed;
+}
+
+/**
+ * @brief Makes a gate take the passengers of
+ * the planes with that ID as they land.
+ * Each segment is given to onSegment as soon
+ * as it is complete, then onLanding tells if
+ * the plane's check was good. Planes still
+ * land normally afterwards.
+ * @attention
+ * Segments are given before the plane is
+ * verified. Gates must only stage them until
+ * onLanding is called with true.
+ * @param planeID
+ * ID of the planes the gate takes.
+ * @param gate
+ * Given back to the callbacks. Usually the gate itself.
+ * @param onSegment
+ * Called with each segment. nullptr removes the gate.
+ * @param onLanding
+ * Called when the plane landed or was dropped.
+ * @return Execution::Passed = Gate set | Execution::Incompatibility = Unsupported ID
+ */
+Execution cTerminal::SetCutThroughGate(unsigned char planeID, void* gate, SegmentArrivalCallback onSegment, PlaneLandingCallback onLanding)
+{
+    unsigned char slot = BFIO_ID_TABLE[planeID];
+
+    if(slot == BFIOFunction_None)
+    {
+        return Execution::Incompatibility;
+    }
+
+    _cutThroughGates[slot].gate = gate;
+    _cutThroughGates[slot].onSegment = onSegment;
+    _cutThroughGates[slot].onLanding = onLanding;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Routes the planes with that ID to
+ * a gate. Once set, planes that land are
+ * docked right away and do not stay available
+ * through packetAvailable.
+ * See DockGate in Gates.h to dock a gate object.
+ * @param planeID
+ * ID of the planes the gate handles.
+ * @param gate
+ * Given back to the callbacks. Usually the gate itself.
+ * @param onArrival
+ * Called with each plane that lands. nullptr removes the gate.
+ * @param onDeparture
+ * Called by BoardPlane. Can be nullptr if the gate never sends planes.
+ * @return Execution::Passed = Gate set | Execution::Incompatibility = Unsupported ID, or a plane the terminal builds
+ */
+Execution cTerminal::SetDockingGate(unsigned char planeID, void* gate, PlaneDockingCallback onArrival, PlaneBoardingCallback onDeparture)
+{
+    if(BFIO_ID_TABLE[planeID] == BFIOFunction_None || planeID == HANDSHAKE_PLANE_ID || planeID == HANDLINGERROR_PLANE_ID)
+    {
+        return Execution::Incompatibility;
+    }
+
+    unsigned char slot = BFIO_ID_TABLE[planeID];
+    _dockingGates[slot].gate = gate;
+    _dockingGates[slot].onArrival = onArrival;
+    _dockingGates[slot].onDeparture = onDeparture;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Builds the plane of a function ID
+ * that left the taxiway, through its docking
+ * gate. Handshake and HandlingError planes
+ * are built by the terminal itself.
+ * @param planeID
+ * ID given by GetNextDepartingPlaneID.
+ * @param departingPlane
+ * Where the plane is built. MAX_PLANE_PASSENGER_CAPACITY chunks.
+ * @param planeSize
+ * Where its amount of chunks is placed.
+ * @return Execution::Passed = Plane built | Execution::Incompatibility = No gate sends that ID | Otherwise what the gate returned
+ */
+Execution cTerminal::BoardPlane(unsigned char planeID, unsigned short* departingPlane, int* planeSize)
+{
+    Execution execution;
+    // Unsupported IDs land on slot 0, which has no gate.
+    cDockingGate* gate = &_dockingGates[BFIO_ID_TABLE[planeID]];
+    int sequenceTag = _IsTagged(planeID) ? _nextSequenceTag : NO_SEQUENCE_TAG;
+
+    if(planeID == HANDSHAKE_PLANE_ID)
+    {
+        // Checked with what it asks for, never tagged.
+        cPlane_Handshake::Encode(departingPlane, _handshakeFlags);
+        *planeSize = cPlane_Handshake::size;
+        SealPlane(departingPlane, *planeSize, (_handshakeFlags & HANDSHAKE_CRC8) ? PlaneCheck::CRC8 : PlaneCheck::AdditiveSum);
+        return Execution::Passed;
+    }
+
+    if(planeID == HANDLINGERROR_PLANE_ID)
+    {
+        // Answers the plane that could not be handled, with its tag.
+        cPlane_HandlingError::Encode(departingPlane, _unhandledPlaneID);
+        *planeSize = cPlane_HandlingError::size;
+        if(sequenceTag == NO_SEQUENCE_TAG || _unhandledSequenceTag == NO_SEQUENCE_TAG)
         {
-           departureStatus == TerminalStatus::DepartureAvailable; 
+            SealPlane(departingPlane, *planeSize, planeCheck);
+            return Execution::Passed;
         }
+        return TagPlane(departingPlane, planeSize, (unsigned char)_unhandledSequenceTag, planeCheck);
+    }
+
+    if(gate->onDeparture == nullptr)
+    {
+        return Execution::Incompatibility;
+    }
+
+    int boardingTag = sequenceTag;
+    execution = gate->onDeparture(gate->gate, departingPlane, planeSize, &boardingTag);
+    if(execution != Execution::Passed)
+    {
+        return execution;
+    }
+
+    // Once CRC-8 was negotiated, both directions use it.
+    if(sequenceTag == NO_SEQUENCE_TAG || boardingTag == NO_SEQUENCE_TAG)
+    {
+        SealPlane(departingPlane, *planeSize, planeCheck);
+        return Execution::Passed;
+    }
+
+    // Answers echo the tag of their request, only new tags are used up.
+    if(boardingTag == sequenceTag)
+    {
+        _nextSequenceTag++;
+    }
+    return TagPlane(departingPlane, planeSize, (unsigned char)boardingTag, planeCheck);
+}
+
+/**
+ * @brief Adds a sequence tag to a plane, as
+ * its last segment, and updates its check.
+ * Use it to tag answers with the tag of
+ * their request. See GetLastSequenceTag.
+ * @param plane
+ * The plane. It grows by 2 chunks.
+ * @param planeSize
+ * Its amount of chunks. Updated.
+ * @param sequenceTag
+ * The tag.
+ * @param check
+ * What the plane's Check chunk carries.
+ * @return Execution::Passed = Plane tagged | Execution::Failed = Plane too large
+ */
+Execution cTerminal::TagPlane(unsigned short* plane, int* planeSize, unsigned char sequenceTag, PlaneCheck check)
+{
+    int size = *planeSize;
+    unsigned char checkByte = (unsigned char)plane[size - 1];
+
+    if(size + 2 > MAX_PLANE_PASSENGER_CAPACITY)
+    {
+        Device.SetErrorMessage("898:Terminal -> Tag too large ");
+        return Execution::Failed;
+    }
+
+    plane[size - 1] = ChunkType::Div;
+    plane[size] = ChunkType::Byte + sequenceTag;
+    size += 2;
 
-        // There is 1 less plane that is taxiing.
-        _amountOfPlanesTaxiing--;
+    if(check == PlaneCheck::CRC8)
+    {
+        Packet.GetCRC8(plane, size - 1, &checkByte);
     }
     else
+    {
+        checkByte += sequenceTag;
+    }
+
+    plane[size - 1] = ChunkType::Check + checkByte;
+    *planeSize = size;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Makes a plane's Check chunk carry
+ * the given check. Planes are built with the
+ * additive sum: only PlaneCheck::CRC8 rewrites it.
+ * @param plane
+ * The plane, Check chunk included.
+ * @param planeSize
+ * Its amount of chunks.
+ * @param check
+ * What the plane's Check chunk must carry.
+ * @return Execution::Passed = Check rewritten | Execution::Unecessary = Already the additive sum
+ */
+Execution cTerminal::SealPlane(unsigned short* plane, int planeSize, PlaneCheck check)
+{
+    unsigned char crc = 0;
+
+    if(check != PlaneCheck::CRC8)
     {
         return Execution::Unecessary;
     }
-    return Execution::Failed;
+
+    Packet.GetCRC8(plane, planeSize - 1, &crc);
+    plane[planeSize - 1] = ChunkType::Check + crc;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Get the sequence tag the last plane
+ * that landed carried.
+ * @param sequenceTag
+ * Where the tag is placed.
+ * @return Execution::Passed = Tag placed | Execution::Unecessary = The plane was not tagged
+ */
+Execution cTerminal::GetLastSequenceTag(unsigned char* sequenceTag)
+{
+    if(_lastSequenceTag == NO_SEQUENCE_TAG)
+    {
+        return Execution::Unecessary;
+    }
+
+    *sequenceTag = (unsigned char)_lastSequenceTag;
+    return Execution::Passed;
 }
 
 /**
  * @brief Resets this class to default value.
+ * What a handshake negotiated is forgotten.
  * @attention
  * This will clear any buffers stored in this.
  * @return Execution 
@@ -261,7 +1064,47 @@ Execution cTerminal::Reset()
     departureStatus = TerminalStatus::Initialised;
     arrivalStatus = TerminalStatus::Initialised;
     _amountOfPlanesTaxiing = 0;
+    for(int lane = 0; lane < TaxiwayLane::TaxiwayLaneCount; lane++)
+    {
+        _taxiwayHeads[lane] = 0;
+        _taxiwaySizes[lane] = 0;
+    }
+    memset(_taxiingPlanes, 0, sizeof(_taxiingPlanes));
+
+    receivingPacket = false;
+    packetAvailable = false;
+    _landingSize = 0;
+    _previousWasDiv = false;
+    _uartChunkStarted = false;
+    _packedArrivals.Clear();
+    _landingGate = nullptr;
+    _lastSequenceTag = NO_SEQUENCE_TAG;
+    _unhandledSequenceTag = NO_SEQUENCE_TAG;
+    _nextSequenceTag = 0;
+    _awaitingHandshake = false;
+
+    // Back to what both sides use before any handshake.
+    planeCheck = PlaneCheck::AdditiveSum;
+    sequenceTags = false;
+
+    return Execution::Passed;
+}
 
+/**
+ * @brief Removes every docking and cut-through
+ * gate. Planes then stay available through
+ * packetAvailable, like before any gate was
+ * docked.
+ * @return Execution::Passed
+ */
+Execution cTerminal::UndockGates()
+{
+    for(int slot = 0; slot < BFIOFunction_Count; slot++)
+    {
+        _dockingGates[slot] = cDockingGate();
+        _cutThroughGates[slot] = cCutThroughGate();
+    }
+    _landingGate = nullptr;
     return Execution::Passed;
 }
 
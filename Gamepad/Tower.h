@@ -0,0 +1,157 @@
+/**
+ * @file Tower.h
+ * @author Lyam (Lyam.brs@gmail.com)
+ * @brief This file contains the control
+ * tower class. It watches the deadlines of
+ * planes that departed and wakes whoever is
+ * waiting on one only once it expires.
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ## 
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef TOWER_H
+  #define TOWER_H
+//=============================================//
+//	Include
+//=============================================//
+#include "Globals.h"
+
+/// @brief Most deadlines the tower can watch at once. One per gate is enough.
+#define MAX_TOWER_DEADLINES 16
+
+/**
+ * @brief Called by the tower when a deadline
+ * expires. The deadline is already forgotten,
+ * so it can be watched again from here.
+ * @param owner
+ * Whatever was given to cTower::Watch. Usually a gate.
+ */
+typedef void (*DeadlineCallback)(void* owner);
+
+/// @brief One deadline watched by the tower.
+struct cDeadline
+{
+    /// @brief millis() at which it expires.
+    unsigned long deadline = 0;
+    void* owner = nullptr;
+    DeadlineCallback onExpiry = nullptr;
+};
+
+/**
+ * @brief Class that watches deadlines on
+ * millis(). They are kept in a min-heap, so
+ * each _Handle only looks at the closest one
+ * and idle owners are never polled.
+ * Deadlines survive millis() wrapping around
+ * as long as they are less than 24 days away.
+ */
+class cTower
+ {
+    private:
+        /// @brief Min-heap of the watched deadlines. The closest one is always first.
+        cDeadline _deadlines[MAX_TOWER_DEADLINES];
+
+        /// @brief Amount of deadlines in _deadlines.
+        int _deadlineCount = 0;
+
+        /// @brief true if deadline a expires before deadline b, even across a millis() wrap.
+        static bool _IsBefore(unsigned long a, unsigned long b) { return (long)(a - b) < 0; }
+
+        /// @brief Moves a deadline towards the top of the heap until it is in order.
+        void _SiftUp(int index);
+
+        /// @brief Moves a deadline towards the bottom of the heap until it is in order.
+        void _SiftDown(int index);
+
+        /// @brief Forgets the deadline at that index of the heap.
+        void _Remove(int index);
+
+    public:
+        /// @brief set to true if the class is constructed.
+        bool built = false;
+
+        /// @brief Amount of deadlines that expired.
+        unsigned long expiredDeadlines = 0;
+
+        //////////////////////////////////////////////
+        cTower();
+        //////////////////////////////////////////////
+
+        /**
+         * @brief Time base function executed
+         * periodically. Wakes the owners of every
+         * deadline that expired, closest first.
+         * @return Execution::Passed = At least one deadline expired | Execution::Bypassed = None expired yet | Execution::Unecessary = Nothing watched
+         */
+        Execution _Handle();
+
+        /**
+         * @brief Same as _Handle, at a given time
+         * instead of millis().
+         * @param now
+         * The current time, in milliseconds.
+         * @return Execution::Passed = At least one deadline expired | Execution::Bypassed = None expired yet | Execution::Unecessary = Nothing watched
+         */
+        Execution _Handle(unsigned long now);
+
+        /**
+         * @brief Watches a deadline some time from
+         * now. An owner only ever has one deadline,
+         * watching again replaces it.
+         * @param owner
+         * Given back to onExpiry. Also identifies the deadline.
+         * @param onExpiry
+         * Called once the deadline expired.
+         * @param timeoutMs
+         * Milliseconds from now.
+         * @return Execution::Passed = Deadline watched | Execution::Failed = Tower full
+         */
+        Execution Watch(void* owner, DeadlineCallback onExpiry, unsigned long timeoutMs);
+
+        /**
+         * @brief Same as Watch, with the millis()
+         * at which the deadline expires.
+         * @param owner
+         * Given back to onExpiry. Also identifies the deadline.
+         * @param onExpiry
+         * Called once the deadline expired.
+         * @param deadline
+         * millis() at which it expires.
+         * @return Execution::Passed = Deadline watched | Execution::Failed = Tower full
+         */
+        Execution WatchUntil(void* owner, DeadlineCallback onExpiry, unsigned long deadline);
+
+        /**
+         * @brief Forgets the deadline of an owner.
+         * @param owner
+         * The owner given to Watch.
+         * @return Execution::Passed = Deadline forgotten | Execution::Unecessary = It had none
+         */
+        Execution Cancel(void* owner);
+
+        /**
+         * @brief Get how long until the closest
+         * deadline expires.
+         * @param millisecondsLeft
+         * Where the time is placed. 0 if it already expired.
+         * @return Execution::Passed = Time placed | Execution::Unecessary = Nothing watched
+         */
+        Execution GetTimeUntilNextDeadline(unsigned long* millisecondsLeft);
+
+        /// @brief Amount of deadlines being watched.
+        int GetWatchedCount();
+ };
+
+#endif
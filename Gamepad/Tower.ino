@@ -0,0 +1,223 @@
+/**
+ * @file Tower.ino
+ * @author Lyam (Lyam.brs@gmail.com)
+ * @brief The code methods of the
+ * control tower class.
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ## 
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########   */
+/////////////////////////////////////////////////////////////////////////////
+#include "Tower.h"
+/////////////////////////////////////////////////////////////////////////////
+cTower::cTower()
+{
+    _deadlineCount = 0;
+    built = true;
+}
+
+/// @brief Moves a deadline towards the top of the heap until it is in order.
+void cTower::_SiftUp(int index)
+{
+    cDeadline moved = _deadlines[index];
+
+    while(index > 0)
+    {
+        int parent = (index - 1) / 2;
+        if(!_IsBefore(moved.deadline, _deadlines[parent].deadline))
+        {
+            break;
+        }
+        _deadlines[index] = _deadlines[parent];
+        index = parent;
+    }
+    _deadlines[index] = moved;
+}
+
+/// @brief Moves a deadline towards the bottom of the heap until it is in order.
+void cTower::_SiftDown(int index)
+{
+    cDeadline moved = _deadlines[index];
+
+    while(true)
+    {
+        int child = 2 * index + 1;
+        if(child >= _deadlineCount)
+        {
+            break;
+        }
+
+        if(child + 1 < _deadlineCount && _IsBefore(_deadlines[child + 1].deadline, _deadlines[child].deadline))
+        {
+            child++;
+        }
+
+        if(!_IsBefore(_deadlines[child].deadline, moved.deadline))
+        {
+            break;
+        }
+        _deadlines[index] = _deadlines[child];
+        index = child;
+    }
+    _deadlines[index] = moved;
+}
+
+/// @brief Forgets the deadline at that index of the heap.
+void cTower::_Remove(int index)
+{
+    _deadlineCount--;
+    if(index == _deadlineCount)
+    {
+        return;
+    }
+
+    // The last deadline takes its place, then goes wherever it belongs.
+    _deadlines[index] = _deadlines[_deadlineCount];
+    _SiftDown(index);
+    _SiftUp(index);
+}
+
+/**
+ * @brief Time base function executed
+ * periodically. Wakes the owners of every
+ * deadline that expired, closest first.
+ * @return Execution::Passed = At least one deadline expired | Execution::Bypassed = None expired yet | Execution::Unecessary = Nothing watched
+ */
+Execution cTower::_Handle()
+{
+    return _Handle(millis());
+}
+
+/**
+ * @brief Same as _Handle, at a given time
+ * instead of millis().
+ * @param now
+ * The current time, in milliseconds.
+ * @return Execution::Passed = At least one deadline expired | Execution::Bypassed = None expired yet | Execution::Unecessary = Nothing watched
+ */
+Execution cTower::_Handle(unsigned long now)
+{
+    Execution execution = Execution::Bypassed;
+
+    if(_deadlineCount == 0)
+    {
+        return Execution::Unecessary;
+    }
+
+    // Only the closest deadline is ever compared.
+    while(_deadlineCount > 0 && !_IsBefore(now, _deadlines[0].deadline))
+    {
+        cDeadline expired = _deadlines[0];
+        _Remove(0);
+        expiredDeadlines++;
+        execution = Execution::Passed;
+
+        if(expired.onExpiry != nullptr)
+        {
+            expired.onExpiry(expired.owner);
+        }
+    }
+    return execution;
+}
+
+/**
+ * @brief Watches a deadline some time from
+ * now. An owner only ever has one deadline,
+ * watching again replaces it.
+ * @param owner
+ * Given back to onExpiry. Also identifies the deadline.
+ * @param onExpiry
+ * Called once the deadline expired.
+ * @param timeoutMs
+ * Milliseconds from now.
+ * @return Execution::Passed = Deadline watched | Execution::Failed = Tower full
+ */
+Execution cTower::Watch(void* owner, DeadlineCallback onExpiry, unsigned long timeoutMs)
+{
+    return WatchUntil(owner, onExpiry, millis() + timeoutMs);
+}
+
+/**
+ * @brief Same as Watch, with the millis()
+ * at which the deadline expires.
+ * @param owner
+ * Given back to onExpiry. Also identifies the deadline.
+ * @param onExpiry
+ * Called once the deadline expired.
+ * @param deadline
+ * millis() at which it expires.
+ * @return Execution::Passed = Deadline watched | Execution::Failed = Tower full
+ */
+Execution cTower::WatchUntil(void* owner, DeadlineCallback onExpiry, unsigned long deadline)
+{
+    Cancel(owner);
+
+    if(_deadlineCount == MAX_TOWER_DEADLINES)
+    {
+        Device.SetErrorMessage("168:Tower -> Tower full       ");
+        return Execution::Failed;
+    }
+
+    _deadlines[_deadlineCount].deadline = deadline;
+    _deadlines[_deadlineCount].owner = owner;
+    _deadlines[_deadlineCount].onExpiry = onExpiry;
+    _deadlineCount++;
+    _SiftUp(_deadlineCount - 1);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Forgets the deadline of an owner.
+ * @param owner
+ * The owner given to Watch.
+ * @return Execution::Passed = Deadline forgotten | Execution::Unecessary = It had none
+ */
+Execution cTower::Cancel(void* owner)
+{
+    for(int index = 0; index < _deadlineCount; index++)
+    {
+        if(_deadlines[index].owner == owner)
+        {
+            _Remove(index);
+            return Execution::Passed;
+        }
+    }
+    return Execution::Unecessary;
+}
+
+/**
+ * @brief Get how long until the closest
+ * deadline expires.
+ * @param millisecondsLeft
+ * Where the time is placed. 0 if it already expired.
+ * @return Execution::Passed = Time placed | Execution::Unecessary = Nothing watched
+ */
+Execution cTower::GetTimeUntilNextDeadline(unsigned long* millisecondsLeft)
+{
+    unsigned long now = millis();
+
+    if(_deadlineCount == 0)
+    {
+        return Execution::Unecessary;
+    }
+
+    *millisecondsLeft = _IsBefore(now, _deadlines[0].deadline) ? _deadlines[0].deadline - now : 0;
+    return Execution::Passed;
+}
+
+/// @brief Amount of deadlines being watched.
+int cTower::GetWatchedCount()
+{
+    return _deadlineCount;
+}
@@ -406,6 +406,76 @@ Execution TestAllUnits()
         return testResults;
     }
 
+    testResults = cTerminal_LaunchTests();
+    if(testResults == Execution::Bypassed)
+    {
+        Serial.println("#############################");
+        Serial.println("! ! !- TEST  BYPASSED - ! ! !");
+        Serial.println("#############################");    
+    }
+    if(testResults == Execution::Failed)
+    {
+        Rgb.SetColors(UT_ERROR_COLOR);
+        Rgb.SetErrorMode(UT_CTERMINAL_ERROR_CODE);
+        return testResults;
+    }
+
+    testResults = cTower_LaunchTests();
+    if(testResults == Execution::Bypassed)
+    {
+        Serial.println("#############################");
+        Serial.println("! ! !- TEST  BYPASSED - ! ! !");
+        Serial.println("#############################");    
+    }
+    if(testResults == Execution::Failed)
+    {
+        Rgb.SetColors(UT_ERROR_COLOR);
+        Rgb.SetErrorMode(UT_CTOWER_ERROR_CODE);
+        return testResults;
+    }
+
+    testResults = cScheduler_LaunchTests();
+    if(testResults == Execution::Bypassed)
+    {
+        Serial.println("#############################");
+        Serial.println("! ! !- TEST  BYPASSED - ! ! !");
+        Serial.println("#############################");    
+    }
+    if(testResults == Execution::Failed)
+    {
+        Rgb.SetColors(UT_ERROR_COLOR);
+        Rgb.SetErrorMode(UT_CSCHEDULER_ERROR_CODE);
+        return testResults;
+    }
+
+    testResults = cInputSampler_LaunchTests();
+    if(testResults == Execution::Bypassed)
+    {
+        Serial.println("#############################");
+        Serial.println("! ! !- TEST  BYPASSED - ! ! !");
+        Serial.println("#############################");    
+    }
+    if(testResults == Execution::Failed)
+    {
+        Rgb.SetColors(UT_ERROR_COLOR);
+        Rgb.SetErrorMode(UT_CINPUTSAMPLER_ERROR_CODE);
+        return testResults;
+    }
+
+    testResults = cAdcScanner_LaunchTests();
+    if(testResults == Execution::Bypassed)
+    {
+        Serial.println("#############################");
+        Serial.println("! ! !- TEST  BYPASSED - ! ! !");
+        Serial.println("#############################");    
+    }
+    if(testResults == Execution::Failed)
+    {
+        Rgb.SetColors(UT_ERROR_COLOR);
+        Rgb.SetErrorMode(UT_CADCSCANNER_ERROR_CODE);
+        return testResults;
+    }
+
     // SETTING SUCCESSFUL UNIT TEST RGB COLOR
     Rgb.SetColors(UT_PASSED_COLOR);
     Rgb.SetErrorMode(UT_PASSED_CODE);
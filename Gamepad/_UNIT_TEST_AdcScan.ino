@@ -0,0 +1,137 @@
+/**
+ * @file _UNIT_TEST_AdcScan.ino
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the ADC scanner class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ## 
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+
+
+#include "Globals.h"
+
+/**
+ * @brief Function that returns
+ * execution::passed if published scans are
+ * only seen once swapped in, whole, and if
+ * pins are given their channel.
+ * 
+ * @return Execution 
+ */
+Execution TEST_ADCSCAN_DoubleBuffer()
+{
+    const unsigned char pins[2] = {7, 5};
+    const int first[ADC_SCAN_CHANNELS] = {0, 4095, 12, 34};
+    const int second[ADC_SCAN_CHANNELS] = {1, 2, 3, 4};
+    const int third[ADC_SCAN_CHANNELS] = {5, 6, 7, 8};
+    cAdcScanner scanner(pins, 2);
+    const cAdcScan* scan = nullptr;
+    int channel = -1;
+
+    TestStart("AdcScan - DoubleBuffer");
+    TestStepDone();
+    if(!scanner.built || cAdcScanner(pins, 0).built || cAdcScanner(pins, ADC_SCAN_CHANNELS + 1).built)
+    {
+        TestFailed("The amount of pins was not checked.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(scanner.GetChannel(5, &channel) != Execution::Passed || channel != 1 || scanner.GetChannel(6, &channel) != Execution::Failed)
+    {
+        TestFailed("Pins were not given their channel.");
+        TestExpectedVSGotten("1", std::to_string(channel).c_str());
+        return Execution::Failed;
+    }
+
+    // Nothing scanned yet: the axes sit in the middle.
+    TestStepDone();
+    scan = scanner.GetScan();
+    if(scanner.Swap() != Execution::Unecessary || scan->values[0] != ADC_SCAN_IDLE_VALUE || scan->scanNumber != 0)
+    {
+        TestFailed("A scan was swapped in before any was published.");
+        return Execution::Failed;
+    }
+
+    // A published scan stays in the back until swapped in.
+    TestStepDone();
+    scanner.Publish(first, 1000);
+    if(scanner.GetScan()->scanNumber != 0)
+    {
+        TestFailed("A scan was seen before it was swapped in.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    scan = scanner.GetScan();
+    if(scanner.Swap() != Execution::Passed || scanner.GetScan() == scan)
+    {
+        TestFailed("The published scan was not swapped in.");
+        return Execution::Failed;
+    }
+    scan = scanner.GetScan();
+    if(memcmp(scan->values, first, sizeof(first)) != 0 || scan->scannedAt != 1000 || scan->scanNumber != 1 || scanner.Swap() != Execution::Unecessary)
+    {
+        TestFailed("The scan was not swapped in whole.");
+        TestExpectedVSGotten("1", std::to_string(scan->scanNumber).c_str());
+        return Execution::Failed;
+    }
+
+    // Only the latest of 2 scans is swapped in. The front one is kept until then.
+    TestStepDone();
+    scanner.Publish(second, 2000);
+    scanner.Publish(third, 3000);
+    if(scan->values[0] != first[0] || scanner.Swap() != Execution::Passed)
+    {
+        TestFailed("The front scan changed before it was swapped.");
+        return Execution::Failed;
+    }
+    scan = scanner.GetScan();
+    if(memcmp(scan->values, third, sizeof(third)) != 0 || scan->scanNumber != 3 || scanner.overwrittenScans.load() != 1)
+    {
+        TestFailed("The latest scan was not swapped in.");
+        TestExpectedVSGotten("3", std::to_string(scan->scanNumber).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if the ADC scanner works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cAdcScanner_LaunchTests()
+{
+    StartOfUnitTest("class cAdcScanner");
+    Execution result;
+
+    result = TEST_ADCSCAN_DoubleBuffer();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    UnitTestPassed();
+    return Execution::Passed;
+}
@@ -506,6 +506,411 @@ Execution TEST_CHUNK_ToChunk()
     return Execution::Passed;
 }
 
+/**
+ * @brief Function that returns
+ * execution::passed if ToChunks, ToTypes
+ * and ToBytes from the cChunk class give
+ * the same results as their one chunk
+ * versions.
+ * 
+ * @return Execution 
+ */
+Execution TEST_CHUNK_Spans()
+{
+    Execution result;
+    int types[4] = {ChunkType::Byte, ChunkType::Div, ChunkType::Start, ChunkType::Check};
+    unsigned char bytes[256];
+    unsigned short chunks[256];
+    unsigned char extractedBytes[256];
+    unsigned char typeBitmap = 0;
+
+    for(int i=0; i<256; ++i)
+    {
+        bytes[i] = (unsigned char)i;
+    }
+
+    #pragma region ToChunks
+    TestStart("Spans - ToChunks");
+    for(int type=0; type<4; ++type)
+    {
+        result = Chunk.ToChunks(bytes, 256, chunks, types[type]);
+        TestStepDone();
+        if(result != Execution::Passed)
+        {
+            TestFailed("ToChunks refused a valid chunk type.");
+            return Execution::Failed;
+        }
+
+        for(int i=0; i<256; ++i)
+        {
+            unsigned short expectedChunk = 0;
+            Chunk.ToChunk(bytes[i], &expectedChunk, types[type]);
+            if(chunks[i] != expectedChunk)
+            {
+                TestFailed("ToChunks does not match ToChunk.");
+                TestExpectedVSGotten(std::to_string(expectedChunk).c_str(), std::to_string(chunks[i]).c_str());
+                return Execution::Failed;
+            }
+        }
+    }
+
+    TestStepDone();
+    if(Chunk.ToChunks(bytes, 256, chunks, 1) != Execution::Failed)
+    {
+        TestFailed("ToChunks accepted an inexisting chunk type.");
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    #pragma region ToTypes
+    TestStart("Spans - ToTypes");
+    for(int type=0; type<4; ++type)
+    {
+        Chunk.ToChunks(bytes, 256, chunks, types[type]);
+        result = Chunk.ToTypes(chunks, 256, &typeBitmap);
+        TestStepDone();
+        if(result != Execution::Passed || typeBitmap != CHUNK_TYPE_BIT(types[type]))
+        {
+            TestFailed("ToTypes did not find exactly one chunk type.");
+            TestExpectedVSGotten(std::to_string(CHUNK_TYPE_BIT(types[type])).c_str(), std::to_string(typeBitmap).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    chunks[0] = ChunkType::Start + 1;
+    chunks[1] = ChunkType::Div;
+    chunks[2] = ChunkType::Check + 1;
+    result = Chunk.ToTypes(chunks, 3, &typeBitmap);
+    TestStepDone();
+    if(result != Execution::Passed || typeBitmap != (CHUNK_TYPE_BIT(ChunkType::Start) | CHUNK_TYPE_BIT(ChunkType::Div) | CHUNK_TYPE_BIT(ChunkType::Check)))
+    {
+        TestFailed("ToTypes did not find every chunk type.");
+        return Execution::Failed;
+    }
+
+    chunks[1] = 1024;
+    result = Chunk.ToTypes(chunks, 3, &typeBitmap);
+    TestStepDone();
+    if(result != Execution::Failed || !(typeBitmap & CHUNK_INVALID_BIT))
+    {
+        TestFailed("ToTypes accepted a value above 1023.");
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    #pragma region ToBytes
+    TestStart("Spans - ToBytes");
+    for(int type=0; type<4; ++type)
+    {
+        Chunk.ToChunks(bytes, 256, chunks, types[type]);
+        result = Chunk.ToBytes(chunks, 256, extractedBytes);
+        TestStepDone();
+        if(result != Execution::Passed)
+        {
+            TestFailed("ToBytes refused valid chunks.");
+            return Execution::Failed;
+        }
+
+        for(int i=0; i<256; ++i)
+        {
+            if(extractedBytes[i] != bytes[i])
+            {
+                TestFailed("ToBytes does not match ToByte.");
+                TestExpectedVSGotten(std::to_string(bytes[i]).c_str(), std::to_string(extractedBytes[i]).c_str());
+                return Execution::Failed;
+            }
+        }
+    }
+
+    chunks[255] = 0xFFFF;
+    result = Chunk.ToBytes(chunks, 256, extractedBytes);
+    TestStepDone();
+    if(result != Execution::Failed)
+    {
+        TestFailed("ToBytes accepted a value above 1023.");
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    return Execution::Passed;
+}
+
+Execution TEST_CHUNK_Packed()
+{
+    Execution result;
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    unsigned short unpacked[MAX_PLANE_PASSENGER_CAPACITY];
+    unsigned char frame[PACKED_UART_SIZE(MAX_PLANE_PASSENGER_CAPACITY)];
+    int frameSize = 0;
+    int unpackedSize = 0;
+
+    // Start chunk, then alternating div and byte chunks with every value, then a check chunk.
+    plane[0] = ChunkType::Start + 20;
+    for(int i=1; i<MAX_PLANE_PASSENGER_CAPACITY; ++i)
+    {
+        plane[i] = (i % 2) ? (ChunkType::Div + (i & 0xFF)) : (ChunkType::Byte + ((i * 37) & 0xFF));
+    }
+
+    #pragma region Round trip
+    TestStart("Packed - Round trip");
+    for(int count=2; count<=MAX_PLANE_PASSENGER_CAPACITY; ++count)
+    {
+        unsigned short lastChunk = plane[count - 1];
+        plane[count - 1] = ChunkType::Check + 0xFF;
+
+        result = Chunk.ToPackedUART(plane, count, frame, &frameSize);
+        TestStepDone();
+        if(result != Execution::Passed || frameSize != PACKED_UART_SIZE(count))
+        {
+            TestFailed("ToPackedUART did not pack a valid plane.");
+            TestExpectedVSGotten(std::to_string(PACKED_UART_SIZE(count)).c_str(), std::to_string(frameSize).c_str());
+            return Execution::Failed;
+        }
+
+        result = Chunk.FromPackedUART(frame, frameSize, unpacked, &unpackedSize);
+        if(result != Execution::Passed || unpackedSize != count)
+        {
+            TestFailed("FromPackedUART refused a packed plane.");
+            TestExecution(result);
+            return Execution::Failed;
+        }
+
+        for(int i=0; i<count; ++i)
+        {
+            if(unpacked[i] != plane[i])
+            {
+                TestFailed("Chunk changed while packed.");
+                TestExpectedVSGotten(std::to_string(plane[i]).c_str(), std::to_string(unpacked[i]).c_str());
+                return Execution::Failed;
+            }
+        }
+        plane[count - 1] = lastChunk;
+    }
+
+    TestStepDone();
+    if(PACKED_UART_SIZE(4) != PACKED_UART_HEADER_SIZE + 5)
+    {
+        TestFailed("4 chunks do not take 5 bytes.");
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    plane[1] = ChunkType::Div;
+    plane[2] = ChunkType::Byte + 0xA5;
+    plane[3] = ChunkType::Check + 0xC5;
+
+    #pragma region Invalid
+    TestStart("Packed - Invalid");
+    TestStepDone();
+    if(Chunk.ToPackedUART(plane, 1, frame, &frameSize) != Execution::Failed)
+    {
+        TestFailed("ToPackedUART packed a single chunk.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    plane[2] = 1024;
+    if(Chunk.ToPackedUART(plane, 4, frame, &frameSize) != Execution::Failed)
+    {
+        TestFailed("ToPackedUART packed a value above 1023.");
+        return Execution::Failed;
+    }
+    plane[2] = ChunkType::Byte + 0xA5;
+
+    Chunk.ToPackedUART(plane, 4, frame, &frameSize);
+    TestStepDone();
+    if(Chunk.FromPackedUART(frame, frameSize - 1, unpacked, &unpackedSize) != Execution::Incompatibility)
+    {
+        TestFailed("FromPackedUART accepted a truncated frame.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    frame[0] = 0x02;
+    if(Chunk.FromPackedUART(frame, frameSize, unpacked, &unpackedSize) != Execution::Failed)
+    {
+        TestFailed("FromPackedUART accepted a frame without marker.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    plane[1] = ChunkType::Start;
+    Chunk.ToPackedUART(plane, 4, frame, &frameSize);
+    if(Chunk.FromPackedUART(frame, frameSize, unpacked, &unpackedSize) != Execution::Failed)
+    {
+        TestFailed("FromPackedUART accepted a start chunk inside a plane.");
+        return Execution::Failed;
+    }
+    plane[1] = ChunkType::Div;
+    TestPassed();
+    #pragma endregion
+
+    #pragma region Resync
+    TestStart("Packed - Resync");
+    cPackedUARTReceiver receiver;
+    unsigned char line[64];
+    int lineSize = 0;
+    int landed = 0;
+
+    // Noise, a marker with a bad count, a frame cut short by another one, then a good frame.
+    unsigned char noise[5] = {0x00, 0x13, PACKED_UART_MARKER, 0x01, 0xFF};
+    for(int i=0; i<5; ++i) line[lineSize++] = noise[i];
+    Chunk.ToPackedUART(plane, 4, frame, &frameSize);
+    for(int i=0; i<3; ++i) line[lineSize++] = frame[i];
+    for(int i=0; i<frameSize; ++i) line[lineSize++] = frame[i];
+
+    for(int i=0; i<lineSize; ++i)
+    {
+        if(receiver.Receive(line[i]) == Execution::Passed)
+        {
+            landed++;
+        }
+    }
+
+    TestStepDone();
+    if(landed != 1 || receiver.planeSize != 4 || receiver.IsReceiving())
+    {
+        TestFailed("Receiver did not land exactly one plane.");
+        TestExpectedVSGotten("1", std::to_string(landed).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    for(int i=0; i<4; ++i)
+    {
+        if(receiver.plane[i] != plane[i])
+        {
+            TestFailed("Receiver landed a different plane.");
+            TestExpectedVSGotten(std::to_string(plane[i]).c_str(), std::to_string(receiver.plane[i]).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    if(receiver.droppedBytes != 8)
+    {
+        TestFailed("Receiver did not drop the noise.");
+        TestExpectedVSGotten("8", std::to_string(receiver.droppedBytes).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    return Execution::Passed;
+}
+
+Execution TEST_CHUNK_Protected()
+{
+    Execution result;
+    unsigned char uart[2];
+    unsigned char noisy[2];
+    unsigned short chunk = 0;
+    bool corrected = false;
+
+    #pragma region Clean
+    TestStart("Protected - Clean");
+    for(int value=0; value<1024; ++value)
+    {
+        result = Chunk.ToProtectedUART(value, uart);
+        if(result != Execution::Passed || !(uart[1] & 0x80) || uart[1] == PACKED_UART_MARKER)
+        {
+            TestFailed("Protected chunk does not start above 127.");
+            TestExpectedVSGotten(std::to_string(value).c_str(), std::to_string(uart[1]).c_str());
+            return Execution::Failed;
+        }
+
+        result = Chunk.FromProtectedUART(uart, &chunk, &corrected);
+        if(result != Execution::Passed || chunk != value || corrected)
+        {
+            TestFailed("Clean protected chunk did not come back.");
+            TestExpectedVSGotten(std::to_string(value).c_str(), std::to_string(chunk).c_str());
+            return Execution::Failed;
+        }
+    }
+    TestStepDone();
+
+    if(Chunk.ToProtectedUART(1024, uart) != Execution::Failed)
+    {
+        TestFailed("ToProtectedUART protected a value above 1023.");
+        return Execution::Failed;
+    }
+    TestStepDone();
+    TestPassed();
+    #pragma endregion
+
+    #pragma region Single flipped bit
+    TestStart("Protected - 1 flipped bit");
+    for(int value=0; value<1024; ++value)
+    {
+        Chunk.ToProtectedUART(value, uart);
+        for(int bit=0; bit<16; ++bit)
+        {
+            unsigned int code = (uart[0] | (uart[1] << 8)) ^ (1u << bit);
+            noisy[0] = (unsigned char)code;
+            noisy[1] = (unsigned char)(code >> 8);
+
+            result = Chunk.FromProtectedUART(noisy, &chunk, &corrected);
+            if(result != Execution::Passed || chunk != value || !corrected)
+            {
+                TestFailed("Flipped bit was not corrected.");
+                TestExpectedVSGotten(std::to_string(value).c_str(), std::to_string(chunk).c_str());
+                return Execution::Failed;
+            }
+        }
+    }
+
+    // An unpacked chunk is refused, unless it is exactly a protected one whose flag flipped.
+    for(int value=0; value<1024; ++value)
+    {
+        Chunk.ToUART(value, uart);
+        if(Chunk.FromProtectedUART(uart, &chunk, &corrected) != Execution::Failed)
+        {
+            Chunk.ToProtectedUART(chunk, noisy);
+            if(!corrected || (noisy[0] | (noisy[1] << 8)) != (value | PROTECTED_UART_FLAG))
+            {
+                TestFailed("Chunk without PROTECTED_UART_FLAG accepted.");
+                TestExpectedVSGotten(std::to_string(value).c_str(), std::to_string(chunk).c_str());
+                return Execution::Failed;
+            }
+        }
+    }
+    TestStepDone();
+    TestPassed();
+    #pragma endregion
+
+    #pragma region Two flipped bits
+    TestStart("Protected - 2 flipped bits");
+    for(int value=0; value<1024; ++value)
+    {
+        Chunk.ToProtectedUART(value, uart);
+        for(int first=0; first<16; ++first)
+        {
+            for(int second=first+1; second<16; ++second)
+            {
+                unsigned int code = (uart[0] | (uart[1] << 8)) ^ (1u << first) ^ (1u << second);
+                noisy[0] = (unsigned char)code;
+                noisy[1] = (unsigned char)(code >> 8);
+
+                if(Chunk.FromProtectedUART(noisy, &chunk, &corrected) != Execution::Failed)
+                {
+                    TestFailed("2 flipped bits were not detected.");
+                    TestExpectedVSGotten(std::to_string(first).c_str(), std::to_string(second).c_str());
+                    return Execution::Failed;
+                }
+            }
+        }
+    }
+    TestStepDone();
+    TestPassed();
+    #pragma endregion
+
+    return Execution::Passed;
+}
+
 /**
  * @brief Unit test function which returns
  * Execution::Passed if chunk works
@@ -542,6 +947,27 @@ Execution cChunk_LaunchTests()
         return Execution::Failed;
     }
 
+    result = TEST_CHUNK_Spans();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_CHUNK_Packed();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_CHUNK_Protected();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
     UnitTestPassed();
     return Execution::Passed;
 }
\ No newline at end of file
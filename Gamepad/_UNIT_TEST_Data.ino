@@ -249,7 +249,8 @@ Execution TEST_cData_int()
     int converted = false;
 
     #pragma region ToBytes ToData
-    for(toConvert = 1; toConvert != 0; toConvert = -toConvert*2)
+    // Negated through unsigned: signed overflow is undefined and would never reach 0.
+    for(toConvert = 1; toConvert != 0; toConvert = (int)(0 - (unsigned int)toConvert*2))
     {
         Data.ToBytes(toConvert, Array, sizeOfArray);
         Data.ToData(&converted, Array, sizeOfArray);
@@ -339,7 +340,7 @@ Execution TEST_cData_long()
     long converted = false;
 
     #pragma region ToBytes ToData
-    for(toConvert = 1; toConvert != 0; toConvert = -toConvert*2)
+    for(toConvert = 1; toConvert != 0; toConvert = (long)(0 - (unsigned long)toConvert*2))
     {
         Data.ToBytes(toConvert, Array, sizeOfArray);
         Data.ToData(&converted, Array, sizeOfArray);
@@ -419,7 +420,7 @@ Execution TEST_cData_longlong()
     long long converted = false;
 
     #pragma region ToBytes ToData
-    for(toConvert = 1; toConvert != 0; toConvert = -toConvert*2)
+    for(toConvert = 1; toConvert != 0; toConvert = (long long)(0 - (unsigned long long)toConvert*2))
     {
         Data.ToBytes(toConvert, Array, sizeOfArray);
         Data.ToData(&converted, Array, sizeOfArray);
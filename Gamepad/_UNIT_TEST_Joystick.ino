@@ -38,7 +38,46 @@
  */
 Execution TEST_JOYSTICK_CalculateJoystickAxisDeadzone()
 {
-  return Execution::Bypassed;
+    TestStart("CalculateJoystickAxisDeadzone");
+    // {axis, deadzone, expected axis}
+    const int cases[][3] = {{50, 100, 0}, {-100, 100, 0}, {101, 100, -3}, {2048, 100, 1848}, {-2048, 100, -1848}, {1000, 1, 998}, {-1000, 4000, 0}};
+    int axis = 0;
+
+    for(unsigned int index = 0; index < sizeof(cases) / sizeof(cases[0]); index++)
+    {
+        axis = cases[index][0];
+        TestStepDone();
+        if(CalculateJoystickAxisDeadzone(&axis, cases[index][1]) != Execution::Passed)
+        {
+            TestFailed("Unexpected execution result returned when a deadzone was given.");
+            return Execution::Failed;
+        }
+
+        if(axis != cases[index][2])
+        {
+            TestFailed("Wrong axis placed in the pointer.");
+            TestExpectedVSGotten(std::to_string(cases[index][2]).c_str(), std::to_string(axis).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    axis = 1234;
+    TestStepDone();
+    if(CalculateJoystickAxisDeadzone(&axis, 0) != Execution::Unecessary || axis != 1234)
+    {
+        TestFailed("A deadzone of 0 did not bypass the function.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(CalculateJoystickAxisDeadzone(&axis, -1) != Execution::Failed || axis != 1234)
+    {
+        TestFailed("A negative deadzone did not fail.");
+        return Execution::Failed;
+    }
+
+    TestPassed();
+    return Execution::Passed;
 }
 /**
  * @brief Unit test function that tests every
@@ -51,7 +90,369 @@ Execution TEST_JOYSTICK_CalculateJoystickAxisDeadzone()
  */
 Execution TEST_JOYSTICK_CalculateJoystickAxisTrim()
 {
-  return Execution::Bypassed;
+    TestStart("CalculateJoystickAxisTrim");
+    // {axis, trim, expected axis}
+    const int cases[][3] = {{0, 100, 100}, {0, -100, -100}, {2048, 100, 2048}, {-2048, 100, -1848}, {-2048, -100, -2048}, {1000, 127, 1064}, {-3, -127, -129}};
+    int axis = 0;
+
+    for(unsigned int index = 0; index < sizeof(cases) / sizeof(cases[0]); index++)
+    {
+        axis = cases[index][0];
+        TestStepDone();
+        if(CalculateJoystickAxisTrim(&axis, cases[index][1]) != Execution::Passed)
+        {
+            TestFailed("Unexpected execution result returned when a trim was given.");
+            return Execution::Failed;
+        }
+
+        if(axis != cases[index][2])
+        {
+            TestFailed("Wrong axis placed in the pointer.");
+            TestExpectedVSGotten(std::to_string(cases[index][2]).c_str(), std::to_string(axis).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    axis = 1234;
+    TestStepDone();
+    if(CalculateJoystickAxisTrim(&axis, 0) != Execution::Unecessary || axis != 1234)
+    {
+        TestFailed("A trim of 0 did not bypass the function.");
+        return Execution::Failed;
+    }
+
+    TestPassed();
+    return Execution::Passed;
+}
+/**
+ * @brief Unit test function that tests that
+ * cJoystickPipeline chains its stages in order
+ * and that each mode gets its own pipeline.
+ * 
+ * It Tests if returned executions are what's
+ * expected. It also tests that the correct
+ * values are set in the pointers.
+ * @return Execution 
+ */
+Execution TEST_JOYSTICK_Pipeline()
+{
+    TestStart("Pipeline");
+    cJoystickAxis input;
+    cJoystick joystick;
+    int axis = 0;
+
+    TestStepDone();
+    if(cJoystickPipeline<>::Process(-1234, &input) != -1234 || cJoystickPipeline<cCenterAxisStage>::Process(-1234, &input) != _JOY_MID_VAL)
+    {
+        TestFailed("Empty or centered pipeline did not return what was expected.");
+        return Execution::Failed;
+    }
+
+    // Deadzone of 100 brings 1000 to 851, then 8 bits keep multiples of 16.
+    TestStepDone();
+    CalculateJoystickAxisCoefficients(100, 0, &input.coefficients);
+    axis = cJoystickPipeline<cCalibrateAxisStage, cQuantizeAxisStage<8>>::Process(1000, &input);
+    if(axis != 848)
+    {
+        TestFailed("Stages were not chained in order.");
+        TestExpectedVSGotten("848", std::to_string(axis).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    axis = cJoystickPipeline<cQuantizeAxisStage<8>, cCalibrateAxisStage>::Process(-1000, &input);
+    if(axis != -843)
+    {
+        TestFailed("Stages were not chained in order. (Negatives)");
+        TestExpectedVSGotten("-843", std::to_string(axis).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(joystick.SetMode(JOYSTICK_MODE_RAW) != Execution::Passed || joystick.SetMode(JOYSTICK_MODE_BYPASSED) != Execution::Passed)
+    {
+        TestFailed("Unexpected execution result returned by SetMode.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    axis = 1;
+    if(joystick.Update() != Execution::Failed || joystick.GetCurrentAxis_X(&axis) != Execution::Passed || axis != 0)
+    {
+        TestFailed("A joystick that was not built did not stay bypassed.");
+        return Execution::Failed;
+    }
+
+    TestPassed();
+    return Execution::Passed;
+}
+/**
+ * @brief Unit test function that tests that
+ * the filter stages remove noise and spikes
+ * and follow moves as documented.
+ * 
+ * It Tests if returned executions are what's
+ * expected. It also tests that the correct
+ * values are set in the pointers.
+ * @return Execution 
+ */
+Execution TEST_JOYSTICK_Filters()
+{
+    TestStart("Filters");
+    cJoystickAxis input;
+    int axis = 0;
+
+    // A lone spike never goes through the median.
+    TestStepDone();
+    const int spiked[] = {100, 100, 900, 100, 100};
+    for(unsigned int index = 0; index < sizeof(spiked) / sizeof(spiked[0]); index++)
+    {
+        axis = cMedianOf3Stage::Process(spiked[index], &input);
+        if(axis != 100)
+        {
+            TestFailed("cMedianOf3Stage let a spike through.");
+            TestExpectedVSGotten("100", std::to_string(axis).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    cMovingAverageStage<4>::Process(-10, &input);
+    cMovingAverageStage<4>::Process(-20, &input);
+    axis = cMovingAverageStage<4>::Process(-30, &input);
+    if(axis != -18)
+    {
+        TestFailed("cMovingAverageStage did not average its last values.");
+        TestExpectedVSGotten("-18", std::to_string(axis).c_str());
+        return Execution::Failed;
+    }
+
+    // Still, 1 LSB of alternating noise is smoothed away. A flick goes through right away.
+    TestStepDone();
+    for(int sample = 0; sample < 64; sample++)
+    {
+        axis = cJoystickNoiseFilterStage::Process(500 + (sample & 1), &input);
+        if(sample > 0 && axis != 500)
+        {
+            TestFailed("cAdaptiveFilterStage did not smooth a still axis.");
+            TestExpectedVSGotten("500", std::to_string(axis).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    axis = cJoystickNoiseFilterStage::Process(-1500, &input);
+    axis = cJoystickNoiseFilterStage::Process(-1500, &input);
+    if(axis > -1400)
+    {
+        TestFailed("cAdaptiveFilterStage lagged behind a flick.");
+        TestExpectedVSGotten("-1500", std::to_string(axis).c_str());
+        return Execution::Failed;
+    }
+
+    TestPassed();
+    return Execution::Passed;
+}
+/**
+ * @brief Unit test function that tests the
+ * response curves, their tables, the radial
+ * deadzone and its overshoot, setting them through the
+ * ResponseCurve gate, and that each joystick
+ * rebuilds its own tables in Update.
+ * 
+ * It Tests if returned executions are what's
+ * expected. It also tests that the correct
+ * values are set in the pointers.
+ * @return Execution 
+ */
+Execution TEST_JOYSTICK_ResponseCurves()
+{
+    TestStart("ResponseCurves");
+    short table[JOYSTICK_RESPONSE_TABLE_SIZE];
+    cJoystickAxisCoefficients coefficients;
+    cJoystickResponse response;
+    cJoystickRadialDeadzone radial;
+    cResponseCurveSettings settings;
+    cResponseCurveSettings applied;
+    int x = 0;
+    int y = 0;
+
+    // A straight line changes nothing: the table is the deadzone and trim, exactly.
+    TestStepDone();
+    CalculateJoystickAxisCoefficients(100, 20, &coefficients);
+    if(BuildJoystickResponseTable(100, 20, &response, table) != Execution::Passed)
+    {
+        TestFailed("Unexpected execution result returned by BuildJoystickResponseTable.");
+        return Execution::Failed;
+    }
+    for(int index = 0; index < JOYSTICK_RESPONSE_TABLE_SIZE; index++)
+    {
+        x = index + _JOY_MIN_VAL;
+        ApplyJoystickAxisCoefficients(&x, &coefficients);
+        if(table[index] != x)
+        {
+            TestFailed("A straight line's table differs from the deadzone and trim.");
+            TestExpectedVSGotten(std::to_string(x).c_str(), std::to_string(table[index]).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    response.curve = JOYSTICK_CURVE_EXPO;
+    if(CalculateJoystickResponse(1024, &response) != 256 || CalculateJoystickResponse(-1024, &response) != -256 || CalculateJoystickResponse(_JOY_MAX_VAL, &response) != _JOY_MAX_VAL)
+    {
+        TestFailed("The expo curve is not cubic.");
+        TestExpectedVSGotten("256", std::to_string(CalculateJoystickResponse(1024, &response)).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    response.strength = 128;
+    if(CalculateJoystickResponse(1024, &response) != 639)
+    {
+        TestFailed("The strength did not blend the curve with a straight line.");
+        TestExpectedVSGotten("639", std::to_string(CalculateJoystickResponse(1024, &response)).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    response.curve = JOYSTICK_CURVE_S;
+    response.strength = JOYSTICK_CURVE_MAX_STRENGTH;
+    if(CalculateJoystickResponse(512, &response) != 320 || CalculateJoystickResponse(1024, &response) != 1024)
+    {
+        TestFailed("The S curve is not a smoothstep.");
+        TestExpectedVSGotten("320", std::to_string(CalculateJoystickResponse(512, &response)).c_str());
+        return Execution::Failed;
+    }
+
+    // A step half way: straight lines between the points.
+    TestStepDone();
+    const unsigned char step[JOYSTICK_CURVE_POINTS] = {0, 0, 0, 0, 255, 255, 255, 255};
+    response.curve = JOYSTICK_CURVE_CUSTOM;
+    memcpy(response.points, step, sizeof(step));
+    if(CalculateJoystickResponse(1024, &response) != 0 || CalculateJoystickResponse(-1152, &response) != -1024 || CalculateJoystickResponse(1280, &response) != _JOY_MAX_VAL)
+    {
+        TestFailed("The custom curve did not go through its points.");
+        TestExpectedVSGotten("-1024", std::to_string(CalculateJoystickResponse(-1152, &response)).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    response.curve = JOYSTICK_CURVE_COUNT;
+    if(BuildJoystickResponseTable(0, 0, &response, table) != Execution::Failed || CalculateJoystickRadialDeadzone(JOYSTICK_MAX_RADIAL_DEADZONE + 1, &radial) != Execution::Failed)
+    {
+        TestFailed("Invalid curves or radial deadzones were accepted.");
+        return Execution::Failed;
+    }
+
+    // Within the radius everything is centered. Past it, the direction is kept.
+    TestStepDone();
+    CalculateJoystickRadialDeadzone(200, &radial);
+    x = 100;
+    y = 100;
+    cRadialDeadzoneStage::Process(&x, &y, &radial);
+    if(x != 0 || y != 0)
+    {
+        TestFailed("A diagonal within the radial deadzone was not centered.");
+        return Execution::Failed;
+    }
+    x = 1000;
+    y = 0;
+    cRadialDeadzoneStage::Process(&x, &y, &radial);
+    if(x != 886 || y != 0)
+    {
+        TestFailed("The radial deadzone did not rescale an axis.");
+        TestExpectedVSGotten("886", std::to_string(x).c_str());
+        return Execution::Failed;
+    }
+    x = -707;
+    y = 707;
+    cRadialDeadzoneStage::Process(&x, &y, &radial);
+    if(x != -622 || y != 622)
+    {
+        TestFailed("The radial deadzone bent a diagonal.");
+        TestExpectedVSGotten("622", std::to_string(y).c_str());
+        return Execution::Failed;
+    }
+
+    // Corners overshoot _JOY_MAX_VAL, by less than the scale, and the table clamps them.
+    TestStepDone();
+    cJoystickResponse linear;
+    cJoystickAxis clamped;
+    BuildJoystickResponseTable(0, 0, &linear, table);
+    clamped.responseTable = table;
+    CalculateJoystickRadialDeadzone(JOYSTICK_MAX_RADIAL_DEADZONE, &radial);
+    const int overshootBound = _JOY_MAX_VAL * radial.scale / (1 << _JOY_Q);
+    x = _JOY_MAX_VAL - 1;
+    y = _JOY_MIN_VAL;
+    cRadialDeadzoneStage::Process(&x, &y, &radial);
+    if(x <= _JOY_MAX_VAL || x >= overshootBound || y >= _JOY_MIN_VAL || y <= -overshootBound)
+    {
+        TestFailed("A corner left the radial deadzone outside of its overshoot bound.");
+        TestExpectedVSGotten(std::to_string(overshootBound).c_str(), std::to_string(x).c_str());
+        return Execution::Failed;
+    }
+    if(cResponseTableStage::Process(x, &clamped) != _JOY_MAX_VAL - 1 || cResponseTableStage::Process(y, &clamped) != _JOY_MIN_VAL)
+    {
+        TestFailed("The response table did not clamp an overshooting corner.");
+        TestExpectedVSGotten(std::to_string(_JOY_MAX_VAL - 1).c_str(), std::to_string(cResponseTableStage::Process(x, &clamped)).c_str());
+        return Execution::Failed;
+    }
+
+    // Through BFIO: what the gate decodes is applied, and what was applied is answered.
+    TestStepDone();
+    cGate_ResponseCurve gate;
+    unsigned short plane[RESPONSECURVE_PASSENGER_CAPACITY];
+    cPlane_ResponseCurve::Encode(plane, 1, JOYSTICK_CURVE_S, 200, 50, 32, 64, 96, 128, 159, 191, 223, 255);
+    if(gate._DockSlavePlaneArrival(RESPONSECURVE_PLANE_ID, plane, cPlane_ResponseCurve::size) != Execution::Passed || gate.Read(&settings) != Execution::Passed)
+    {
+        TestFailed("The ResponseCurve plane did not dock.");
+        return Execution::Failed;
+    }
+    if(ApplyResponseCurveSettings(&settings, &applied) != Execution::Passed || RightJoystick.GetResponse(&response) != Execution::Passed || RightJoystick.GetRadialDeadZone(&x) != Execution::Passed)
+    {
+        TestFailed("Unexpected execution result returned by ApplyResponseCurveSettings.");
+        return Execution::Failed;
+    }
+    if(response.curve != JOYSTICK_CURVE_S || response.strength != 200 || x != 200 || applied.radialDeadzone != 50 || applied.points[7] != 255)
+    {
+        TestFailed("The settings were not applied to the right joystick.");
+        TestExpectedVSGotten("200", std::to_string(x).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    settings.curve = JOYSTICK_CURVE_COUNT;
+    settings.radialDeadzone = 0;
+    if(ApplyResponseCurveSettings(&settings, &applied) != Execution::Failed || applied.curve != JOYSTICK_CURVE_S || applied.radialDeadzone != 0)
+    {
+        TestFailed("A curve that does not exist was not answered with the one in use.");
+        return Execution::Failed;
+    }
+    RightJoystick.SetResponseCurve(JOYSTICK_CURVE_LINEAR, JOYSTICK_CURVE_MAX_STRENGTH);
+
+    // Each joystick owns its tables, even on the same pins, and only Update rebuilds them.
+    TestStepDone();
+    static cJoystickShaping shaping;
+    cJoystick joystick(LEFT_JOYSTICK_X_PIN, LEFT_JOYSTICK_Y_PIN, LEFT_JOYSTICK_SWITCH_PIN, &shaping);
+    const int halfTravel = JOYSTICK_RESPONSE_TABLE_SIZE / 2 + 500;
+    short leftTable = LeftJoystickShaping.xTable[halfTravel];
+    if(!joystick.built || shaping.xTable[halfTravel] != 500 || joystick.SetDeadZone_X(1000) != Execution::Passed || shaping.xTable[halfTravel] != 500)
+    {
+        TestFailed("The joystick's table was rebuilt by its setter instead of by Update.");
+        TestExpectedVSGotten("500", std::to_string(shaping.xTable[halfTravel]).c_str());
+        return Execution::Failed;
+    }
+    joystick.Update();
+    if(shaping.xTable[halfTravel] != 0 || LeftJoystickShaping.xTable[halfTravel] != leftTable)
+    {
+        TestFailed("Update did not rebuild the joystick's own table, and only it.");
+        TestExpectedVSGotten("0", std::to_string(shaping.xTable[halfTravel]).c_str());
+        return Execution::Failed;
+    }
+
+    TestPassed();
+    return Execution::Passed;
 }
 #pragma endregion
 
@@ -1471,6 +1872,36 @@ Execution cJoystick_LaunchTests()
     StartOfUnitTest("cJoystick");
     Execution result;
 
+    result = TEST_JOYSTICK_CalculateJoystickAxisDeadzone();
+    if(result == Execution::Failed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_JOYSTICK_CalculateJoystickAxisTrim();
+    if(result == Execution::Failed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_JOYSTICK_Pipeline();
+    if(result == Execution::Failed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_JOYSTICK_Filters();
+    if(result == Execution::Failed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_JOYSTICK_ResponseCurves();
+    if(result == Execution::Failed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
     result = TEST_JOYSTICK_GetSetMode();
     if(result == Execution::Failed){
         UnitTestFailed();
@@ -111,6 +111,57 @@ Execution TEST_PACKET_GetParametersFromPacket();
 
 Execution TEST_PACKET_EntireProcess();
 
+/**
+ * @brief Test function that verifies that
+ * the packet class can index a plane in a
+ * single pass, locate its segments from
+ * that index and refuse corrupted planes.
+ * 
+ * @return Execution 
+ */
+Execution TEST_PACKET_IndexPlane();
+
+/**
+ * @brief Test function that verifies that
+ * values read through cPacketView and
+ * cSegmentView are the same as the ones
+ * cData gets from copied bytes.
+ * 
+ * @return Execution 
+ */
+Execution TEST_PACKET_Views();
+
+/**
+ * @brief Test function that verifies that
+ * cPacketBuilder builds the same plane as
+ * AppendSegments and CreateFromSegments, and
+ * that it never writes past its buffer.
+ * 
+ * @return Execution 
+ */
+Execution TEST_PACKET_Builder();
+
+/**
+ * @brief Test function that verifies that
+ * cPlaneSchema computes exact plane sizes,
+ * encodes the same planes as CreateFromSegments
+ * and refuses planes that do not follow it.
+ * 
+ * @return Execution 
+ */
+Execution TEST_PACKET_Schema();
+
+/**
+ * @brief Test function that verifies that
+ * PLANE_CRC8_TABLE is a real CRC-8, that planes
+ * finished in PlaneCheck::CRC8 mode are indexed,
+ * and that swapped bytes and moved Div chunks
+ * the sum lets through are caught.
+ * 
+ * @return Execution 
+ */
+Execution TEST_PACKET_CRC();
+
 /**
  * @brief Unit test function which returns
  * Execution::Passed if packet works
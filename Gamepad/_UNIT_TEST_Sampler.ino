@@ -0,0 +1,120 @@
+/**
+ * @file _UNIT_TEST_Sampler.ino
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the input sampler class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ## 
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+
+
+#include "Globals.h"
+
+/**
+ * @brief Function that returns
+ * execution::passed if published snapshots
+ * are read back whole and numbered, and if
+ * SampleInputs publishes what the input
+ * objects hold.
+ * 
+ * @return Execution 
+ */
+Execution TEST_SAMPLER_Snapshot()
+{
+    cInputSampler sampler;
+    cInputSnapshot snapshot;
+    cInputSnapshot read;
+    int x = 0;
+    int y = 0;
+    bool state = false;
+
+    TestStart("Sampler - Snapshot");
+    TestStepDone();
+    if(sampler.Read(&read) != Execution::Unecessary)
+    {
+        TestFailed("A snapshot was read before any was published.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    snapshot.leftX = -2048;
+    snapshot.leftY = 2047;
+    snapshot.rightX = 12;
+    snapshot.rightY = -7;
+    snapshot.switches = 1 << SNAPSHOT_RIGHT_SWITCH_BIT;
+    snapshot.sampledAt = 123456;
+    snapshot.sampleNumber = 99;
+    sampler.Publish(&snapshot);
+    if(sampler.Read(&read) != Execution::Passed || read.leftX != -2048 || read.leftY != 2047 || read.rightX != 12 || read.rightY != -7
+       || read.switches != (1 << SNAPSHOT_RIGHT_SWITCH_BIT) || read.sampledAt != 123456 || read.sampleNumber != 1)
+    {
+        TestFailed("The snapshot was not read back whole.");
+        TestExpectedVSGotten("1", std::to_string(read.sampleNumber).c_str());
+        return Execution::Failed;
+    }
+
+    // Only the latest snapshot is kept.
+    TestStepDone();
+    snapshot.leftX = 5;
+    sampler.Publish(&snapshot);
+    snapshot.leftX = 6;
+    sampler.Publish(&snapshot);
+    if(sampler.Read(&read) != Execution::Passed || read.leftX != 6 || read.sampleNumber != 3 || sampler.readRetries.load() != 0)
+    {
+        TestFailed("The latest snapshot was not read.");
+        TestExpectedVSGotten("6", std::to_string(read.leftX).c_str());
+        return Execution::Failed;
+    }
+
+    // What the global sampler publishes is what the objects hold.
+    TestStepDone();
+    SampleInputs();
+    LeftJoystick.GetEverything(&x, &y, &state);
+    if(Sampler.Read(&read) != Execution::Passed || read.leftX != x || read.leftY != y || ((read.switches >> SNAPSHOT_LEFT_SWITCH_BIT) & 1) != (unsigned int)state)
+    {
+        TestFailed("SampleInputs did not publish the inputs.");
+        TestExpectedVSGotten(std::to_string(x).c_str(), std::to_string(read.leftX).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if the input sampler works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cInputSampler_LaunchTests()
+{
+    StartOfUnitTest("class cInputSampler");
+    Execution result;
+
+    result = TEST_SAMPLER_Snapshot();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    UnitTestPassed();
+    return Execution::Passed;
+}
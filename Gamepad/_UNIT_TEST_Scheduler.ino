@@ -0,0 +1,303 @@
+/**
+ * @file _UNIT_TEST_Scheduler.ino
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the Scheduler class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ## 
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+
+
+#include "Globals.h"
+
+/// @brief Time given to the schedulers under test, in microseconds.
+unsigned long UT_SCHEDULER_NOW = 0;
+/// @brief How long UT_SchedulerSlowTask takes.
+unsigned long UT_SCHEDULER_SLOW_RUNTIME = 0;
+#define UT_SCHEDULER_FAST_RUNTIME 10
+/// @brief Tasks that ran, in order. 0 = slow, 1 = fast, 2 = event.
+int UT_SCHEDULER_RAN[16];
+int UT_SCHEDULER_RAN_COUNT = 0;
+
+/// @brief SchedulerClock of the schedulers under test.
+unsigned long UT_SchedulerClock()
+{
+    return UT_SCHEDULER_NOW;
+}
+
+/// @brief Task taking UT_SCHEDULER_SLOW_RUNTIME.
+void UT_SchedulerSlowTask()
+{
+    UT_SCHEDULER_RAN[UT_SCHEDULER_RAN_COUNT++ % 16] = 0;
+    UT_SCHEDULER_NOW += UT_SCHEDULER_SLOW_RUNTIME;
+}
+
+/// @brief Task taking UT_SCHEDULER_FAST_RUNTIME.
+void UT_SchedulerFastTask()
+{
+    UT_SCHEDULER_RAN[UT_SCHEDULER_RAN_COUNT++ % 16] = 1;
+    UT_SCHEDULER_NOW += UT_SCHEDULER_FAST_RUNTIME;
+}
+
+/// @brief Task that takes no time.
+void UT_SchedulerEventTask()
+{
+    UT_SCHEDULER_RAN[UT_SCHEDULER_RAN_COUNT++ % 16] = 2;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if periodic tasks run
+ * at a fixed rate, first added first, and
+ * if their runtime, jitter, overruns and
+ * skipped periods are measured.
+ * 
+ * @return Execution 
+ */
+Execution TEST_SCHEDULER_FixedRate()
+{
+    cScheduler scheduler(UT_SchedulerClock);
+    cTask slow;
+    cTask fast;
+    // 1.5 ms before the clock wraps around.
+    unsigned long base = (unsigned long)0 - 1500;
+
+    UT_SCHEDULER_NOW = base;
+    UT_SCHEDULER_SLOW_RUNTIME = 50;
+    UT_SCHEDULER_RAN_COUNT = 0;
+
+    TestStart("Scheduler - Fixed rate");
+    TestStepDone();
+    if(scheduler._Handle() != Execution::Unecessary)
+    {
+        TestFailed("An empty scheduler ran something.");
+        return Execution::Failed;
+    }
+
+    // Both are due right away. The first added runs first.
+    TestStepDone();
+    scheduler.AddTask(UT_SchedulerSlowTask, 1000, 100);
+    scheduler.AddTask(UT_SchedulerFastTask, 500, NO_TASK_BUDGET);
+    if(scheduler._Handle() != Execution::Passed || UT_SCHEDULER_RAN_COUNT != 2 || UT_SCHEDULER_RAN[0] != 0 || UT_SCHEDULER_RAN[1] != 1)
+    {
+        TestFailed("Tasks did not run in the order they were added.");
+        TestExpectedVSGotten("2", std::to_string(UT_SCHEDULER_RAN_COUNT).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    scheduler.GetTask(1, &fast);
+    if(scheduler._Handle() != Execution::Bypassed || fast.lastJitter != 50 || fast.lastRuntime != UT_SCHEDULER_FAST_RUNTIME)
+    {
+        TestFailed("Wrong fast task measures.");
+        TestExpectedVSGotten("50", std::to_string(fast.lastJitter).c_str());
+        return Execution::Failed;
+    }
+
+    // Only the fast one is due, 20 us late.
+    TestStepDone();
+    UT_SCHEDULER_NOW = base + 520;
+    scheduler._Handle();
+    scheduler.GetTask(1, &fast);
+    if(UT_SCHEDULER_RAN_COUNT != 3 || UT_SCHEDULER_RAN[2] != 1 || fast.lastJitter != 20)
+    {
+        TestFailed("The fast task did not run alone.");
+        TestExpectedVSGotten("20", std::to_string(fast.lastJitter).c_str());
+        return Execution::Failed;
+    }
+
+    // The slow one goes over its budget and delays the fast one. The clock wraps meanwhile.
+    TestStepDone();
+    UT_SCHEDULER_SLOW_RUNTIME = 300;
+    UT_SCHEDULER_NOW = base + 1000;
+    scheduler._Handle();
+    scheduler.GetTask(0, &slow);
+    scheduler.GetTask(1, &fast);
+    if(UT_SCHEDULER_RAN_COUNT != 5 || slow.overruns != 1 || slow.longestRuntime != 300 || fast.lastJitter != 300 || fast.worstJitter != 300)
+    {
+        TestFailed("The overrun was not measured.");
+        TestExpectedVSGotten("300", std::to_string(fast.lastJitter).c_str());
+        return Execution::Failed;
+    }
+
+    // Fixed rate: the fast one is still due at base + 1500, not 500 us after it ran.
+    TestStepDone();
+    UT_SCHEDULER_NOW = base + 1499;
+    if(scheduler._Handle() != Execution::Bypassed)
+    {
+        TestFailed("The fast task drifted early.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    UT_SCHEDULER_NOW = base + 1500;
+    if(scheduler._Handle() != Execution::Passed || UT_SCHEDULER_RAN_COUNT != 6)
+    {
+        TestFailed("The fast task drifted late.");
+        return Execution::Failed;
+    }
+
+    // Long stall: periods that went by are skipped, not caught up on.
+    TestStepDone();
+    UT_SCHEDULER_NOW = base + 3600;
+    scheduler._Handle();
+    scheduler.GetTask(0, &slow);
+    scheduler.GetTask(1, &fast);
+    if(UT_SCHEDULER_RAN_COUNT != 8 || slow.skippedPeriods != 1 || slow.lastJitter != 600 || fast.skippedPeriods != 3 || fast.lastJitter != 400)
+    {
+        TestFailed("Skipped periods were not measured.");
+        TestExpectedVSGotten("3", std::to_string(fast.skippedPeriods).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(slow.runs != 3 || slow.overruns != 2 || slow.totalRuntime != 650 || fast.runs != 5 || fast.totalRuntime != 5 * UT_SCHEDULER_FAST_RUNTIME)
+    {
+        TestFailed("Wrong task counters.");
+        TestExpectedVSGotten("3", std::to_string(slow.runs).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    scheduler.ResetStatistics();
+    scheduler.GetTask(0, &slow);
+    if(slow.runs != 0 || slow.overruns != 0 || slow.worstJitter != 0 || slow.period != 1000)
+    {
+        TestFailed("Statistics were not reset.");
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if event driven tasks
+ * only run once signaled, and if the time
+ * until the next task is right.
+ * 
+ * @return Execution 
+ */
+Execution TEST_SCHEDULER_Events()
+{
+    cScheduler scheduler(UT_SchedulerClock);
+    cTask event;
+    unsigned long idleTime = 0;
+    unsigned long base = 1000;
+
+    UT_SCHEDULER_NOW = base;
+    UT_SCHEDULER_RAN_COUNT = 0;
+
+    TestStart("Scheduler - Events");
+    TestStepDone();
+    if(scheduler.GetTimeUntilNextTask(&idleTime) != Execution::Unecessary)
+    {
+        TestFailed("An empty scheduler had a task due.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    scheduler.AddTask(UT_SchedulerEventTask, EVENT_DRIVEN_TASK, 100);
+    scheduler.AddTask(UT_SchedulerFastTask, 500, NO_TASK_BUDGET);
+    if(scheduler.Signal(1) != Execution::Failed || scheduler.Signal(2) != Execution::Failed)
+    {
+        TestFailed("A periodic or missing task was signaled.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    scheduler._Handle();
+    if(UT_SCHEDULER_RAN_COUNT != 1 || UT_SCHEDULER_RAN[0] != 1)
+    {
+        TestFailed("An event driven task ran unsignaled.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(scheduler.GetTimeUntilNextTask(&idleTime) != Execution::Passed || idleTime != 500 - UT_SCHEDULER_FAST_RUNTIME)
+    {
+        TestFailed("Wrong time until the next task.");
+        TestExpectedVSGotten(std::to_string(500 - UT_SCHEDULER_FAST_RUNTIME).c_str(), std::to_string(idleTime).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    UT_SCHEDULER_NOW = base + 100;
+    if(scheduler.Signal(0) != Execution::Passed || scheduler.Signal(0) != Execution::Unecessary || scheduler.GetTimeUntilNextTask(&idleTime) != Execution::Passed || idleTime != 0)
+    {
+        TestFailed("The signaled task is not due.");
+        return Execution::Failed;
+    }
+
+    // It ran once, 30 us after its event.
+    TestStepDone();
+    UT_SCHEDULER_NOW = base + 130;
+    scheduler._Handle();
+    scheduler.GetTask(0, &event);
+    if(scheduler._Handle() != Execution::Bypassed || UT_SCHEDULER_RAN_COUNT != 2 || UT_SCHEDULER_RAN[1] != 2 || event.runs != 1 || event.lastJitter != 30)
+    {
+        TestFailed("The signaled task did not run once.");
+        TestExpectedVSGotten("30", std::to_string(event.lastJitter).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    while(scheduler.GetTaskCount() < MAX_SCHEDULED_TASKS)
+    {
+        scheduler.AddTask(UT_SchedulerEventTask, EVENT_DRIVEN_TASK, NO_TASK_BUDGET);
+    }
+    if(scheduler.AddTask(UT_SchedulerEventTask, EVENT_DRIVEN_TASK, NO_TASK_BUDGET) != Execution::Failed || scheduler.GetTask(MAX_SCHEDULED_TASKS, &event) != Execution::Failed)
+    {
+        TestFailed("A full scheduler took another task.");
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if scheduler works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cScheduler_LaunchTests()
+{
+    StartOfUnitTest("class cScheduler");
+    Execution result;
+
+    result = TEST_SCHEDULER_FixedRate();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_SCHEDULER_Events();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    UnitTestPassed();
+    return Execution::Passed;
+}
@@ -0,0 +1,145 @@
+/**
+ * @file _UNIT_TEST_Terminal.h
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the Terminal class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+
+
+#include "Globals.h"
+
+#ifndef TERMINAL_UNIT_TEST_H
+  #define TERMINAL_UNIT_TEST_H
+
+/**
+ * @brief Function that returns
+ * execution::passed if a valid plane
+ * given chunk by chunk lands already
+ * indexed, and if the terminal swaps
+ * arrival runways for the next one.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Arrival();
+/**
+ * @brief Function that returns
+ * execution::passed if planes with a
+ * wrong check, stray chunks, empty
+ * parameters and cut off planes are
+ * all dropped.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Drops();
+/**
+ * @brief Function that returns
+ * execution::passed if _HandleUARTArrival
+ * lands the same plane sent unpacked,
+ * packed and protected.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_WireModes();
+/**
+ * @brief Function that returns
+ * execution::passed if cut-through gates
+ * get each segment while the plane lands
+ * and only commit it once its check chunk
+ * is verified.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_CutThrough();
+/**
+ * @brief Function that returns
+ * execution::passed if the departure
+ * taxiway keeps the order of each lane,
+ * lets priority planes go first, refuses
+ * duplicates and counts taxiing times.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Taxiway();
+/**
+ * @brief Function that returns
+ * execution::passed if cDepartureRunway
+ * sends whole planes in every wire mode
+ * without writing more than the stream's
+ * TX FIFO accepts.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_DepartureRunway();
+/**
+ * @brief Function that returns
+ * execution::passed if cArrivalRunway
+ * hands every received byte to the
+ * terminal in order, even when its ring
+ * wraps, stalls or overflows.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_ArrivalRunway();
+/**
+ * @brief Function that returns
+ * execution::passed if landed planes
+ * are routed to the gate docked for
+ * their ID, and if unsupported IDs are
+ * answered with a HandlingError plane
+ * without touching any gate.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Dispatch();
+/**
+ * @brief Function that returns
+ * execution::passed if tagged requests
+ * of one gate can be in flight together,
+ * if the docked gate answers each with
+ * its request's tag, if those answers are
+ * matched by tag in any order and if
+ * untagged or stray answers are refused.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_SequenceTags();
+/**
+ * @brief Function that returns
+ * execution::passed if a request sent
+ * through the master terminal docks on
+ * the slave terminal and if the gate's
+ * answer departs from it back to the
+ * master terminal.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Answers();
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if terminal works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cTerminal_LaunchTests();
+
+
+#endif
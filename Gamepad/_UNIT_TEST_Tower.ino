@@ -0,0 +1,226 @@
+/**
+ * @file _UNIT_TEST_Tower.ino
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the Tower class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ## 
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+
+
+#include "Globals.h"
+
+/// @brief Owners woken by UT_TowerExpiry, in order.
+void* UT_TOWER_WOKEN[MAX_TOWER_DEADLINES];
+int UT_TOWER_WOKEN_COUNT = 0;
+
+/// @brief DeadlineCallback that only remembers who was woken.
+void UT_TowerExpiry(void* owner)
+{
+    UT_TOWER_WOKEN[UT_TOWER_WOKEN_COUNT++] = owner;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if deadlines expire
+ * closest first, only once their time
+ * came, even across a millis() wrap, and
+ * if they can be replaced or cancelled.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TOWER_Deadlines()
+{
+    cTower tower;
+    int owners[MAX_TOWER_DEADLINES + 1];
+    // 10 ms before millis() wraps around.
+    unsigned long base = (unsigned long)0 - 10;
+
+    UT_TOWER_WOKEN_COUNT = 0;
+
+    TestStart("Tower - Deadlines");
+    TestStepDone();
+    if(tower._Handle(base) != Execution::Unecessary)
+    {
+        TestFailed("An empty tower had deadlines.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    tower.WatchUntil(&owners[0], UT_TowerExpiry, base + 30);
+    tower.WatchUntil(&owners[1], UT_TowerExpiry, base + 5);
+    tower.WatchUntil(&owners[2], UT_TowerExpiry, base + 20);
+    if(tower._Handle(base + 4) != Execution::Bypassed || UT_TOWER_WOKEN_COUNT != 0)
+    {
+        TestFailed("A deadline expired early.");
+        return Execution::Failed;
+    }
+
+    // The 2 closest deadlines expire, the second one after millis() wrapped.
+    TestStepDone();
+    if(tower._Handle(base + 20) != Execution::Passed || UT_TOWER_WOKEN_COUNT != 2 || UT_TOWER_WOKEN[0] != &owners[1] || UT_TOWER_WOKEN[1] != &owners[2])
+    {
+        TestFailed("Deadlines did not expire closest first.");
+        TestExpectedVSGotten("2", std::to_string(UT_TOWER_WOKEN_COUNT).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    tower.WatchUntil(&owners[0], UT_TowerExpiry, base + 100);
+    if(tower.GetWatchedCount() != 1 || tower._Handle(base + 30) != Execution::Bypassed)
+    {
+        TestFailed("Watching again did not replace the deadline.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(tower.Cancel(&owners[0]) != Execution::Passed || tower.Cancel(&owners[0]) != Execution::Unecessary || tower._Handle(base + 100) != Execution::Unecessary)
+    {
+        TestFailed("A cancelled deadline was kept.");
+        return Execution::Failed;
+    }
+
+    // Each deadline is forgotten once expired, in any order they were watched.
+    TestStepDone();
+    UT_TOWER_WOKEN_COUNT = 0;
+    for(int i=0; i<MAX_TOWER_DEADLINES; ++i)
+    {
+        tower.WatchUntil(&owners[i], UT_TowerExpiry, base + (unsigned long)((i * 7) % MAX_TOWER_DEADLINES));
+    }
+    if(tower.WatchUntil(&owners[MAX_TOWER_DEADLINES], UT_TowerExpiry, base) != Execution::Failed)
+    {
+        TestFailed("A full tower took another deadline.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    for(unsigned long now = 0; now < MAX_TOWER_DEADLINES; ++now)
+    {
+        tower._Handle(base + now);
+        if(UT_TOWER_WOKEN_COUNT != (int)now + 1)
+        {
+            TestFailed("Deadlines did not expire one by one.");
+            TestExpectedVSGotten(std::to_string(now + 1).c_str(), std::to_string(UT_TOWER_WOKEN_COUNT).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    if(tower.GetWatchedCount() != 0 || tower.expiredDeadlines != 2 + MAX_TOWER_DEADLINES)
+    {
+        TestFailed("Wrong tower counters.");
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if a gate whose plane
+ * does not come back in time is woken by
+ * the tower, and if a gate whose plane
+ * docked is forgotten.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TOWER_GateTimeout()
+{
+    cGate_Status gate;
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    int planeSize = 0;
+    int value = 0;
+    int watched = Tower.GetWatchedCount();
+    unsigned long departure = millis();
+
+    TestStart("Tower - Gate timeout");
+    TestStepDone();
+    gate.status = GateStatus::JustLeft;
+    gate._GetDepartingMasterPlane(plane, &planeSize);
+    if(Tower.GetWatchedCount() != watched + 1 || gate.Update() != Execution::Bypassed)
+    {
+        TestFailed("The departing plane is not watched.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    Tower._Handle(departure + gate.timeLeftForArrival - 1);
+    if(gate.status != GateStatus::AwaitingArrival || gate.Update() != Execution::Bypassed)
+    {
+        TestFailed("The gate timed out early.");
+        return Execution::Failed;
+    }
+
+    // Some slack since millis() may have moved since departure.
+    TestStepDone();
+    Tower._Handle(departure + gate.timeLeftForArrival + 100);
+    if(gate.status != GateStatus::ReadyForDeparture || gate.Update() != Execution::Failed || gate.Update() != Execution::Bypassed)
+    {
+        TestFailed("The gate was not woken when its plane was late.");
+        return Execution::Failed;
+    }
+
+    // This time the answer docks before the deadline.
+    TestStepDone();
+    departure = millis();
+    gate.status = GateStatus::JustLeft;
+    gate._GetDepartingMasterPlane(plane, &planeSize);
+    cPlane_Status::Encode(plane, 12);
+    gate._DockSlavePlaneArrival(STATUS_PLANE_ID, plane, cPlane_Status::size);
+    Tower._Handle(departure + gate.timeLeftForArrival + 100);
+    if(Tower.GetWatchedCount() != watched || gate.Read(&value) != Execution::Passed || value != 12 || gate.Update() != Execution::Bypassed)
+    {
+        TestFailed("A docked gate was still watched.");
+        TestExpectedVSGotten("12", std::to_string(value).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if tower works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cTower_LaunchTests()
+{
+    StartOfUnitTest("class cTower");
+    Execution result;
+
+    result = TEST_TOWER_Deadlines();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TOWER_GateTimeout();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    UnitTestPassed();
+    return Execution::Passed;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file Adafruit_NeoPixel.h
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host (Linux) stand-in for the
+ * Adafruit NeoPixel library. Colors are only
+ * kept in memory so tests can read them back.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef HOST_ADAFRUIT_NEOPIXEL_H
+  #define HOST_ADAFRUIT_NEOPIXEL_H
+
+#include "Arduino.h"
+
+#define NEO_GRB     0x52
+#define NEO_KHZ800  0x0000
+
+/**
+ * @brief Keeps one packed 0x00RRGGBB value
+ * per pixel. show() only counts how many
+ * times the strip would have been refreshed.
+ */
+class Adafruit_NeoPixel
+{
+    public:
+        Adafruit_NeoPixel(uint16_t count, int16_t pin, uint16_t type)
+            : _pixels(count, 0), _pin(pin), _type(type) {}
+
+        void begin() { _begun = true; }
+        void show() { _showCount++; }
+        void clear() { std::fill(_pixels.begin(), _pixels.end(), 0); }
+        void setBrightness(uint8_t brightness) { _brightness = brightness; }
+
+        void setPixelColor(uint16_t index, uint32_t color)
+        {
+            if(index < _pixels.size())
+            {
+                _pixels[index] = color;
+            }
+        }
+
+        void setPixelColor(uint16_t index, uint8_t red, uint8_t green, uint8_t blue)
+        {
+            setPixelColor(index, Color(red, green, blue));
+        }
+
+        uint32_t getPixelColor(uint16_t index) const
+        {
+            return (index < _pixels.size()) ? _pixels[index] : 0;
+        }
+
+        uint16_t numPixels() const { return (uint16_t)_pixels.size(); }
+
+        static uint32_t Color(uint8_t red, uint8_t green, uint8_t blue)
+        {
+            return ((uint32_t)red << 16) | ((uint32_t)green << 8) | blue;
+        }
+
+        /// @brief How many times show() was called. Host only.
+        unsigned long HostShowCount() const { return _showCount; }
+
+    private:
+        std::vector<uint32_t> _pixels;
+        int16_t _pin;
+        uint16_t _type;
+        uint8_t _brightness = 255;
+        bool _begun = false;
+        unsigned long _showCount = 0;
+};
+
+#endif
@@ -0,0 +1,513 @@
+/**
+ * @file Arduino.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Core of the host Arduino stand-in
+ * declared in Arduino.h
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Arduino.h"
+#include <cstdio>
+
+HardwareSerial Serial;
+
+namespace
+{
+    int _analogValues[HOST_GPIO_COUNT];
+    const int* _analogTraces[HOST_GPIO_COUNT];
+    int _analogTraceLeft[HOST_GPIO_COUNT];
+    int _digitalValues[HOST_GPIO_COUNT];
+    int _pinModes[HOST_GPIO_COUNT];
+    bool _pinsInitialised = false;
+    unsigned long long _virtualMicros = 0;
+
+    uint8_t _adcPins[HOST_ADC_CONTINUOUS_MAX_PINS];
+    size_t _adcPinCount = 0;
+    uint32_t _adcConversionsPerPin = 0;
+    unsigned long long _adcFramePeriod = 0;
+    unsigned long long _adcNextFrameAt = 0;
+    void (*_adcCallback)(void) = nullptr;
+    bool _adcRunning = false;
+    bool _adcFrameReady = false;
+    bool _adcInCallback = false;
+    unsigned long _adcLostFrames = 0;
+    adc_continuous_data_t _adcFrame[HOST_ADC_CONTINUOUS_MAX_PINS];
+
+    void _InitialisePins()
+    {
+        if(_pinsInitialised)
+        {
+            return;
+        }
+
+        for(int pin = 0; pin < HOST_GPIO_COUNT; pin++)
+        {
+            _analogValues[pin] = HOST_DEFAULT_ANALOG_VALUE;
+            _analogTraces[pin] = nullptr;
+            _analogTraceLeft[pin] = 0;
+            _digitalValues[pin] = LOW;
+            _pinModes[pin] = INPUT;
+        }
+        _pinsInitialised = true;
+    }
+}
+
+#pragma region Print
+size_t Print::write(const uint8_t* buffer, size_t size)
+{
+    size_t written = 0;
+    for(size_t index = 0; index < size; index++)
+    {
+        written += write(buffer[index]);
+    }
+    return written;
+}
+
+size_t Print::write(const char* text)
+{
+    if(text == nullptr)
+    {
+        return 0;
+    }
+    return write(reinterpret_cast<const uint8_t*>(text), strlen(text));
+}
+
+size_t Print::write(const char* buffer, size_t size)
+{
+    return write(reinterpret_cast<const uint8_t*>(buffer), size);
+}
+
+int Print::availableForWrite()
+{
+    return 0;
+}
+
+size_t Print::_PrintNumber(unsigned long long value, bool negative, int base)
+{
+    char buffer[8 * sizeof(unsigned long long) + 2];
+    char* cursor = &buffer[sizeof(buffer) - 1];
+    *cursor = '\0';
+
+    if(base < 2)
+    {
+        base = DEC;
+    }
+
+    do
+    {
+        unsigned long long digit = value % base;
+        value = value / base;
+        *--cursor = (char)(digit < 10 ? '0' + digit : 'A' + digit - 10);
+    } while(value != 0);
+
+    if(negative)
+    {
+        *--cursor = '-';
+    }
+    return write(cursor);
+}
+
+size_t Print::print(const char text[])                        { return write(text); }
+size_t Print::print(char value)                               { return write((uint8_t)value); }
+size_t Print::print(unsigned char value, int base)            { return _PrintNumber(value, false, base); }
+size_t Print::print(int value, int base)                      { return print((long long)value, base); }
+size_t Print::print(unsigned int value, int base)             { return _PrintNumber(value, false, base); }
+size_t Print::print(long value, int base)                     { return print((long long)value, base); }
+size_t Print::print(unsigned long value, int base)            { return _PrintNumber(value, false, base); }
+size_t Print::print(unsigned long long value, int base)       { return _PrintNumber(value, false, base); }
+
+size_t Print::print(long long value, int base)
+{
+    if(base == DEC && value < 0)
+    {
+        return _PrintNumber(0ULL - (unsigned long long)value, true, base);
+    }
+    return _PrintNumber((unsigned long long)value, false, base);
+}
+
+size_t Print::print(double value, int digits)
+{
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", digits, value);
+    return write(buffer);
+}
+
+size_t Print::println()                                             { return write("\r\n"); }
+size_t Print::println(const char text[])                            { return print(text) + println(); }
+size_t Print::println(char value)                                   { return print(value) + println(); }
+size_t Print::println(unsigned char value, int base)                { return print(value, base) + println(); }
+size_t Print::println(int value, int base)                          { return print(value, base) + println(); }
+size_t Print::println(unsigned int value, int base)                 { return print(value, base) + println(); }
+size_t Print::println(long value, int base)                         { return print(value, base) + println(); }
+size_t Print::println(unsigned long value, int base)                { return print(value, base) + println(); }
+size_t Print::println(long long value, int base)                    { return print(value, base) + println(); }
+size_t Print::println(unsigned long long value, int base)           { return print(value, base) + println(); }
+size_t Print::println(double value, int digits)                     { return print(value, digits) + println(); }
+#pragma endregion
+
+#pragma region Stream
+size_t Stream::readBytes(uint8_t* buffer, size_t length)
+{
+    size_t count = 0;
+    while(count < length && available() > 0)
+    {
+        buffer[count++] = (uint8_t)read();
+    }
+    return count;
+}
+
+size_t Stream::readBytes(char* buffer, size_t length)
+{
+    return readBytes(reinterpret_cast<uint8_t*>(buffer), length);
+}
+#pragma endregion
+
+#pragma region HostStream
+HostStream::HostStream()
+{
+}
+
+void HostStream::begin(unsigned long baud)
+{
+    _baud = baud;
+    _started = true;
+}
+
+void HostStream::end()
+{
+    _started = false;
+}
+
+HostStream::operator bool() const
+{
+    return true;
+}
+
+int HostStream::available()
+{
+    return (int)_received.size();
+}
+
+int HostStream::read()
+{
+    if(_received.empty())
+    {
+        return -1;
+    }
+    uint8_t value = _received.front();
+    _received.pop_front();
+    return value;
+}
+
+int HostStream::peek()
+{
+    if(_received.empty())
+    {
+        return -1;
+    }
+    return _received.front();
+}
+
+size_t HostStream::write(uint8_t value)
+{
+    return write(&value, 1);
+}
+
+size_t HostStream::write(const uint8_t* buffer, size_t size)
+{
+    if(_fifoSize != 0)
+    {
+        size_t space = _fifoSize - _fifoUsed;
+        if(size > space)
+        {
+            size = space;
+        }
+        _fifoUsed += size;
+    }
+    _transmitted.insert(_transmitted.end(), buffer, buffer + size);
+    return size;
+}
+
+int HostStream::availableForWrite()
+{
+    if(_fifoSize == 0)
+    {
+        return HOST_UART_FIFO_SIZE;
+    }
+    return (int)(_fifoSize - _fifoUsed);
+}
+
+void HostStream::HostInject(const uint8_t* bytes, size_t size)
+{
+    _received.insert(_received.end(), bytes, bytes + size);
+}
+
+std::vector<uint8_t> HostStream::HostTakeTransmitted()
+{
+    std::vector<uint8_t> result;
+    result.swap(_transmitted);
+    return result;
+}
+
+void HostStream::HostDrainFifo(size_t size)
+{
+    _fifoUsed = (size >= _fifoUsed) ? 0 : _fifoUsed - size;
+}
+
+void HostStream::HostSetFifoSize(size_t size)
+{
+    _fifoSize = size;
+    _fifoUsed = 0;
+}
+
+void HostStream::HostClear()
+{
+    _received.clear();
+    _transmitted.clear();
+    _fifoUsed = 0;
+}
+#pragma endregion
+
+#pragma region HardwareSerial
+size_t HardwareSerial::write(uint8_t value)
+{
+    return write(&value, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t* buffer, size_t size)
+{
+    return fwrite(buffer, 1, size, stdout);
+}
+#pragma endregion
+
+#pragma region GPIO
+void pinMode(uint8_t pin, uint8_t mode)
+{
+    _InitialisePins();
+    if(pin < HOST_GPIO_COUNT)
+    {
+        _pinModes[pin] = mode;
+    }
+}
+
+int digitalRead(uint8_t pin)
+{
+    _InitialisePins();
+    return (pin < HOST_GPIO_COUNT) ? _digitalValues[pin] : LOW;
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+    _InitialisePins();
+    if(pin < HOST_GPIO_COUNT)
+    {
+        _digitalValues[pin] = value ? HIGH : LOW;
+    }
+}
+
+int analogRead(uint8_t pin)
+{
+    _InitialisePins();
+    if(pin >= HOST_GPIO_COUNT)
+    {
+        return 0;
+    }
+
+    if(_analogTraceLeft[pin] > 0)
+    {
+        _analogValues[pin] = *_analogTraces[pin]++;
+        _analogTraceLeft[pin]--;
+    }
+    return _analogValues[pin];
+}
+
+void HostSetAnalogValue(uint8_t pin, int value)
+{
+    _InitialisePins();
+    if(pin < HOST_GPIO_COUNT)
+    {
+        _analogValues[pin] = value;
+        _analogTraceLeft[pin] = 0;
+    }
+}
+
+void HostSetAnalogTrace(uint8_t pin, const int* samples, int count)
+{
+    _InitialisePins();
+    if(pin < HOST_GPIO_COUNT)
+    {
+        _analogTraces[pin] = samples;
+        _analogTraceLeft[pin] = count;
+    }
+}
+
+void HostSetDigitalValue(uint8_t pin, int value)
+{
+    digitalWrite(pin, (uint8_t)value);
+}
+
+int HostGetPinMode(uint8_t pin)
+{
+    _InitialisePins();
+    return (pin < HOST_GPIO_COUNT) ? _pinModes[pin] : -1;
+}
+#pragma endregion
+
+#pragma region Continuous ADC
+bool analogContinuous(const uint8_t pins[], size_t pins_count, uint32_t conversions_per_pin, uint32_t sampling_freq_hz, void (*userFunc)(void))
+{
+    if(pins_count == 0 || pins_count > HOST_ADC_CONTINUOUS_MAX_PINS || conversions_per_pin == 0 || sampling_freq_hz == 0)
+    {
+        return false;
+    }
+
+    memcpy(_adcPins, pins, pins_count);
+    _adcPinCount = pins_count;
+    _adcConversionsPerPin = conversions_per_pin;
+    _adcFramePeriod = (1000000ULL * pins_count * conversions_per_pin) / sampling_freq_hz;
+    _adcFramePeriod = _adcFramePeriod == 0 ? 1 : _adcFramePeriod;
+    _adcCallback = userFunc;
+    _adcRunning = false;
+    _adcFrameReady = false;
+    return true;
+}
+
+bool analogContinuousStart()
+{
+    if(_adcPinCount == 0)
+    {
+        return false;
+    }
+    _adcRunning = true;
+    _adcNextFrameAt = _virtualMicros + _adcFramePeriod;
+    return true;
+}
+
+bool analogContinuousStop()
+{
+    _adcRunning = false;
+    return true;
+}
+
+bool analogContinuousDeinit()
+{
+    _adcRunning = false;
+    _adcPinCount = 0;
+    _adcCallback = nullptr;
+    return true;
+}
+
+bool analogContinuousRead(adc_continuous_data_t** buffer, uint32_t timeout_ms)
+{
+    if(!_adcFrameReady)
+    {
+        return false;
+    }
+    _adcFrameReady = false;
+    *buffer = _adcFrame;
+    return true;
+}
+
+unsigned long HostGetLostAdcFrames()
+{
+    return _adcLostFrames;
+}
+
+namespace
+{
+    /// @brief Converts a frame at the current virtual time, then calls the ISR.
+    void _CompleteAdcFrame()
+    {
+        for(size_t index = 0; index < _adcPinCount; index++)
+        {
+            int sum = 0;
+            for(uint32_t conversion = 0; conversion < _adcConversionsPerPin; conversion++)
+            {
+                sum += analogRead(_adcPins[index]);
+            }
+            _adcFrame[index].pin = _adcPins[index];
+            _adcFrame[index].channel = (uint8_t)index;
+            _adcFrame[index].avg_read_raw = sum / (int)_adcConversionsPerPin;
+            _adcFrame[index].avg_read_mvolts = (_adcFrame[index].avg_read_raw * 3100) / 4095;
+        }
+
+        if(_adcFrameReady)
+        {
+            _adcLostFrames++;
+        }
+        _adcFrameReady = true;
+
+        if(_adcCallback != nullptr)
+        {
+            _adcInCallback = true;
+            _adcCallback();
+            _adcInCallback = false;
+        }
+    }
+
+    /**
+     * @brief Moves the virtual clock forward,
+     * stopping at each ADC frame that completes
+     * on the way, like its interrupt would.
+     */
+    void _AdvanceMicros(unsigned long long microseconds)
+    {
+        unsigned long long target = _virtualMicros + microseconds;
+
+        // A delay from inside the ISR does not run other frames.
+        while(_adcRunning && !_adcInCallback && _adcNextFrameAt <= target)
+        {
+            _virtualMicros = _adcNextFrameAt;
+            _adcNextFrameAt += _adcFramePeriod;
+            _CompleteAdcFrame();
+        }
+        _virtualMicros = target > _virtualMicros ? target : _virtualMicros;
+    }
+}
+#pragma endregion
+
+#pragma region Time
+unsigned long millis()
+{
+    return (unsigned long)(_virtualMicros / 1000ULL);
+}
+
+unsigned long micros()
+{
+    return (unsigned long)_virtualMicros;
+}
+
+void delay(unsigned long milliseconds)
+{
+    _AdvanceMicros((unsigned long long)milliseconds * 1000ULL);
+}
+
+void delayMicroseconds(unsigned int microseconds)
+{
+    _AdvanceMicros(microseconds);
+}
+
+void HostAdvanceMicros(unsigned long long microseconds)
+{
+    _AdvanceMicros(microseconds);
+}
+
+void HostResetClock()
+{
+    _virtualMicros = 0;
+    _adcNextFrameAt = _adcFramePeriod;
+}
+#pragma endregion
@@ -0,0 +1,282 @@
+/**
+ * @file Arduino.h
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host (Linux) stand-in for the
+ * Arduino core used by the ESP32-S3 build.
+ * It only provides what the BFIO sketches
+ * actually use: Print, Stream, Serial,
+ * GPIO reads, the continuous ADC and a
+ * virtual clock.
+ *
+ * @attention
+ * This file is never part of the firmware.
+ * It is only found by the compiler when the
+ * project is built through the CMake host
+ * build. See Host/README.md.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef HOST_ARDUINO_H
+  #define HOST_ARDUINO_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+using std::abs;
+using std::isinf;
+using std::isnan;
+using std::max;
+using std::min;
+
+//=============================================//
+//	Defines
+//=============================================//
+#define HIGH 0x1
+#define LOW  0x0
+
+#define INPUT         0x01
+#define OUTPUT        0x03
+#define INPUT_PULLUP  0x05
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+
+/// @brief Amount of GPIO the host shim keeps values for. The S3 has 49.
+#define HOST_GPIO_COUNT 64
+/// @brief Value analogRead returns until a test sets one. Middle of the 12 bits ADC.
+#define HOST_DEFAULT_ANALOG_VALUE 2048
+/// @brief Most pins the continuous ADC scans. ADC1 of the S3 has 10 channels.
+#define HOST_ADC_CONTINUOUS_MAX_PINS 10
+/// @brief ISR functions are placed in IRAM on the ESP32. Nothing to do on the host.
+#define ARDUINO_ISR_ATTR
+/// @brief Size of the TX FIFO reported by availableForWrite. Matches the S3's UART FIFO.
+#define HOST_UART_FIFO_SIZE 128
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+//=============================================//
+//	Classes
+//=============================================//
+/**
+ * @brief Host version of the Arduino Print
+ * class. Only the overloads used by the
+ * sketches are provided.
+ */
+class Print
+{
+    public:
+        virtual ~Print() {}
+
+        virtual size_t write(uint8_t value) = 0;
+        virtual size_t write(const uint8_t* buffer, size_t size);
+        size_t write(const char* text);
+        size_t write(const char* buffer, size_t size);
+
+        /// @brief How many bytes can be written without blocking.
+        virtual int availableForWrite();
+        virtual void flush() {}
+
+        size_t print(const char text[]);
+        size_t print(char value);
+        size_t print(unsigned char value, int base = DEC);
+        size_t print(int value, int base = DEC);
+        size_t print(unsigned int value, int base = DEC);
+        size_t print(long value, int base = DEC);
+        size_t print(unsigned long value, int base = DEC);
+        size_t print(long long value, int base = DEC);
+        size_t print(unsigned long long value, int base = DEC);
+        size_t print(double value, int digits = 2);
+
+        size_t println();
+        size_t println(const char text[]);
+        size_t println(char value);
+        size_t println(unsigned char value, int base = DEC);
+        size_t println(int value, int base = DEC);
+        size_t println(unsigned int value, int base = DEC);
+        size_t println(long value, int base = DEC);
+        size_t println(unsigned long value, int base = DEC);
+        size_t println(long long value, int base = DEC);
+        size_t println(unsigned long long value, int base = DEC);
+        size_t println(double value, int digits = 2);
+
+    private:
+        size_t _PrintNumber(unsigned long long value, bool negative, int base);
+};
+
+/**
+ * @brief Host version of the Arduino Stream
+ * class. Reading and writing is left to the
+ * derived classes.
+ */
+class Stream : public Print
+{
+    public:
+        virtual int available() = 0;
+        virtual int read() = 0;
+        virtual int peek() = 0;
+
+        size_t readBytes(uint8_t* buffer, size_t length);
+        size_t readBytes(char* buffer, size_t length);
+};
+
+/**
+ * @brief In memory stream used as the host
+ * replacement for UARTs. Bytes written by the
+ * sketch are kept in a TX buffer that tests can
+ * take. Bytes that tests inject are served
+ * back through read().
+ */
+class HostStream : public Stream
+{
+    public:
+        HostStream();
+
+        void begin(unsigned long baud);
+        void end();
+        operator bool() const;
+
+        int available() override;
+        int read() override;
+        int peek() override;
+        size_t write(uint8_t value) override;
+        size_t write(const uint8_t* buffer, size_t size) override;
+        int availableForWrite() override;
+        using Print::write;
+
+        /// @brief Queues bytes so the sketch receives them through read().
+        void HostInject(const uint8_t* bytes, size_t size);
+        /// @brief Returns and clears everything the sketch wrote.
+        std::vector<uint8_t> HostTakeTransmitted();
+        /**
+         * @brief Simulates the UART draining its
+         * TX FIFO. Each call frees that many bytes
+         * for availableForWrite.
+         */
+        void HostDrainFifo(size_t size);
+        /// @brief Sets how large the simulated TX FIFO is. 0 = never blocks.
+        void HostSetFifoSize(size_t size);
+        /// @brief Clears both directions.
+        void HostClear();
+
+    protected:
+        std::deque<uint8_t> _received;
+        std::vector<uint8_t> _transmitted;
+        size_t _fifoSize = 0;
+        size_t _fifoUsed = 0;
+        unsigned long _baud = 0;
+        bool _started = false;
+};
+
+/**
+ * @brief The debug UART. Everything written
+ * to it ends up on the host's standard output
+ * so unit test reports can be read in a terminal.
+ */
+class HardwareSerial : public HostStream
+{
+    public:
+        size_t write(uint8_t value) override;
+        size_t write(const uint8_t* buffer, size_t size) override;
+        using Print::write;
+};
+
+extern HardwareSerial Serial;
+
+//=============================================//
+//	Functions
+//=============================================//
+void pinMode(uint8_t pin, uint8_t mode);
+int digitalRead(uint8_t pin);
+void digitalWrite(uint8_t pin, uint8_t value);
+int analogRead(uint8_t pin);
+
+//=============================================//
+//	Continuous ADC
+//=============================================//
+/// @brief Same as the ESP32 core's. One per pin given to analogContinuous, in the same order.
+typedef struct
+{
+    uint8_t pin;
+    uint8_t channel;
+    int avg_read_raw;
+    int avg_read_mvolts;
+} adc_continuous_data_t;
+
+/**
+ * @brief Same as the ESP32 core's. The ADC is
+ * simulated on the virtual clock: each frame
+ * takes pins_count * conversions_per_pin
+ * conversions at sampling_freq_hz. When a frame
+ * completes, the clock is at that instant, each
+ * conversion is an analogRead of its pin and
+ * userFunc is called as if from the ISR.
+ */
+bool analogContinuous(const uint8_t pins[], size_t pins_count, uint32_t conversions_per_pin, uint32_t sampling_freq_hz, void (*userFunc)(void));
+bool analogContinuousStart();
+bool analogContinuousStop();
+bool analogContinuousDeinit();
+/**
+ * @brief Same as the ESP32 core's. Gives the
+ * averages of the last completed frame, once.
+ * Like the DMA pool, it only holds one frame:
+ * frames not read before the next one are lost.
+ * @return false if no frame completed since the last read.
+ */
+bool analogContinuousRead(adc_continuous_data_t** buffer, uint32_t timeout_ms);
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long milliseconds);
+void delayMicroseconds(unsigned int microseconds);
+
+//=============================================//
+//	Host controls
+//=============================================//
+/// @brief Sets the value analogRead will return for that pin.
+void HostSetAnalogValue(uint8_t pin, int value);
+/**
+ * @brief Has analogRead return samples one by
+ * one for that pin, like a recorded ADC trace.
+ * Once they all were read, the last one is kept.
+ * samples must outlive the replay.
+ */
+void HostSetAnalogTrace(uint8_t pin, const int* samples, int count);
+/// @brief Sets the value digitalRead will return for that pin.
+void HostSetDigitalValue(uint8_t pin, int value);
+/// @brief Returns the last mode given to pinMode for that pin.
+int HostGetPinMode(uint8_t pin);
+/**
+ * @brief Moves the virtual clock forward.
+ * millis(), micros() and delay() all run on
+ * that clock so host runs are deterministic.
+ */
+void HostAdvanceMicros(unsigned long long microseconds);
+/// @brief Puts the virtual clock back to 0.
+void HostResetClock();
+/// @brief Amount of continuous ADC frames lost because they were not read in time.
+unsigned long HostGetLostAdcFrames();
+
+#endif
@@ -0,0 +1,59 @@
+/**
+ * @file SoftwareSerial.h
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host (Linux) stand-in for the
+ * EspSoftwareSerial library. The UART is
+ * an in memory HostStream so a test can play
+ * the other side of the cable.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef HOST_SOFTWARESERIAL_H
+  #define HOST_SOFTWARESERIAL_H
+
+#include "Arduino.h"
+
+#define SWSERIAL_8N1 0x1C
+
+namespace EspSoftwareSerial
+{
+    /**
+     * @brief Software UART. Pins and framing
+     * are remembered but otherwise ignored.
+     */
+    class UART : public HostStream
+    {
+        public:
+            using HostStream::begin;
+
+            void begin(unsigned long baud, int config, int8_t rxPin, int8_t txPin, bool invert)
+            {
+                HostStream::begin(baud);
+                _config = config;
+                _rxPin = rxPin;
+                _txPin = txPin;
+                _invert = invert;
+            }
+
+        private:
+            int _config = SWSERIAL_8N1;
+            int8_t _rxPin = -1;
+            int8_t _txPin = -1;
+            bool _invert = false;
+    };
+}
+
+#endif
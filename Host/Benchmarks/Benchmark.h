@@ -0,0 +1,97 @@
+/**
+ * @file Benchmark.h
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Tiny timing harness used by the host
+ * benchmarks. Each measurement runs a body a
+ * given amount of times and prints the time
+ * per operation and operations per second.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef HOST_BENCHMARK_H
+  #define HOST_BENCHMARK_H
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+/// @brief Amount of iterations used when none is given on the command line.
+#define BENCHMARK_DEFAULT_ITERATIONS 200000
+
+/**
+ * @brief Keeps the compiler from removing a
+ * value that the benchmark never uses.
+ */
+template <typename T>
+inline void BenchmarkKeep(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Gets the iteration count from the
+ * first command line argument, if any.
+ */
+inline long BenchmarkIterations(int argc, char** argv)
+{
+    if(argc > 1)
+    {
+        long iterations = strtol(argv[1], nullptr, 10);
+        if(iterations > 0)
+        {
+            return iterations;
+        }
+    }
+    return BENCHMARK_DEFAULT_ITERATIONS;
+}
+
+/**
+ * @brief Runs body iterations times and
+ * prints one line of results.
+ * @param name
+ * Shown at the start of the line.
+ * @param iterations
+ * How many times body is called.
+ * @param itemsPerCall
+ * How many items (chunks, bytes, samples) one
+ * call handles. Used for the items/s column.
+ * @return Nanoseconds per call.
+ */
+template <typename Body>
+inline double Benchmark(const char* name, long iterations, long itemsPerCall, Body body)
+{
+    // Warm up caches and branch predictors.
+    for(long i = 0; i < iterations / 10 + 1; ++i)
+    {
+        body();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for(long i = 0; i < iterations; ++i)
+    {
+        body();
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    double totalNs = std::chrono::duration<double, std::nano>(stop - start).count();
+    double nsPerCall = totalNs / (double)iterations;
+    double itemsPerSecond = (itemsPerCall * 1e9) / nsPerCall;
+
+    printf("%-44s %12.1f ns/op %16.0f items/s\n", name, nsPerCall, itemsPerSecond);
+    return nsPerCall;
+}
+
+#endif
@@ -0,0 +1,179 @@
+/**
+ * @file Benchmark_Joystick.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host benchmark of the joystick's axis
+ * math. Compares the fixed point deadzone and
+ * trim cJoystick applies on each sample with the
+ * double precision version it replaced, after
+ * checking both give the same axis within 1 LSB
+ * for every axis, deadzone and trim.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Sketch.h"
+#include "Benchmark.h"
+
+/// @brief Amount of axis values an ADC sample can become. analogRead gives 12 bits.
+#define BENCH_AXIS_COUNT 4096
+/// @brief Deadzone and trim used for the timings.
+#define BENCH_DEADZONE 100
+#define BENCH_TRIM -37
+
+/// @brief The double precision deadzone, as CalculateJoystickAxisDeadzone was.
+static int DoubleDeadzone(int axis, int Deadzone)
+{
+    if(Deadzone <= 0 || (axis <= Deadzone && axis >= -Deadzone))
+    {
+        return Deadzone <= 0 ? axis : _JOY_MID_VAL;
+    }
+
+    double maxAxisWithDeadzone = _JOY_MAX_VAL - (double) Deadzone;
+    double currentAxis = ((double)axis * maxAxisWithDeadzone) / _JOY_MAX_VAL;
+    if(axis < 0)
+    {
+        currentAxis = currentAxis + (double) Deadzone;
+    }
+    else
+    {
+        currentAxis = currentAxis - (double) Deadzone;
+    }
+    return (int)currentAxis;
+}
+
+/// @brief The double precision trim, as CalculateJoystickAxisTrim was.
+static int DoubleTrim(int axis, int Trim)
+{
+    if(Trim == 0)
+    {
+        return axis;
+    }
+    if(axis == _JOY_MID_VAL)
+    {
+        return Trim;
+    }
+
+    double trim = (double)Trim;
+    double maxValue = Trim > 0 ? _JOY_MAX_VAL - trim : _JOY_MAX_VAL + trim;
+    return (int)((((double)axis * maxValue) / _JOY_MAX_VAL) + trim);
+}
+
+int main(int argc, char** argv)
+{
+    long iterations = BenchmarkIterations(argc, argv);
+    cJoystickAxisCoefficients coefficients;
+    int worstDifference = 0;
+
+    // Every axis an ADC sample can become, every deadzone and trim the setters document.
+    for(int deadzone = 0; deadzone <= 127; deadzone++)
+    {
+        for(int trim = -127; trim <= 127; trim++)
+        {
+            CalculateJoystickAxisCoefficients(deadzone, trim, &coefficients);
+            for(int axis = _JOY_MIN_VAL; axis < _JOY_MAX_VAL; axis++)
+            {
+                int fixedAxis = axis;
+                ApplyJoystickAxisCoefficients(&fixedAxis, &coefficients);
+                int difference = abs(fixedAxis - DoubleTrim(DoubleDeadzone(axis, deadzone), trim));
+                if(difference > worstDifference)
+                {
+                    worstDifference = difference;
+                }
+            }
+        }
+    }
+
+    if(worstDifference > 1)
+    {
+        printf("The fixed point axis is %d LSB away from the double one\n", worstDifference);
+        return 1;
+    }
+
+    printf("Joystick axis benchmark (%ld iterations, fixed point is at most %d LSB from double)\n", iterations, worstDifference);
+
+    int axes[BENCH_AXIS_COUNT];
+    for(int index = 0; index < BENCH_AXIS_COUNT; index++)
+    {
+        axes[index] = index + _JOY_MIN_VAL;
+    }
+    long sweepIterations = iterations / 100 + 1;
+
+    Benchmark("Double deadzone + trim (4096 samples)", sweepIterations, BENCH_AXIS_COUNT, [&]()
+    {
+        int sum = 0;
+        for(int index = 0; index < BENCH_AXIS_COUNT; index++)
+        {
+            sum += DoubleTrim(DoubleDeadzone(axes[index], BENCH_DEADZONE), BENCH_TRIM);
+        }
+        BenchmarkKeep(sum);
+    });
+
+    CalculateJoystickAxisCoefficients(BENCH_DEADZONE, BENCH_TRIM, &coefficients);
+    Benchmark("Q15 deadzone + trim (4096 samples)", sweepIterations, BENCH_AXIS_COUNT, [&]()
+    {
+        int sum = 0;
+        for(int index = 0; index < BENCH_AXIS_COUNT; index++)
+        {
+            int axis = axes[index];
+            ApplyJoystickAxisCoefficients(&axis, &coefficients);
+            sum += axis;
+        }
+        BenchmarkKeep(sum);
+    });
+
+    Benchmark("CalculateJoystickAxisCoefficients", iterations, 1, [&]()
+    {
+        static int trim = 0;
+        CalculateJoystickAxisCoefficients(BENCH_DEADZONE, (trim++ & 0xFF) - 127, &coefficients);
+        BenchmarkKeep(coefficients);
+    });
+
+    static short table[JOYSTICK_RESPONSE_TABLE_SIZE];
+    cJoystickResponse response;
+    response.curve = JOYSTICK_CURVE_EXPO;
+    BuildJoystickResponseTable(BENCH_DEADZONE, BENCH_TRIM, &response, table);
+    Benchmark("Expo response table lookup (4096 samples)", sweepIterations, BENCH_AXIS_COUNT, [&]()
+    {
+        int sum = 0;
+        for(int index = 0; index < BENCH_AXIS_COUNT; index++)
+        {
+            sum += table[axes[index] - _JOY_MIN_VAL];
+        }
+        BenchmarkKeep(sum);
+    });
+
+    cJoystickRadialDeadzone radial;
+    CalculateJoystickRadialDeadzone(BENCH_DEADZONE, &radial);
+    Benchmark("Radial deadzone (4096 pairs)", sweepIterations, BENCH_AXIS_COUNT, [&]()
+    {
+        int sum = 0;
+        for(int index = 0; index < BENCH_AXIS_COUNT; index++)
+        {
+            int x = axes[index];
+            int y = axes[BENCH_AXIS_COUNT - 1 - index];
+            cRadialDeadzoneStage::Process(&x, &y, &radial);
+            sum += x + y;
+        }
+        BenchmarkKeep(sum);
+    });
+
+    Benchmark("BuildJoystickResponseTable", iterations / 64 + 1, 1, [&]()
+    {
+        BuildJoystickResponseTable(BENCH_DEADZONE, BENCH_TRIM, &response, table);
+        BenchmarkKeep(table[0]);
+    });
+
+    return 0;
+}
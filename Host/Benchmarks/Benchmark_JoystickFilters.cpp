@@ -0,0 +1,286 @@
+/**
+ * @file Benchmark_JoystickFilters.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host bench of the joystick's noise
+ * filters. ADC traces are replayed through
+ * analogRead into each filter's pipeline, and
+ * the noise left, the changes reported while
+ * the axis is still and the latency added to
+ * its moves are printed for each of them.
+ *
+ * Without arguments, a synthetic trace is used:
+ * a still axis, a flick and a sweep, with ADC
+ * noise and spikes on top. Its truth is known,
+ * so latency can be measured. The first argument
+ * is the iteration count of the timings. Any
+ * following argument is a recorded trace: one
+ * raw ADC value per line, read at the rate of
+ * the inputs task.
+ *
+ * Fails if the calibrated mode's filter delays
+ * the flick by a sample or more.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Sketch.h"
+#include "Benchmark.h"
+#include <cmath>
+#include <vector>
+
+/// @brief Analog pin the traces are replayed on.
+#define BENCH_TRACE_PIN 1
+/// @brief Updates of each part of the synthetic trace.
+#define BENCH_STILL_UPDATES 4000
+#define BENCH_FLICK_UPDATES 200
+#define BENCH_SWEEP_UPDATES 64
+/// @brief Where the still axis rests and how far the flick goes, in ADC values.
+#define BENCH_STILL_ADC 2348
+#define BENCH_FLICK_ADC 3848
+/// @brief Updates the filters get to settle before being measured.
+#define BENCH_SETTLE_UPDATES 50
+/// @brief Standard deviation of the synthetic ADC noise, in LSB.
+#define BENCH_NOISE_LSB 6
+/// @brief One read in that many is a spike.
+#define BENCH_SPIKE_PERIOD 250
+#define BENCH_SPIKE_LSB 80
+
+/// @brief Deterministic noise, so every filter gets the same trace.
+static unsigned int benchSeed = 1;
+static int BenchRandom(int range)
+{
+    benchSeed = benchSeed * 1103515245 + 12345;
+    return (int)((benchSeed >> 16) % (unsigned int)(2 * range + 1)) - range;
+}
+
+/// @brief Roughly gaussian ADC noise with rare spikes.
+static int BenchNoise()
+{
+    int noise = 0;
+    for(int index = 0; index < 4; index++)
+    {
+        noise += BenchRandom(BENCH_NOISE_LSB * 173 / 100);
+    }
+    noise /= 2;
+    if(BenchRandom(BENCH_SPIKE_PERIOD) == 0)
+    {
+        noise += BenchRandom(1) < 0 ? -BENCH_SPIKE_LSB : BENCH_SPIKE_LSB;
+    }
+    return noise;
+}
+
+/// @brief What a filter did on a trace.
+struct cFilterResult
+{
+    double noiseRms = 0;
+    int stillChanges = 0;
+    double flickLatency = -1;
+    double sweepLag = 0;
+};
+
+/**
+ * @brief The axis each update of the synthetic
+ * trace should give, centered like the axes.
+ */
+static std::vector<int> BuildTruth()
+{
+    std::vector<int> truth;
+    for(int update = 0; update < BENCH_STILL_UPDATES; update++)
+    {
+        truth.push_back(BENCH_STILL_ADC - _JOY_MAX_VAL);
+    }
+    for(int update = 0; update < BENCH_FLICK_UPDATES; update++)
+    {
+        truth.push_back(BENCH_FLICK_ADC - _JOY_MAX_VAL);
+    }
+    for(int update = 0; update < BENCH_SWEEP_UPDATES; update++)
+    {
+        truth.push_back(BENCH_FLICK_ADC - _JOY_MAX_VAL - (update + 1) * (BENCH_FLICK_ADC - BENCH_STILL_ADC) / BENCH_SWEEP_UPDATES);
+    }
+    return truth;
+}
+
+/**
+ * @brief Replays trace through a pipeline, one
+ * Process per update, the way cJoystick does.
+ */
+template<class Pipeline>
+static std::vector<int> Replay(const std::vector<int>& trace, int updates)
+{
+    cJoystickAxis input;
+    std::vector<int> axes;
+
+    input.pin = BENCH_TRACE_PIN;
+    HostSetAnalogTrace(BENCH_TRACE_PIN, trace.data(), (int)trace.size());
+    for(int update = 0; update < updates; update++)
+    {
+        axes.push_back(Pipeline::Process(0, &input));
+    }
+    return axes;
+}
+
+/**
+ * @brief Runs a pipeline on the synthetic trace
+ * and measures it against the truth.
+ * @tparam ReadsPerUpdate
+ * ADC reads the pipeline takes per update.
+ */
+template<class Pipeline, int ReadsPerUpdate>
+static cFilterResult MeasureSynthetic(const std::vector<int>& truth)
+{
+    cFilterResult result;
+    std::vector<int> trace;
+
+    benchSeed = 1;
+    for(int axis : truth)
+    {
+        for(int read = 0; read < ReadsPerUpdate; read++)
+        {
+            trace.push_back(axis + _JOY_MAX_VAL + BenchNoise());
+        }
+    }
+    std::vector<int> axes = Replay<Pipeline>(trace, (int)truth.size());
+
+    double squares = 0;
+    for(int update = BENCH_SETTLE_UPDATES; update < BENCH_STILL_UPDATES; update++)
+    {
+        double error = axes[update] - truth[update];
+        squares += error * error;
+        result.stillChanges += axes[update] != axes[update - 1];
+    }
+    result.noiseRms = sqrt(squares / (BENCH_STILL_UPDATES - BENCH_SETTLE_UPDATES));
+
+    // When the axis went half way, minus when the truth did. Both are interpolated between updates.
+    int flickStart = BENCH_STILL_UPDATES;
+    double halfWay = (truth[flickStart - 1] + truth[flickStart]) / 2.0;
+    double truthHalfWay = flickStart - 0.5;
+    for(int update = flickStart; update < flickStart + BENCH_FLICK_UPDATES; update++)
+    {
+        if(axes[update] >= halfWay)
+        {
+            double axisHalfWay = (update - 1) + (halfWay - axes[update - 1]) / (axes[update] - axes[update - 1]);
+            result.flickLatency = axisHalfWay - truthHalfWay;
+            break;
+        }
+    }
+
+    // How many updates behind the sweep the axis is, on average.
+    int sweepStart = BENCH_STILL_UPDATES + BENCH_FLICK_UPDATES;
+    double slope = (double)(BENCH_FLICK_ADC - BENCH_STILL_ADC) / BENCH_SWEEP_UPDATES;
+    double lag = 0;
+    for(int update = sweepStart + BENCH_SWEEP_UPDATES / 4; update < sweepStart + BENCH_SWEEP_UPDATES; update++)
+    {
+        lag += (axes[update] - truth[update]) / slope;
+    }
+    result.sweepLag = lag / (BENCH_SWEEP_UPDATES - BENCH_SWEEP_UPDATES / 4);
+    return result;
+}
+
+static void PrintSynthetic(const char* name, cFilterResult result)
+{
+    printf("%-30s %9.2f LSB %10d %11.2f %11.2f\n", name, result.noiseRms, result.stillChanges, result.flickLatency, result.sweepLag);
+}
+
+/**
+ * @brief Runs a pipeline on a recorded trace.
+ * Its truth is unknown, so only how much the
+ * axis moves between updates is measured.
+ */
+template<class Pipeline, int ReadsPerUpdate>
+static void MeasureRecorded(const char* name, const std::vector<int>& trace)
+{
+    int updates = (int)trace.size() / ReadsPerUpdate;
+    std::vector<int> axes = Replay<Pipeline>(trace, updates);
+    int changes = 0;
+    double squares = 0;
+
+    for(int update = 1; update < updates; update++)
+    {
+        double step = axes[update] - axes[update - 1];
+        changes += step != 0;
+        squares += step * step;
+    }
+    printf("%-30s %9.2f LSB %10d\n", name, updates > 1 ? sqrt(squares / (updates - 1)) : 0.0, changes);
+}
+
+/// @brief Every pipeline compared, in print order. ReadsPerUpdate must match the read stage.
+#define BENCH_FOR_EACH_FILTER(Measure, ...) \
+    Measure<cJoystickPipeline<cReadAxisStage>, 1>("Raw read", ##__VA_ARGS__); \
+    Measure<cJoystickPipeline<cOversampleReadStage<JOYSTICK_OVERSAMPLING>>, JOYSTICK_OVERSAMPLING>("Oversampled", ##__VA_ARGS__); \
+    Measure<cJoystickPipeline<cOversampleReadStage<JOYSTICK_OVERSAMPLING>, cMovingAverageStage<2>>, JOYSTICK_OVERSAMPLING>("Oversampled + average of 2", ##__VA_ARGS__); \
+    Measure<cJoystickPipeline<cOversampleReadStage<JOYSTICK_OVERSAMPLING>, cMovingAverageStage<4>>, JOYSTICK_OVERSAMPLING>("Oversampled + average of 4", ##__VA_ARGS__); \
+    Measure<cJoystickPipeline<cOversampleReadStage<JOYSTICK_OVERSAMPLING>, cMedianOf3Stage>, JOYSTICK_OVERSAMPLING>("Oversampled + median of 3", ##__VA_ARGS__); \
+    Measure<cJoystickPipeline<cOversampleReadStage<JOYSTICK_OVERSAMPLING>, cJoystickNoiseFilterStage>, JOYSTICK_OVERSAMPLING>("Oversampled + adaptive", ##__VA_ARGS__);
+
+template<class Pipeline, int ReadsPerUpdate>
+static void MeasureAndPrint(const char* name, const std::vector<int>& truth)
+{
+    PrintSynthetic(name, MeasureSynthetic<Pipeline, ReadsPerUpdate>(truth));
+}
+
+/// @brief Nanoseconds a pipeline takes per update, on a constant ADC.
+template<class Pipeline, int ReadsPerUpdate>
+static void Time(const char* name, long iterations)
+{
+    cJoystickAxis input;
+    input.pin = BENCH_TRACE_PIN;
+    HostSetAnalogValue(BENCH_TRACE_PIN, BENCH_STILL_ADC);
+    Benchmark(name, iterations, 1, [&]()
+    {
+        BenchmarkKeep(Pipeline::Process(0, &input));
+    });
+}
+
+int main(int argc, char** argv)
+{
+    long iterations = BenchmarkIterations(argc, argv);
+    std::vector<int> truth = BuildTruth();
+
+    printf("Joystick filters on the synthetic trace (%d LSB noise, latency in updates)\n", BENCH_NOISE_LSB);
+    printf("%-30s %13s %10s %11s %11s\n", "", "Noise RMS", "Changes", "Flick", "Sweep lag");
+    BENCH_FOR_EACH_FILTER(MeasureAndPrint, truth)
+
+    for(int file = 2; file < argc; file++)
+    {
+        std::vector<int> trace;
+        FILE* traceFile = fopen(argv[file], "r");
+        int value;
+        if(traceFile == nullptr)
+        {
+            printf("Could not open %s\n", argv[file]);
+            return 1;
+        }
+        while(fscanf(traceFile, "%d", &value) == 1)
+        {
+            trace.push_back(value);
+        }
+        fclose(traceFile);
+
+        printf("\n%s (%zu reads, no truth: RMS of the moves between updates)\n", argv[file], trace.size());
+        printf("%-30s %13s %10s\n", "", "Moves RMS", "Changes");
+        BENCH_FOR_EACH_FILTER(MeasureRecorded, trace)
+    }
+
+    printf("\nTimings (%ld iterations, host analogRead)\n", iterations);
+    BENCH_FOR_EACH_FILTER(Time, iterations)
+
+    cFilterResult calibrated = MeasureSynthetic<cJoystickPipeline<cOversampleReadStage<JOYSTICK_OVERSAMPLING>, cJoystickNoiseFilterStage>, JOYSTICK_OVERSAMPLING>(truth);
+    if(calibrated.flickLatency < 0 || calibrated.flickLatency >= 1)
+    {
+        printf("The calibrated mode's filter delays moves by %.2f updates\n", calibrated.flickLatency);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,491 @@
+/**
+ * @file Benchmark_Packet.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host benchmark of the BFIO core.
+ * Measures chunk convertions, variable to byte
+ * convertions and the building and analysis
+ * of the 36 chunks hardware plane sent by
+ * SerialTester (ID 20).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Sketch.h"
+#include "Benchmark.h"
+
+/// @brief Function ID of the hardware plane.
+#define BENCH_HARDWARE_PLANE_ID 20
+/// @brief 4 ints (5 chunks each) and 7 bools (2 chunks each).
+#define BENCH_HARDWARE_PARAM_CHUNKS 34
+/// @brief Parameter chunks + start chunk + check chunk.
+#define BENCH_HARDWARE_PLANE_SIZE 36
+
+/// @brief The hardware plane described at compile time.
+typedef cPlaneSchema<BENCH_HARDWARE_PLANE_ID, int, int, int, int, bool, bool, bool, bool, bool, bool, bool> cPlane_BenchHardware;
+static_assert(cPlane_BenchHardware::size == BENCH_HARDWARE_PLANE_SIZE, "Hardware plane schema size");
+
+/**
+ * @brief Builds the hardware plane the same
+ * way SerialTester does: every variable is
+ * converted to bytes, then to a segment, then
+ * appended one by one with two buffers.
+ */
+static Execution BuildHardwarePlane(int axis, bool button, unsigned short* plane)
+{
+    unsigned char intLuggage[4];
+    unsigned char boolLuggage[1];
+    unsigned short intPassengers[5];
+    unsigned short boolPassengers[2];
+    unsigned short bufferA[BENCH_HARDWARE_PARAM_CHUNKS];
+    unsigned short bufferB[BENCH_HARDWARE_PARAM_CHUNKS];
+    unsigned short* current = bufferA;
+    unsigned short* next = bufferB;
+    int currentSize = 0;
+    int resultedSize = 0;
+
+    for(int parameter = 0; parameter < 11; parameter++)
+    {
+        unsigned short* segment;
+        int segmentSize;
+
+        if(parameter < 4)
+        {
+            Data.ToBytes(axis + parameter, intLuggage, 4);
+            Packet.GetParameterSegmentFromBytes(intLuggage, intPassengers, 4, 5);
+            segment = intPassengers;
+            segmentSize = 5;
+        }
+        else
+        {
+            Data.ToBytes(button, boolLuggage, 1);
+            Packet.GetParameterSegmentFromBytes(boolLuggage, boolPassengers, 1, 2);
+            segment = boolPassengers;
+            segmentSize = 2;
+        }
+
+        if(currentSize == 0)
+        {
+            memcpy(current, segment, segmentSize * sizeof(unsigned short));
+            currentSize = segmentSize;
+            continue;
+        }
+
+        resultedSize = currentSize + segmentSize;
+        if(Packet.AppendSegments(current, currentSize, segment, segmentSize, next, &resultedSize) != Execution::Passed)
+        {
+            return Execution::Failed;
+        }
+        currentSize = resultedSize;
+        std::swap(current, next);
+    }
+
+    return Packet.CreateFromSegments(BENCH_HARDWARE_PLANE_ID, current, currentSize, plane, BENCH_HARDWARE_PLANE_SIZE);
+}
+
+/**
+ * @brief Builds the same hardware plane with
+ * cPacketBuilder, the way SerialTester does now:
+ * every luggage goes straight into the plane.
+ */
+static Execution BuildHardwarePlaneWithBuilder(int axis, bool button, unsigned short* plane)
+{
+    cPacketBuilder builder;
+    unsigned char intLuggage[4];
+    unsigned char boolLuggage[1];
+    int planeSize = 0;
+
+    builder.Begin(BENCH_HARDWARE_PLANE_ID, plane, BENCH_HARDWARE_PLANE_SIZE);
+    for(int parameter = 0; parameter < 11; parameter++)
+    {
+        if(parameter < 4)
+        {
+            Data.ToBytes(axis + parameter, intLuggage, 4);
+            builder.AddSegment(intLuggage, 4);
+        }
+        else
+        {
+            Data.ToBytes(button, boolLuggage, 1);
+            builder.AddSegment(boolLuggage, 1);
+        }
+    }
+    return builder.Finish(&planeSize);
+}
+
+int main(int argc, char** argv)
+{
+    long iterations = BenchmarkIterations(argc, argv);
+    InitializeProject();
+
+    unsigned short plane[BENCH_HARDWARE_PLANE_SIZE];
+    if(BuildHardwarePlane(2048, true, plane) != Execution::Passed)
+    {
+        printf("Could not build the hardware plane\n");
+        return 1;
+    }
+
+    int analyzedSize;
+    int analyzedParameters;
+    unsigned char analyzedID;
+    if(Packet.FullyAnalyze(plane, &analyzedSize, &analyzedParameters, &analyzedID) != Execution::Passed
+       || analyzedSize != BENCH_HARDWARE_PLANE_SIZE || analyzedParameters != 11 || analyzedID != BENCH_HARDWARE_PLANE_ID)
+    {
+        printf("The hardware plane did not analyze correctly\n");
+        return 1;
+    }
+
+    unsigned short builtPlane[BENCH_HARDWARE_PLANE_SIZE];
+    if(BuildHardwarePlaneWithBuilder(2048, true, builtPlane) != Execution::Passed
+       || memcmp(builtPlane, plane, sizeof(plane)) != 0)
+    {
+        printf("cPacketBuilder did not build the same hardware plane\n");
+        return 1;
+    }
+
+    cPlane_BenchHardware::Encode(builtPlane, 2048, 2049, 2050, 2051, true, true, true, true, true, true, true);
+    if(memcmp(builtPlane, plane, sizeof(plane)) != 0)
+    {
+        printf("cPlaneSchema did not encode the same hardware plane\n");
+        return 1;
+    }
+
+    printf("BFIO core benchmark (%ld iterations)\n", iterations);
+
+    Benchmark("Chunk.ToChunk + Chunk.ToByte", iterations, 1, [&]()
+    {
+        static unsigned char value = 0;
+        unsigned short chunk;
+        unsigned char byte;
+        Chunk.ToChunk(value++, &chunk, ChunkType::Byte);
+        Chunk.ToByte(chunk, &byte);
+        BenchmarkKeep(byte);
+    });
+
+    // Per chunk calls against the span versions, over 256 chunks.
+    unsigned char spanBytes[256];
+    unsigned short spanChunks[256];
+    for(int index = 0; index < 256; index++)
+    {
+        spanBytes[index] = (unsigned char)index;
+    }
+    Chunk.ToChunks(spanBytes, 256, spanChunks, ChunkType::Byte);
+
+    Benchmark("Chunk.ToChunk x256", iterations, 256, [&]()
+    {
+        unsigned short chunks[256];
+        for(int index = 0; index < 256; index++)
+        {
+            Chunk.ToChunk(spanBytes[index], &chunks[index], ChunkType::Byte);
+        }
+        BenchmarkKeep(chunks);
+    });
+
+    Benchmark("Chunk.ToChunks (256)", iterations, 256, [&]()
+    {
+        unsigned short chunks[256];
+        Chunk.ToChunks(spanBytes, 256, chunks, ChunkType::Byte);
+        BenchmarkKeep(chunks);
+    });
+
+    Benchmark("Chunk.ToType x256", iterations, 256, [&]()
+    {
+        int type;
+        int divCount = 0;
+        for(int index = 0; index < 256; index++)
+        {
+            Chunk.ToType(spanChunks[index], &type);
+            divCount += (type == ChunkType::Div);
+        }
+        BenchmarkKeep(divCount);
+    });
+
+    Benchmark("Chunk.ToTypes (256)", iterations, 256, [&]()
+    {
+        unsigned char bitmap;
+        Chunk.ToTypes(spanChunks, 256, &bitmap);
+        BenchmarkKeep(bitmap);
+    });
+
+    Benchmark("Chunk.ToByte x256", iterations, 256, [&]()
+    {
+        unsigned char bytes[256];
+        for(int index = 0; index < 256; index++)
+        {
+            Chunk.ToByte(spanChunks[index], &bytes[index]);
+        }
+        BenchmarkKeep(bytes);
+    });
+
+    Benchmark("Chunk.ToBytes (256)", iterations, 256, [&]()
+    {
+        unsigned char bytes[256];
+        Chunk.ToBytes(spanChunks, 256, bytes);
+        BenchmarkKeep(bytes);
+    });
+
+    Benchmark("Chunk.ToUART (whole plane)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        unsigned char uart[2];
+        for(int index = 0; index < BENCH_HARDWARE_PLANE_SIZE; index++)
+        {
+            Chunk.ToUART(plane[index], uart);
+            BenchmarkKeep(uart);
+        }
+    });
+
+    Benchmark("Chunk.ToPackedUART (whole plane)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        unsigned char frame[PACKED_UART_SIZE(BENCH_HARDWARE_PLANE_SIZE)];
+        int frameSize;
+        Chunk.ToPackedUART(plane, BENCH_HARDWARE_PLANE_SIZE, frame, &frameSize);
+        BenchmarkKeep(frame);
+    });
+
+    unsigned char packedPlane[PACKED_UART_SIZE(BENCH_HARDWARE_PLANE_SIZE)];
+    int packedPlaneSize = 0;
+    Chunk.ToPackedUART(plane, BENCH_HARDWARE_PLANE_SIZE, packedPlane, &packedPlaneSize);
+
+    Benchmark("Chunk.FromPackedUART (whole plane)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        unsigned short chunks[MAX_PLANE_PASSENGER_CAPACITY];
+        int count;
+        Chunk.FromPackedUART(packedPlane, packedPlaneSize, chunks, &count);
+        BenchmarkKeep(chunks);
+    });
+
+    Benchmark("Chunk.ToProtectedUART (whole plane)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        unsigned char uart[2];
+        for(int index = 0; index < BENCH_HARDWARE_PLANE_SIZE; index++)
+        {
+            Chunk.ToProtectedUART(plane[index], uart);
+            BenchmarkKeep(uart);
+        }
+    });
+
+    unsigned char protectedPlane[BENCH_HARDWARE_PLANE_SIZE][2];
+    for(int index = 0; index < BENCH_HARDWARE_PLANE_SIZE; index++)
+    {
+        Chunk.ToProtectedUART(plane[index], protectedPlane[index]);
+    }
+
+    Benchmark("Chunk.FromProtectedUART (whole plane)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        unsigned short chunk;
+        bool corrected;
+        for(int index = 0; index < BENCH_HARDWARE_PLANE_SIZE; index++)
+        {
+            Chunk.FromProtectedUART(protectedPlane[index], &chunk, &corrected);
+            BenchmarkKeep(chunk);
+        }
+    });
+
+    // 8N1 UART: 10 bits on the line per byte.
+    int unpackedPlaneSize = 2 * BENCH_HARDWARE_PLANE_SIZE;
+    printf("%-44s %5d bytes %8.2f ms @9600 %6.1f planes/s\n", "  wire: unpacked (Chunk.ToUART)",
+           unpackedPlaneSize, unpackedPlaneSize * 10 * 1000.0 / 9600, 9600.0 / (unpackedPlaneSize * 10));
+    printf("%-44s %5d bytes %8.2f ms @9600 %6.1f planes/s\n", "  wire: packed (Chunk.ToPackedUART)",
+           packedPlaneSize, packedPlaneSize * 10 * 1000.0 / 9600, 9600.0 / (packedPlaneSize * 10));
+
+    // Odds that a plane survives random bit errors. Protected planes survive one flipped bit per chunk.
+    const double bitErrorRates[3] = {1e-4, 1e-3, 1e-2};
+    for(int rate = 0; rate < 3; rate++)
+    {
+        double p = bitErrorRates[rate];
+        double chunkClean = pow(1.0 - p, 16);
+        double chunkCorrectable = chunkClean + 16 * p * pow(1.0 - p, 15);
+        printf("  goodput @BER %.0e: unpacked %5.1f%% packed %5.1f%% protected %5.1f%% of planes\n", p,
+               100.0 * pow(chunkClean, BENCH_HARDWARE_PLANE_SIZE),
+               100.0 * pow(1.0 - p, 8 * packedPlaneSize),
+               100.0 * pow(chunkCorrectable, BENCH_HARDWARE_PLANE_SIZE));
+    }
+
+    // Per chunk cost of checking a plane as it lands, like cTerminal::_HandlePlaneArrival does.
+    Benchmark("Additive sum (whole plane, per chunk)", iterations, BENCH_HARDWARE_PLANE_SIZE - 1, [&]()
+    {
+        unsigned char sum = 0;
+        for(int index = 0; index < BENCH_HARDWARE_PLANE_SIZE - 1; index++)
+        {
+            unsigned short chunk = plane[index];
+            if(cChunk::ClassOf(chunk) != cChunk::ClassOf(ChunkType::Div))
+            {
+                sum += (unsigned char)chunk;
+            }
+        }
+        BenchmarkKeep(sum);
+    });
+
+    Benchmark("cPacket::UpdateCRC8 (whole plane, per chunk)", iterations, BENCH_HARDWARE_PLANE_SIZE - 1, [&]()
+    {
+        unsigned char crc = 0;
+        for(int index = 0; index < BENCH_HARDWARE_PLANE_SIZE - 1; index++)
+        {
+            crc = cPacket::UpdateCRC8(crc, plane[index]);
+        }
+        BenchmarkKeep(crc);
+    });
+
+    Benchmark("Data.ToBytes(int) + GetParameterSegment", iterations, 1, [&]()
+    {
+        static int value = 0;
+        unsigned char bytes[4];
+        unsigned short segment[5];
+        Data.ToBytes(value++, bytes, 4);
+        Packet.GetParameterSegmentFromBytes(bytes, segment, 4, 5);
+        BenchmarkKeep(segment);
+    });
+
+    Benchmark("Build hardware plane (ID 20)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        static int axis = 0;
+        unsigned short built[BENCH_HARDWARE_PLANE_SIZE];
+        BuildHardwarePlane(axis++, true, built);
+        BenchmarkKeep(built);
+    });
+
+    Benchmark("Build hardware plane (cPacketBuilder)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        static int axis = 0;
+        unsigned short built[BENCH_HARDWARE_PLANE_SIZE];
+        BuildHardwarePlaneWithBuilder(axis++, true, built);
+        BenchmarkKeep(built);
+    });
+
+    Benchmark("Build hardware plane (cPlaneSchema)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        static int axis = 0;
+        unsigned short built[BENCH_HARDWARE_PLANE_SIZE];
+        cPlane_BenchHardware::Encode(built, axis, axis + 1, axis + 2, axis + 3, true, true, true, true, true, true, true);
+        axis++;
+        BenchmarkKeep(built);
+    });
+
+    Benchmark("cPlaneSchema::Decode (hardware plane)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        int axes[4];
+        bool buttons[7];
+        cPlane_BenchHardware::Decode(plane, BENCH_HARDWARE_PLANE_SIZE, &axes[0], &axes[1], &axes[2], &axes[3],
+                                     &buttons[0], &buttons[1], &buttons[2], &buttons[3], &buttons[4], &buttons[5], &buttons[6]);
+        BenchmarkKeep(axes);
+        BenchmarkKeep(buttons);
+    });
+
+    Benchmark("Packet.FullyAnalyze", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        int size;
+        int parameters;
+        unsigned char id;
+        Packet.FullyAnalyze(plane, &size, &parameters, &id);
+        BenchmarkKeep(size);
+    });
+
+    Benchmark("Packet.GetBytes (all 11 segments)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        unsigned char bytes[4];
+        for(int segment = 1; segment <= 11; segment++)
+        {
+            Packet.GetBytes(plane, BENCH_HARDWARE_PLANE_SIZE, segment, bytes, 4);
+            BenchmarkKeep(bytes);
+        }
+    });
+
+    Benchmark("Packet.IndexPlane", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        cPlaneIndex planeIndex;
+        Packet.IndexPlane(plane, BENCH_HARDWARE_PLANE_SIZE, &planeIndex);
+        BenchmarkKeep(planeIndex.parameterCount);
+    });
+
+    Benchmark("IndexPlane + indexed GetBytes (11 segments)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        cPlaneIndex planeIndex;
+        unsigned char bytes[4];
+        Packet.IndexPlane(plane, BENCH_HARDWARE_PLANE_SIZE, &planeIndex);
+        for(int segment = 1; segment <= 11; segment++)
+        {
+            Packet.GetBytes(&planeIndex, plane, segment, bytes, 4);
+            BenchmarkKeep(bytes);
+        }
+    });
+
+    Benchmark("GetBytes + Data.ToData (11 ints)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        unsigned char bytes[4];
+        int value;
+        for(int segment = 1; segment <= 11; segment++)
+        {
+            Packet.GetBytes(plane, BENCH_HARDWARE_PLANE_SIZE, segment, bytes, 4);
+            Data.ToData(&value, bytes, 4);
+            BenchmarkKeep(value);
+        }
+    });
+
+    Benchmark("cPacketView + cSegmentView (11 ints)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        cPacketView view;
+        cSegmentView segment;
+        int value;
+        view.Open(plane, BENCH_HARDWARE_PLANE_SIZE);
+        for(int segmentNumber = 1; segmentNumber <= 11; segmentNumber++)
+        {
+            view.GetSegment(segmentNumber, &segment);
+            segment.ToData(&value);
+            BenchmarkKeep(value);
+        }
+    });
+
+    HostStream uart;
+    cDepartureRunway runway(&uart);
+
+    Benchmark("Byte by byte write (whole plane)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        unsigned char bytes[2];
+        for(int index = 0; index < BENCH_HARDWARE_PLANE_SIZE; index++)
+        {
+            Chunk.ToUART(plane[index], bytes);
+            uart.write(bytes[1]);
+            uart.write(bytes[0]);
+        }
+        uart.HostClear();
+    });
+
+    Benchmark("cDepartureRunway bulk write (whole plane)", iterations, BENCH_HARDWARE_PLANE_SIZE, [&]()
+    {
+        runway.SetPlaneForTakeOff(plane, BENCH_HARDWARE_PLANE_SIZE);
+        runway._Handle();
+        uart.HostClear();
+    });
+
+    // 9600 baud 8N1 drains about 1 byte of the 128 bytes TX FIFO per 1 ms loop.
+    cDepartureRunway slowRunway(&uart);
+    unsigned long runwayBytesPerSecond = 0;
+    int runwayTicks = 0;
+    uart.HostSetFifoSize(128);
+    for(int flight = 0; flight < 10; flight++)
+    {
+        slowRunway.SetPlaneForTakeOff(plane, BENCH_HARDWARE_PLANE_SIZE);
+        while(slowRunway._Handle() != Execution::Passed)
+        {
+            HostAdvanceMicros(1000);
+            uart.HostDrainFifo(1);
+            runwayTicks++;
+        }
+    }
+    slowRunway.GetBytesPerSecond(&runwayBytesPerSecond);
+    printf("%-44s %5lu bytes/s %6lu stalls %6d ticks\n", "  runway: 10 planes @9600, 128 B FIFO",
+           runwayBytesPerSecond, slowRunway.stalls, runwayTicks);
+    uart.HostSetFifoSize(0);
+
+    return 0;
+}
@@ -0,0 +1,73 @@
+/**
+ * @file Sketch.h
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Pulls every shared .ino of a sketch
+ * folder into a single translation unit, the
+ * same way the Arduino builder does before
+ * handing the sketch to the compiler.
+ *
+ * @attention
+ * Globals.h defines the global objects, so
+ * only ONE .cpp file per executable may
+ * include this header. Which sketch folder is
+ * used is decided by the include path given
+ * by CMake (Gamepad or SerialTester).
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef HOST_SKETCH_H
+  #define HOST_SKETCH_H
+
+#pragma region Includes
+#include "Globals.h"
+#pragma endregion
+
+#pragma region Sketch files
+// Same order as the Arduino builder: alphabetical.
+#include "AdcScan.ino"
+#include "BFIO.ino"
+#include "Chunk.ino"
+#include "Data.ino"
+#include "Device.ino"
+#include "Gates.ino"
+#include "Handler_Timebase.ino"
+#include "Interface_Joystick.ino"
+#include "Interface_RGB.ino"
+#include "Interface_Switch.ino"
+#include "Joystick.ino"
+#include "Packet.ino"
+#include "Protocol_BFIO.ino"
+#include "RGB.ino"
+#include "Runway.ino"
+#include "Sampler.ino"
+#include "Scheduler.ino"
+#include "Switch.ino"
+#include "Terminal.ino"
+#include "Tower.ino"
+#include "_UNIT_TEST.ino"
+#include "_UNIT_TEST_AdcScan.ino"
+#include "_UNIT_TEST_Chunk.ino"
+#include "_UNIT_TEST_Data.ino"
+#include "_UNIT_TEST_Joystick.ino"
+#include "_UNIT_TEST_Packet.ino"
+#include "_UNIT_TEST_Rgb.ino"
+#include "_UNIT_TEST_Sampler.ino"
+#include "_UNIT_TEST_Scheduler.ino"
+#include "_UNIT_TEST_Terminal.ino"
+#include "_UNIT_TEST_Tower.ino"
+#pragma endregion
+
+#endif
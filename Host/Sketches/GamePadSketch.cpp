@@ -0,0 +1,14 @@
+/**
+ * @file GamePadSketch.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host build of the GamePad sketch.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "Sketch.h"
+#include "GamePad.ino"
+#include "SketchMain.h"
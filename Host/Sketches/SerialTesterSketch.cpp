@@ -0,0 +1,16 @@
+/**
+ * @file SerialTesterSketch.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host build of the SerialTester sketch.
+ * The Kontrol side of the UART can be played
+ * through kontrolToGamepad's Host methods.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "Sketch.h"
+#include "SerialTester.ino"
+#include "SketchMain.h"
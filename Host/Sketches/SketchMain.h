@@ -0,0 +1,50 @@
+/**
+ * @file SketchMain.h
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Host entry point of a sketch. Does
+ * what the Arduino core does on the ESP32-S3:
+ * calls setup() once then loop() forever.
+ * On the host, loop() is only called as many
+ * times as the first command line argument
+ * says so the sketch can be used in scripts.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef HOST_SKETCH_MAIN_H
+  #define HOST_SKETCH_MAIN_H
+
+#include <cstdlib>
+
+/// @brief Amount of loop() calls when none is given on the command line.
+#define SKETCH_DEFAULT_LOOP_COUNT 1000
+
+int main(int argc, char** argv)
+{
+    long loopCount = SKETCH_DEFAULT_LOOP_COUNT;
+    if(argc > 1)
+    {
+        loopCount = strtol(argv[1], nullptr, 10);
+    }
+
+    setup();
+    for(long iteration = 0; iteration < loopCount; iteration++)
+    {
+        loop();
+    }
+    return 0;
+}
+
+#endif
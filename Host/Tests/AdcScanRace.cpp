@@ -0,0 +1,153 @@
+/**
+ * @file AdcScanRace.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Races a std::thread publishing scans,
+ * standing in for the ADC scan task, against
+ * the loop swapping cAdcScanner's buffers. No
+ * front scan may be torn or change before the
+ * next swap, and their numbers may never go
+ * back. Then checks that values set on the
+ * joystick pins reach the joysticks through the
+ * simulated continuous ADC.
+ * Build with -DBFIO_SANITIZE_THREAD=ON to have
+ * ThreadSanitizer report any data race.
+ * The first argument is the amount of scans.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Sketch.h"
+#include <thread>
+
+/// @brief Amount of scans when none is given on the command line.
+#define RACE_DEFAULT_SCAN_COUNT 200000
+
+/// @brief Every channel comes from the scan's number, so a torn one shows.
+static void BuildRaceScan(unsigned int number, int* values)
+{
+    for(int channel = 0; channel < ADC_SCAN_CHANNELS; channel++)
+    {
+        values[channel] = (int)(number * (channel + 1));
+    }
+}
+
+/// @brief What the ADC scan task would do: publish each scan, never waiting on the loop.
+static void Scan(cAdcScanner* scanner, long scanCount, std::atomic<bool>* done)
+{
+    int values[ADC_SCAN_CHANNELS];
+
+    for(long number = 0; number < scanCount; number++)
+    {
+        BuildRaceScan((unsigned int)number + 1, values);
+        scanner->Publish(values, (unsigned long)number + 1);
+        // The real task sleeps until the ADC completes the next scan.
+        std::this_thread::yield();
+    }
+    done->store(true);
+}
+
+/// @brief false if a scan is not the one its number was built from.
+static bool IsWhole(const cAdcScan* scan)
+{
+    int expected[ADC_SCAN_CHANNELS];
+
+    BuildRaceScan(scan->scanNumber, expected);
+    return memcmp(scan->values, expected, sizeof(expected)) == 0 && scan->scannedAt == scan->scanNumber;
+}
+
+/// @brief The scanner's real producer: the simulated ADC, its callback and the virtual clock.
+static bool ReachesJoysticks()
+{
+    int x = 0;
+    int y = 0;
+    bool state = false;
+
+    if(InitializeProject() != Execution::Passed || AdcScanner.Begin() != Execution::Passed)
+    {
+        return false;
+    }
+    LeftJoystick.SetMode(JOYSTICK_MODE_RAW);
+    HostSetAnalogValue(LEFT_JOYSTICK_X_PIN, 4095);
+    HostSetAnalogValue(LEFT_JOYSTICK_Y_PIN, 0);
+
+    // A scan completes every 1000000 / ADC_SCAN_RATE_HZ microseconds.
+    HostAdvanceMicros(2 * 1000000 / ADC_SCAN_RATE_HZ);
+    InterfaceJoysticks();
+    LeftJoystick.GetEverything(&x, &y, &state);
+    analogContinuousDeinit();
+    return x == 4095 - _JOY_MAX_VAL && y == -_JOY_MAX_VAL && AdcScanner.GetScan()->scanNumber == 2;
+}
+
+int main(int argc, char** argv)
+{
+    long scanCount = RACE_DEFAULT_SCAN_COUNT;
+    if(argc > 1)
+    {
+        scanCount = strtol(argv[1], nullptr, 10);
+    }
+
+    cAdcScanner scanner(ADC_SCAN_PINS, ADC_SCAN_CHANNELS);
+    cAdcScan front;
+    std::atomic<bool> done(false);
+    unsigned int lastScanNumber = 0;
+    unsigned long swaps = 0;
+    unsigned long bypassedSwaps = 0;
+
+    std::thread scanning(Scan, &scanner, scanCount, &done);
+
+    while(!done.load() || lastScanNumber < (unsigned int)scanCount)
+    {
+        Execution execution = scanner.Swap();
+        if(execution == Execution::Bypassed)
+        {
+            bypassedSwaps++;
+            continue;
+        }
+        if(execution != Execution::Passed)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Read twice: the front scan must not move while the scanner keeps publishing.
+        const cAdcScan* scan = scanner.GetScan();
+        front = *scan;
+        std::this_thread::yield();
+        if(!IsWhole(&front) || memcmp(&front, scan, sizeof(front)) != 0)
+        {
+            scanning.join();
+            printf("ADC scan race: -> scan %u was torn\n", front.scanNumber);
+            return 1;
+        }
+        if(front.scanNumber <= lastScanNumber)
+        {
+            scanning.join();
+            printf("ADC scan race: -> scan %u came after %u\n", front.scanNumber, lastScanNumber);
+            return 1;
+        }
+        lastScanNumber = front.scanNumber;
+        swaps++;
+    }
+    scanning.join();
+
+    if(!ReachesJoysticks())
+    {
+        printf("ADC scan race: -> the simulated ADC did not reach the joysticks\n");
+        return 1;
+    }
+
+    printf("ADC scan race: -> PASSED (%ld scans, %lu swaps, %lu overwritten, %lu bypassed)\n", scanCount, swaps, scanner.overwrittenScans.load(), bypassedSwaps);
+    return 0;
+}
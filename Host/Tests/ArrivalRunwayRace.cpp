@@ -0,0 +1,142 @@
+/**
+ * @file ArrivalRunwayRace.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Races a std::thread producer, standing
+ * in for the UART ISR, against the loop draining
+ * cArrivalRunway into a terminal. Every plane
+ * must land, in order and intact.
+ * Build with -DBFIO_SANITIZE_THREAD=ON to have
+ * ThreadSanitizer report any data race.
+ * The first argument is the amount of planes.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Sketch.h"
+#include <thread>
+#include <atomic>
+
+/// @brief Amount of planes when none is given on the command line.
+#define RACE_DEFAULT_PLANE_COUNT 20000
+#define RACE_PLANE_SIZE 7
+
+/// @brief Same shape as the terminal unit test plane. The first byte tells planes apart.
+static void BuildRacePlane(unsigned char value, unsigned short* plane)
+{
+    plane[0] = ChunkType::Start + 21;
+    plane[1] = ChunkType::Div;
+    plane[2] = ChunkType::Byte + value;
+    plane[3] = ChunkType::Div;
+    plane[4] = ChunkType::Byte + 3;
+    plane[5] = ChunkType::Byte + 4;
+    plane[6] = ChunkType::Check + (unsigned char)(21 + value + 3 + 4);
+}
+
+/// @brief Set by the loop when it gives up, so a producer waiting on a full runway returns.
+static std::atomic<bool> stopProducing(false);
+
+/**
+ * @brief What the ISR would do: land bytes as
+ * they come, in uneven bursts, never waiting
+ * on anything but a full runway.
+ */
+static void Produce(cArrivalRunway* runway, long planeCount, unsigned long* retriedBytes)
+{
+    unsigned short plane[RACE_PLANE_SIZE];
+    unsigned char uartPlane[2*RACE_PLANE_SIZE];
+
+    for(long planeNumber = 0; planeNumber < planeCount; planeNumber++)
+    {
+        BuildRacePlane((unsigned char)planeNumber, plane);
+        for(int index = 0; index < RACE_PLANE_SIZE; index++)
+        {
+            uartPlane[2*index]   = plane[index] >> 8;
+            uartPlane[2*index+1] = plane[index] & 0xFF;
+        }
+
+        int sent = 0;
+        while(sent < (int)sizeof(uartPlane))
+        {
+            int burst = 1 + (int)((planeNumber + sent) % 5);
+            if(burst > (int)sizeof(uartPlane) - sent)
+            {
+                burst = (int)sizeof(uartPlane) - sent;
+            }
+
+            // A real ISR would lose what does not fit. Here it is sent again once the loop drained.
+            int landed = runway->Land(&uartPlane[sent], burst);
+            if(landed < burst)
+            {
+                if(stopProducing.load())
+                {
+                    return;
+                }
+                *retriedBytes += burst - landed;
+                std::this_thread::yield();
+            }
+            sent += landed;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    long planeCount = RACE_DEFAULT_PLANE_COUNT;
+    if(argc > 1)
+    {
+        planeCount = strtol(argv[1], nullptr, 10);
+    }
+
+    cArrivalRunway runway;
+    cTerminal terminal;
+    unsigned short expected[RACE_PLANE_SIZE];
+    unsigned short landed[RACE_PLANE_SIZE];
+    long landedPlanes = 0;
+    unsigned long retriedBytes = 0;
+
+    std::thread producer(Produce, &runway, planeCount, &retriedBytes);
+
+    while(landedPlanes < planeCount)
+    {
+        if(runway.DrainInto(&terminal) != Execution::Passed)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        BuildRacePlane((unsigned char)landedPlanes, expected);
+        terminal.GetLastArrival(landed, RACE_PLANE_SIZE);
+        terminal.packetAvailable = false;
+        if(memcmp(landed, expected, sizeof(landed)) != 0)
+        {
+            // Nothing drains the runway anymore. The producer would wait on it forever.
+            stopProducing.store(true);
+            producer.join();
+            printf("Arrival runway race: -> plane %ld landed wrong\n", landedPlanes);
+            return 1;
+        }
+        landedPlanes++;
+    }
+
+    producer.join();
+    if(runway.GetWaitingBytes() != 0 || runway.drainedBytes != (unsigned long)planeCount * 2 * RACE_PLANE_SIZE || runway.droppedBytes.load() != retriedBytes)
+    {
+        printf("Arrival runway race: -> bytes were left behind\n");
+        return 1;
+    }
+
+    printf("Arrival runway race: -> PASSED (%ld planes, at most %u bytes waiting)\n", planeCount, runway.mostBytesWaiting);
+    return 0;
+}
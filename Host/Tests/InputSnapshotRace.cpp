@@ -0,0 +1,112 @@
+/**
+ * @file InputSnapshotRace.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Races a std::thread sampler, standing
+ * in for the input sampling core, against the
+ * loop reading cInputSampler snapshots. No read
+ * snapshot may be torn and their sample numbers
+ * may never go back.
+ * Build with -DBFIO_SANITIZE_THREAD=ON to have
+ * ThreadSanitizer report any data race.
+ * The first argument is the amount of snapshots.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Sketch.h"
+#include <thread>
+
+/// @brief Amount of snapshots when none is given on the command line.
+#define RACE_DEFAULT_SNAPSHOT_COUNT 200000
+
+/// @brief Every field comes from the snapshot's number, so a torn one shows.
+static void BuildRaceSnapshot(unsigned int number, cInputSnapshot* snapshot)
+{
+    snapshot->leftX = (int)number;
+    snapshot->leftY = -(int)number;
+    snapshot->rightX = (int)(number * 3);
+    snapshot->rightY = (int)~number;
+    snapshot->switches = number & 0x7F;
+    snapshot->sampledAt = number;
+}
+
+/// @brief What the sampling core would do: publish as fast as it can, never waiting.
+static void Sample(cInputSampler* sampler, long snapshotCount, std::atomic<bool>* done)
+{
+    cInputSnapshot snapshot;
+
+    for(long number = 0; number < snapshotCount; number++)
+    {
+        BuildRaceSnapshot((unsigned int)number, &snapshot);
+        sampler->Publish(&snapshot);
+    }
+    done->store(true);
+}
+
+int main(int argc, char** argv)
+{
+    long snapshotCount = RACE_DEFAULT_SNAPSHOT_COUNT;
+    if(argc > 1)
+    {
+        snapshotCount = strtol(argv[1], nullptr, 10);
+    }
+
+    cInputSampler sampler;
+    cInputSnapshot read;
+    cInputSnapshot expected;
+    std::atomic<bool> done(false);
+    unsigned int lastSampleNumber = 0;
+    unsigned long reads = 0;
+    unsigned long bypassedReads = 0;
+
+    std::thread sampling(Sample, &sampler, snapshotCount, &done);
+
+    while(!done.load() || lastSampleNumber < (unsigned int)snapshotCount)
+    {
+        Execution execution = sampler.Read(&read);
+        if(execution == Execution::Bypassed)
+        {
+            bypassedReads++;
+            continue;
+        }
+        if(execution != Execution::Passed)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        // Publish numbers them from 1, so snapshot N was built from N - 1.
+        BuildRaceSnapshot(read.sampleNumber - 1, &expected);
+        expected.sampleNumber = read.sampleNumber;
+        if(memcmp(&read, &expected, sizeof(read)) != 0)
+        {
+            sampling.join();
+            printf("Input snapshot race: -> snapshot %u was torn\n", read.sampleNumber);
+            return 1;
+        }
+        if(read.sampleNumber < lastSampleNumber)
+        {
+            sampling.join();
+            printf("Input snapshot race: -> snapshot %u came after %u\n", read.sampleNumber, lastSampleNumber);
+            return 1;
+        }
+        lastSampleNumber = read.sampleNumber;
+        reads++;
+    }
+
+    sampling.join();
+    printf("Input snapshot race: -> PASSED (%ld snapshots, %lu reads, %lu retries, %lu given up)\n", snapshotCount, reads, sampler.readRetries.load(), bypassedReads);
+    return 0;
+}
@@ -0,0 +1,131 @@
+/**
+ * @file JoystickSettingsRace.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Races a std::thread updating a
+ * joystick, standing in for the input sampling
+ * core, against the loop setting its response
+ * curve, like the ResponseCurve gate does. No
+ * sample may see half a table or the two axes
+ * on different curves, and the last curve set
+ * must be the one in use in the end.
+ * Build with -DBFIO_SANITIZE_THREAD=ON to have
+ * ThreadSanitizer report any data race.
+ * The first argument is the amount of curves set.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Sketch.h"
+#include <thread>
+
+/// @brief Amount of curves set when none is given on the command line.
+#define RACE_DEFAULT_SETTINGS_COUNT 20000
+
+/// @brief Tables of both curves the loop switches between.
+static short linearTable[JOYSTICK_RESPONSE_TABLE_SIZE];
+static short expoTable[JOYSTICK_RESPONSE_TABLE_SIZE];
+
+/// @brief Curve of a table. JOYSTICK_CURVE_COUNT if it is none of them, like a half built one.
+static unsigned char CurveOf(const short* table)
+{
+    if(memcmp(table, linearTable, sizeof(linearTable)) == 0)
+    {
+        return JOYSTICK_CURVE_LINEAR;
+    }
+    if(memcmp(table, expoTable, sizeof(expoTable)) == 0)
+    {
+        return JOYSTICK_CURVE_EXPO;
+    }
+    return JOYSTICK_CURVE_COUNT;
+}
+
+/// @brief What the input sampling task would do: update the joystick, never waiting on the loop.
+static void Sample(cJoystick* joystick, cJoystickShaping* shaping, std::atomic<bool>* done, unsigned char* lastCurve, bool* whole)
+{
+    unsigned char curve = JOYSTICK_CURVE_LINEAR;
+
+    *whole = true;
+    while(true)
+    {
+        // Read before updating: once set, the last curve is taken by this Update.
+        bool last = done->load();
+        joystick->Update();
+
+        // Only this thread touches the tables, so they can be read here.
+        curve = CurveOf(shaping->xTable);
+        if(curve == JOYSTICK_CURVE_COUNT || CurveOf(shaping->yTable) != curve)
+        {
+            *whole = false;
+            return;
+        }
+        if(last)
+        {
+            *lastCurve = curve;
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+int main(int argc, char** argv)
+{
+    long settingsCount = RACE_DEFAULT_SETTINGS_COUNT;
+    if(argc > 1)
+    {
+        settingsCount = strtol(argv[1], nullptr, 10);
+    }
+
+    static cJoystickShaping shaping;
+    cJoystick joystick(LEFT_JOYSTICK_X_PIN, LEFT_JOYSTICK_Y_PIN, LEFT_JOYSTICK_SWITCH_PIN, &shaping);
+    cJoystickResponse response;
+    std::atomic<bool> done(false);
+    unsigned char lastCurve = JOYSTICK_CURVE_COUNT;
+    unsigned char curve = JOYSTICK_CURVE_LINEAR;
+    bool whole = false;
+
+    BuildJoystickResponseTable(0, 0, &response, linearTable);
+    response.curve = JOYSTICK_CURVE_EXPO;
+    BuildJoystickResponseTable(0, 0, &response, expoTable);
+    if(!joystick.built)
+    {
+        printf("Joystick settings race: -> the joystick was not built\n");
+        return 1;
+    }
+
+    std::thread sampling(Sample, &joystick, &shaping, &done, &lastCurve, &whole);
+
+    for(long set = 0; set < settingsCount; set++)
+    {
+        curve = curve == JOYSTICK_CURVE_LINEAR ? JOYSTICK_CURVE_EXPO : JOYSTICK_CURVE_LINEAR;
+        joystick.SetResponseCurve(curve, JOYSTICK_CURVE_MAX_STRENGTH);
+        std::this_thread::yield();
+    }
+    done.store(true);
+    sampling.join();
+
+    if(!whole)
+    {
+        printf("Joystick settings race: -> a sample saw a table half built\n");
+        return 1;
+    }
+    if(lastCurve != curve)
+    {
+        printf("Joystick settings race: -> the last curve set was not applied\n");
+        return 1;
+    }
+
+    printf("Joystick settings race: -> PASSED (%ld curves set)\n", settingsCount);
+    return 0;
+}
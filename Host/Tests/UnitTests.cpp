@@ -0,0 +1,53 @@
+/**
+ * @file UnitTests.cpp
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief Runs the exact same unit tests the
+ * ESP32-S3 runs at boot, but on the host.
+ * The exit code is 0 only if every unit passed.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#include "Sketch.h"
+
+int main()
+{
+    Execution execution;
+
+    execution = InitializeProject();
+    if(execution != Execution::Passed)
+    {
+        Serial.println("Host unit tests: -> InitializeProject FAILED");
+        return 1;
+    }
+
+    // Same as GamePad.ino: a failed initialization is reported
+    // but the units are still tested.
+    execution = TestInitialization();
+    if(execution != Execution::Passed)
+    {
+        Serial.println("Host unit tests: -> TestInitialization FAILED");
+    }
+
+    execution = TestAllUnits();
+    if(execution != Execution::Passed)
+    {
+        Serial.println("Host unit tests: -> TestAllUnits FAILED");
+        return 1;
+    }
+
+    Serial.println("Host unit tests: -> PASSED");
+    return 0;
+}
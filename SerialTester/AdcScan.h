@@ -0,0 +1,190 @@
+/**
+ * @file AdcScan.h
+ * @author Lyam (Lyam.brs@gmail.com)
+ * @brief This file contains the ADC scanner
+ * class. The joysticks' axes are converted
+ * continuously by the ADC, at a fixed rate,
+ * and each scan of all of them is handed to
+ * the joysticks through a double buffer.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef ADCSCAN_H
+  #define ADCSCAN_H
+//=============================================//
+//	Include
+//=============================================//
+#include "Globals.h"
+
+/// @brief Most pins a scan converts. The 4 joystick axes.
+#define ADC_SCAN_CHANNELS 4
+/// @brief Conversions of each pin averaged into one scan value.
+#define ADC_SCAN_CONVERSIONS_PER_PIN 4
+/// @brief Scans per second. Matches the inputs task.
+#define ADC_SCAN_RATE_HZ 1000
+/// @brief Value of a channel that was never scanned. Middle of the 12 bits ADC.
+#define ADC_SCAN_IDLE_VALUE 2048
+
+#if defined(ARDUINO_ARCH_ESP32)
+/// @brief The task collecting scans runs next to the input sampling, above it.
+#define ADC_SCAN_CORE 0
+#define ADC_SCAN_STACK_SIZE 3072
+#define ADC_SCAN_PRIORITY 3
+#endif
+
+/**
+ * @brief Every channel of the ADC scanner, as
+ * they were converted in one scan.
+ */
+struct cAdcScan
+{
+    /// @brief Raw ADC value of each channel, in the order of the scanner's pins.
+    int values[ADC_SCAN_CHANNELS] = {ADC_SCAN_IDLE_VALUE, ADC_SCAN_IDLE_VALUE, ADC_SCAN_IDLE_VALUE, ADC_SCAN_IDLE_VALUE};
+    /// @brief micros() when the ADC finished the scan.
+    unsigned long scannedAt = 0;
+    /// @brief Counts scans from 1. 0 if never scanned.
+    unsigned int scanNumber = 0;
+};
+
+/**
+ * @brief Class that runs the ADC continuously
+ * over a few pins and double buffers its scans.
+ * The ADC converts on its own, so reading an
+ * axis no longer blocks, and the pins of a scan
+ * are converted back to back.
+ *
+ * The scan being filled is the back buffer. The
+ * scan being read is the front one. Swap trades
+ * them when a new scan is ready. Neither side
+ * ever waits on the other.
+ * @attention
+ * Only one task may Publish and only one may
+ * Swap and read the front scan.
+ */
+class cAdcScanner
+ {
+    private:
+        /// @brief The front and the back buffer.
+        cAdcScan _scans[2];
+
+        /// @brief Which of _scans is the front one, and whether the back one is new or being written. See ADC_SCAN_STATE_*
+        std::atomic<unsigned char> _state;
+
+        /// @brief Pin of each channel.
+        unsigned char _pins[ADC_SCAN_CHANNELS];
+        /// @brief Amount of pins scanned.
+        int _pinCount = 0;
+
+        /// @brief Amount of scans published.
+        unsigned int _scanCount = 0;
+
+        /// @brief micros() of the last conversion done interrupt.
+        std::atomic<unsigned long> _scanDoneAt;
+
+    public:
+        /// @brief set to true if the class is constructed.
+        bool built = false;
+
+        /// @brief Amount of scans published over one that was never swapped in.
+        std::atomic<unsigned long> overwrittenScans;
+
+        //////////////////////////////////////////////
+        cAdcScanner();
+        /**
+         * @brief Scanner of the given pins. Nothing
+         * is converted until Begin is called.
+         * @param pins
+         * Analog pins, in channel order.
+         * @param pinCount
+         * From 1 to ADC_SCAN_CHANNELS.
+         */
+        cAdcScanner(const unsigned char* pins, int pinCount);
+        //////////////////////////////////////////////
+
+        /**
+         * @brief Starts the continuous conversions.
+         * Scans are published from then on.
+         * @return Execution::Passed = Started | Execution::Failed = The ADC refused the configuration
+         */
+        Execution Begin();
+
+        /**
+         * @brief Called by the conversion done
+         * interrupt. Only remembers when.
+         */
+        void _OnScanDone();
+
+        /**
+         * @brief Reads the scan the ADC completed
+         * and publishes it. Called after the
+         * conversion done interrupt, outside of it.
+         * @return Execution::Passed = Published | Execution::Bypassed = No completed scan to read
+         */
+        Execution _Collect();
+
+        /**
+         * @brief Writes a scan in the back buffer
+         * and marks it as new. Never waits.
+         * @param values
+         * One value per channel.
+         * @param scannedAt
+         * micros() when it was scanned.
+         * @return Execution::Passed = Published
+         */
+        Execution Publish(const int* values, unsigned long scannedAt);
+
+        /**
+         * @brief Makes the newest scan the front
+         * one. The front scan does not change
+         * until the next Swap.
+         * @return Execution::Passed = Swapped | Execution::Unecessary = No new scan | Execution::Bypassed = A scan is being written, swap again later
+         */
+        Execution Swap();
+
+        /**
+         * @brief Get the front scan. Only valid
+         * until the next Swap.
+         */
+        const cAdcScan* GetScan();
+
+        /**
+         * @brief Get the channel a pin is scanned on.
+         * @param pin
+         * The analog pin.
+         * @param channel
+         * Where its index in cAdcScan::values is placed.
+         * @return Execution::Passed = Placed | Execution::Failed = Pin is not scanned
+         */
+        Execution GetChannel(int pin, int* channel);
+ };
+
+/**
+ * @brief Conversion done interrupt of the ADC
+ * scanner. See cAdcScanner::Begin.
+ */
+void ARDUINO_ISR_ATTR AdcScanDone();
+
+#if defined(ARDUINO_ARCH_ESP32)
+/**
+ * @brief FreeRTOS task collecting each scan the
+ * ADC completes, woken by AdcScanDone.
+ * @param parameters
+ * Unused.
+ */
+void AdcScanTask(void* parameters);
+#endif
+
+#endif
@@ -0,0 +1,263 @@
+/**
+ * @file AdcScan.ino
+ * @author Lyam (Lyam.brs@gmail.com)
+ * @brief The code methods of the
+ * ADC scanner class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########   */
+/////////////////////////////////////////////////////////////////////////////
+#include "AdcScan.h"
+////////////////////// - Local Defines
+/// @brief Bit of _state telling which of _scans is the front one.
+#define ADC_SCAN_STATE_FRONT 0x01
+/// @brief Bit of _state set when the back scan is newer than the front one.
+#define ADC_SCAN_STATE_NEW 0x02
+/// @brief Bit of _state set while Publish writes the back scan.
+#define ADC_SCAN_STATE_WRITING 0x04
+
+#if defined(ARDUINO_ARCH_ESP32)
+/// @brief Woken by AdcScanDone.
+static TaskHandle_t adcScanTaskHandle = nullptr;
+#endif
+/////////////////////////////////////////////////////////////////////////////
+cAdcScanner::cAdcScanner()
+{
+    _state.store(0);
+    _scanDoneAt.store(0);
+    overwrittenScans.store(0);
+    _pinCount = 0;
+    built = true;
+}
+
+/**
+ * @brief Scanner of the given pins. Nothing
+ * is converted until Begin is called.
+ * @param pins
+ * Analog pins, in channel order.
+ * @param pinCount
+ * From 1 to ADC_SCAN_CHANNELS.
+ */
+cAdcScanner::cAdcScanner(const unsigned char* pins, int pinCount)
+{
+    _state.store(0);
+    _scanDoneAt.store(0);
+    overwrittenScans.store(0);
+
+    if(pinCount < 1 || pinCount > ADC_SCAN_CHANNELS)
+    {
+        built = false;
+        return;
+    }
+    memcpy(_pins, pins, pinCount);
+    _pinCount = pinCount;
+    built = true;
+}
+
+/**
+ * @brief Starts the continuous conversions.
+ * Scans are published from then on.
+ * @return Execution::Passed = Started | Execution::Failed = The ADC refused the configuration
+ */
+Execution cAdcScanner::Begin()
+{
+    if(!built || _pinCount == 0)
+    {
+        return Execution::Failed;
+    }
+
+#if defined(ARDUINO_ARCH_ESP32)
+    // Must exist before the first interrupt wakes it.
+    if(adcScanTaskHandle == nullptr && xTaskCreatePinnedToCore(AdcScanTask, "AdcScan", ADC_SCAN_STACK_SIZE, nullptr, ADC_SCAN_PRIORITY, &adcScanTaskHandle, ADC_SCAN_CORE) != pdPASS)
+    {
+        Device.SetErrorMessage("85:AdcScan -> Task            ");
+        return Execution::Failed;
+    }
+#endif
+
+    // The rate is of conversions, all pins included.
+    if(!analogContinuous(_pins, _pinCount, ADC_SCAN_CONVERSIONS_PER_PIN, ADC_SCAN_RATE_HZ * ADC_SCAN_CONVERSIONS_PER_PIN * _pinCount, AdcScanDone))
+    {
+        Device.SetErrorMessage("93:AdcScan -> Configuration   ");
+        return Execution::Failed;
+    }
+
+    if(!analogContinuousStart())
+    {
+        Device.SetErrorMessage("99:AdcScan -> Start           ");
+        return Execution::Failed;
+    }
+    return Execution::Passed;
+}
+
+/**
+ * @brief Called by the conversion done
+ * interrupt. Only remembers when.
+ */
+void cAdcScanner::_OnScanDone()
+{
+    _scanDoneAt.store(micros(), std::memory_order_relaxed);
+}
+
+/**
+ * @brief Reads the scan the ADC completed
+ * and publishes it. Called after the
+ * conversion done interrupt, outside of it.
+ * @return Execution::Passed = Published | Execution::Bypassed = No completed scan to read
+ */
+Execution cAdcScanner::_Collect()
+{
+    adc_continuous_data_t* frame = nullptr;
+    int values[ADC_SCAN_CHANNELS];
+
+    if(!analogContinuousRead(&frame, 0))
+    {
+        return Execution::Bypassed;
+    }
+
+    // The frame holds one average per pin, in the order given to analogContinuous.
+    for(int channel = 0; channel < _pinCount; channel++)
+    {
+        values[channel] = frame[channel].avg_read_raw;
+    }
+    for(int channel = _pinCount; channel < ADC_SCAN_CHANNELS; channel++)
+    {
+        values[channel] = ADC_SCAN_IDLE_VALUE;
+    }
+    return Publish(values, _scanDoneAt.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Writes a scan in the back buffer
+ * and marks it as new. Never waits.
+ * @param values
+ * One value per channel.
+ * @param scannedAt
+ * micros() when it was scanned.
+ * @return Execution::Passed = Published
+ */
+Execution cAdcScanner::Publish(const int* values, unsigned long scannedAt)
+{
+    // Only Swap changes _state meanwhile, and it does not while WRITING is set.
+    unsigned char state = _state.load(std::memory_order_acquire);
+    while(!_state.compare_exchange_weak(state, state | ADC_SCAN_STATE_WRITING, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+    }
+
+    if(state & ADC_SCAN_STATE_NEW)
+    {
+        overwrittenScans.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    cAdcScan* back = &_scans[(state & ADC_SCAN_STATE_FRONT) ^ 1];
+    memcpy(back->values, values, sizeof(back->values));
+    back->scannedAt = scannedAt;
+    back->scanNumber = ++_scanCount;
+
+    _state.store((state & ADC_SCAN_STATE_FRONT) | ADC_SCAN_STATE_NEW, std::memory_order_release);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Makes the newest scan the front
+ * one. The front scan does not change
+ * until the next Swap.
+ * @return Execution::Passed = Swapped | Execution::Unecessary = No new scan | Execution::Bypassed = A scan is being written, swap again later
+ */
+Execution cAdcScanner::Swap()
+{
+    unsigned char state = _state.load(std::memory_order_acquire);
+
+    if(state & ADC_SCAN_STATE_WRITING)
+    {
+        return Execution::Bypassed;
+    }
+
+    if(!(state & ADC_SCAN_STATE_NEW))
+    {
+        return Execution::Unecessary;
+    }
+
+    // Fails if Publish started writing in between. The front scan is then kept.
+    if(!_state.compare_exchange_strong(state, (state ^ ADC_SCAN_STATE_FRONT) & ADC_SCAN_STATE_FRONT, std::memory_order_acq_rel, std::memory_order_acquire))
+    {
+        return Execution::Bypassed;
+    }
+    return Execution::Passed;
+}
+
+/**
+ * @brief Get the front scan. Only valid
+ * until the next Swap.
+ */
+const cAdcScan* cAdcScanner::GetScan()
+{
+    return &_scans[_state.load(std::memory_order_acquire) & ADC_SCAN_STATE_FRONT];
+}
+
+/**
+ * @brief Get the channel a pin is scanned on.
+ * @param pin
+ * The analog pin.
+ * @param channel
+ * Where its index in cAdcScan::values is placed.
+ * @return Execution::Passed = Placed | Execution::Failed = Pin is not scanned
+ */
+Execution cAdcScanner::GetChannel(int pin, int* channel)
+{
+    for(int index = 0; index < _pinCount; index++)
+    {
+        if(_pins[index] == pin)
+        {
+            *channel = index;
+            return Execution::Passed;
+        }
+    }
+    return Execution::Failed;
+}
+
+/**
+ * @brief Conversion done interrupt of the ADC
+ * scanner. See cAdcScanner::Begin.
+ */
+void ARDUINO_ISR_ATTR AdcScanDone()
+{
+    AdcScanner._OnScanDone();
+#if defined(ARDUINO_ARCH_ESP32)
+    // The frame cannot be read from an interrupt. The task collects it.
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(adcScanTaskHandle, &higherPriorityTaskWoken);
+    portYIELD_FROM_ISR(higherPriorityTaskWoken);
+#else
+    AdcScanner._Collect();
+#endif
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+/**
+ * @brief FreeRTOS task collecting each scan the
+ * ADC completes, woken by AdcScanDone.
+ * @param parameters
+ * Unused.
+ */
+void AdcScanTask(void* parameters)
+{
+    while(true)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        AdcScanner._Collect();
+    }
+}
+#endif
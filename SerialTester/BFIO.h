@@ -24,32 +24,83 @@
 #define BFIO_TIMEOUT_MS 1000
 #define BFIO_VERSION_ID 202305091044
 #define BFIO_GIT_REPOSITORY "https://github.com/LyamBRS/BrSpand_GamePad.git"
-#define _AMOUNT_OF_SUPPORTED_ID 20
 #define MAX_PLANE_PASSENGER_CAPACITY 255
 
-unsigned char supportedBFIOIDs[_AMOUNT_OF_SUPPORTED_ID] = {
-    0, // [MANDATORY]  - Ping(None)
-    1, // [MANDATORY]  - Status (Get)
-    2, // [MANDATORY]  - Handshake
-    3, // [MANDATORY]  - ErrorMessage
-    4, // [MANDATORY]  - Device Type
-    5, // [MANDATORY]  - ID
-    6, // [MANDATORY]  - RESTART PROTOCOL
-    7, // [MANDATORY]  - GetUniversalInfos
-    8, // [MANDATORY]  - HandlingError
-    9, // [MANDATORY]  - RESERVED
-    10, // [MANDATORY] - RESERVED
+/**
+ * @brief Every BFIO function supported by this
+ * device. This is the only place where function
+ * IDs need to be added: supportedBFIOIDs,
+ * _AMOUNT_OF_SUPPORTED_ID and BFIO_ID_TABLE are
+ * all generated from it.
+ * X(ID, Name)
+ */
+#define BFIO_FUNCTIONS(X) \
+    X(0,  Ping)             /* [MANDATORY]  - Ping(None) */ \
+    X(1,  Status)           /* [MANDATORY]  - Status (Get) */ \
+    X(2,  Handshake)        /* [MANDATORY]  - Handshake */ \
+    X(3,  ErrorMessage)     /* [MANDATORY]  - ErrorMessage */ \
+    X(4,  DeviceType)       /* [MANDATORY]  - Device Type */ \
+    X(5,  ID)               /* [MANDATORY]  - ID */ \
+    X(6,  Restart)          /* [MANDATORY]  - RESTART PROTOCOL */ \
+    X(7,  UniversalInfo)    /* [MANDATORY]  - GetUniversalInfos */ \
+    X(8,  HandlingError)    /* [MANDATORY]  - HandlingError */ \
+    X(9,  Reserved9)        /* [MANDATORY]  - RESERVED */ \
+    X(10, Reserved10)       /* [MANDATORY]  - RESERVED */ \
+    X(20, ResetInputs)      /* [SPECIFIC] -TX: 0 -RX: 0 - ResetInputs(None)                                                     -> None */ \
+    X(21, Joystick)         /* [SPECIFIC] -TX: 1 -RX: 1 - Joystick(unsigned char JoystickID)                                    -> char X, char Y, bool button */ \
+    X(22, JoystickAxis)     /* [SPECIFIC] -TX: 2 -RX: 1 - JoystickAxis(unsigned char Joystick_ID, unsigned char AxisID)         -> char AxisValue */ \
+    X(23, Joysticks)        /* [SPECIFIC] -TX: 6 -RX: 6 - Joysticks(char X, char Y, char X, char Y, bool left, bool right)      -> char X, char Y, char X, char Y, bool left, bool right */ \
+    X(24, Trim)             /* [SPECIFIC] -TX: 2 -RX: 1 - Trim(unsigned char JoystickID, unsigned char AxisID)                  -> char Trim */ \
+    X(25, Deadzone)         /* [SPECIFIC] -TX: 2 -RX: 1 - Deadzone(unsigned char JoystickID, unsigned char AxisID)              -> char Deadzone */ \
+    X(26, Button)           /* [SPECIFIC] -TX: 1 -RX: 1 - Button(unsigned char ButtonID)                                        -> unsigned char buttonState */ \
+    X(27, Buttons)          /* [SPECIFIC] -TX: 5 -RX: 5 - Buttons(uc ButtonA, uc ButtonB, uc ButtonC, uc ButtonD, uc ButtonE)   -> uc ButtonA, uc ButtonB, uc ButtonC, uc ButtonD, uc ButtonE */ \
+    X(28, RGB)              /* [SPECIFIC] -TX: 3 -RX: 3 - RGB(uc Red, uc Green, uc Blue)                                        -> uc Red, uc Green, uc Blue */ \
+    X(29, ResponseCurve)    /* [SPECIFIC] -TX: 12 -RX: 12 - ResponseCurve(uc JoystickID, uc Curve, uc Strength, uc RadialDeadzone, uc Points[8]) -> Same, as applied */
+
+/**
+ * @brief Slot of each supported function.
+ * Slots start at 1 so that 0 can mean
+ * "not supported" in BFIO_ID_TABLE.
+ */
+enum BFIOFunction
+{
+    BFIOFunction_None = 0,
+    #define _BFIO_SLOT(id, name) BFIOFunction_##name,
+    BFIO_FUNCTIONS(_BFIO_SLOT)
+    #undef _BFIO_SLOT
+    BFIOFunction_Count
+};
 
-    20, // [SPECIFIC] -TX: 0 -RX: 0 - ResetInputs(None)                                                     -> None
-    21, // [SPECIFIC] -TX: 1 -RX: 1 - Joystick(unsigned char JoystickID)                                    -> char X, char Y, bool button
-    22, // [SPECIFIC] -TX: 2 -RX: 1 - JoystickAxis(unsigned char Joystick_ID, unsigned char AxisID)         -> char AxisValue
-    23, // [SPECIFIC] -TX: 6 -RX: 6 - Joysticks(char X, char Y, char X, char Y, bool left, bool right)      -> char X, char Y, char X, char Y, bool left, bool right
-    24, // [SPECIFIC] -TX: 2 -RX: 1 - Trim(unsigned char JoystickID, unsigned char AxisID)                  -> char Trim
-    25, // [SPECIFIC] -TX: 2 -RX: 1 - Deadzone(unsigned char JoystickID, unsigned char AxisID)              -> char Deadzone
-    26, // [SPECIFIC] -TX: 1 -RX: 1 - Button(unsigned char ButtonID)                                        -> unsigned char buttonState
-    27, // [SPECIFIC] -TX: 5 -RX: 5 - Buttons(uc ButtonA, uc ButtonB, uc ButtonC, uc ButtonD, uc ButtonE)   -> uc ButtonA, uc ButtonB, uc ButtonC, uc ButtonD, uc ButtonE
-    28 // [SPECIFIC] -TX: 3 -RX: 3 - RGB(uc Red, uc Green, uc Blue)                                        -> uc Red, uc Green, uc Blue
+#define _BFIO_ID(id, name) id,
+constexpr unsigned char supportedBFIOIDs[] = {BFIO_FUNCTIONS(_BFIO_ID)};
+#undef _BFIO_ID
+#define _AMOUNT_OF_SUPPORTED_ID ((int)(sizeof(supportedBFIOIDs) / sizeof(supportedBFIOIDs[0])))
+
+/// @brief Slot of a function ID, 0 if unsupported. Only used to generate BFIO_ID_TABLE.
+constexpr unsigned char _BFIOSlotOf(int id, int index)
+{
+    return (index >= _AMOUNT_OF_SUPPORTED_ID) ? (unsigned char)BFIOFunction_None
+         : (supportedBFIOIDs[index] == id)    ? (unsigned char)(index + 1)
+         : _BFIOSlotOf(id, index + 1);
+}
+
+#define _BFIO_SLOTS_4(id)  _BFIOSlotOf((id), 0), _BFIOSlotOf((id) + 1, 0), _BFIOSlotOf((id) + 2, 0), _BFIOSlotOf((id) + 3, 0)
+#define _BFIO_SLOTS_16(id) _BFIO_SLOTS_4(id), _BFIO_SLOTS_4((id) + 4), _BFIO_SLOTS_4((id) + 8), _BFIO_SLOTS_4((id) + 12)
+#define _BFIO_SLOTS_64(id) _BFIO_SLOTS_16(id), _BFIO_SLOTS_16((id) + 16), _BFIO_SLOTS_16((id) + 32), _BFIO_SLOTS_16((id) + 48)
+
+/**
+ * @brief BFIOFunction slot of every possible
+ * function ID, generated at compile time from
+ * BFIO_FUNCTIONS. 0 (BFIOFunction_None) means
+ * the ID is not supported. Checking an ID and
+ * finding what handles it is a single load.
+ */
+constexpr unsigned char BFIO_ID_TABLE[256] = {
+    _BFIO_SLOTS_64(0), _BFIO_SLOTS_64(64), _BFIO_SLOTS_64(128), _BFIO_SLOTS_64(192)
 };
+
+static_assert(BFIOFunction_Count == _AMOUNT_OF_SUPPORTED_ID + 1, "BFIOFunction and supportedBFIOIDs are out of sync");
+static_assert(BFIO_ID_TABLE[28] == BFIOFunction_RGB && BFIO_ID_TABLE[11] == BFIOFunction_None, "BFIO_ID_TABLE was not generated correctly");
 //=============================================//
 //	Classes
 //=============================================//
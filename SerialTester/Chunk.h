@@ -30,6 +30,43 @@
 #include "Globals.h"
 #pragma endregion
 
+#pragma region Defines
+/**
+ * @brief Class of every possible high byte of a
+ * chunk. The class is the ChunkType's high byte
+ * + 1. 0 means the value is not a BFIO chunk.
+ * Only the first 4 entries are set, the rest is 0.
+ */
+constexpr unsigned char CHUNK_CLASS_TABLE[256] = {1, 2, 3, 4};
+
+/// @brief Bit set in a type bitmap when a value that is not a chunk was found.
+#define CHUNK_INVALID_BIT 0x01
+/// @brief Bit set in a type bitmap when a chunk of that ChunkType was found.
+#define CHUNK_TYPE_BIT(type) (1 << (((type) >> 8) + 1))
+
+/**
+ * @brief First byte of every packed UART frame.
+ * In unpacked mode the first byte of a chunk is
+ * always 0 to 3, and in protected mode it is
+ * always above 127, so a device that does not
+ * know about packed frames simply ignores them.
+ */
+#define PACKED_UART_MARKER 0x5A
+/// @brief Marker byte + chunk count byte.
+#define PACKED_UART_HEADER_SIZE 2
+/// @brief Amount of UART bytes of a packed frame holding that many chunks. 4 chunks = 5 bytes.
+#define PACKED_UART_SIZE(chunkCount) (PACKED_UART_HEADER_SIZE + ((chunkCount) * 10 + 7) / 8)
+
+/**
+ * @brief Bit always set in a protected UART chunk.
+ * It is the first bit sent, so the first byte of
+ * a protected chunk is never 0 to 3 nor PACKED_UART_MARKER,
+ * unless the flag itself flipped. It is part of the
+ * code, so that flip is corrected like any other.
+ */
+#define PROTECTED_UART_FLAG 0x8000
+#pragma endregion
+
 #pragma region Class
 /**
  * @brief The Chunk class is a class
@@ -122,6 +159,174 @@ class cChunk
          * @return Execution 
          */
         Execution ToUART(unsigned short chunkToSend, unsigned char* resulted2bytes);
+
+        /**
+         * @brief Packs a whole plane in a single
+         * UART frame where each chunk only takes
+         * its 10 bits. The frame is PACKED_UART_MARKER,
+         * the amount of chunks, then the chunks as a
+         * little endian bitstream padded with 0s.
+         * Only use it once the other side accepted
+         * WireMode::Packed.
+         * @param chunksToSend
+         * The plane to pack.
+         * @param count
+         * Amount of chunks in the plane. 2 to MAX_PLANE_PASSENGER_CAPACITY.
+         * @param resultedBytes
+         * Where the frame is placed. Must hold PACKED_UART_SIZE(count) bytes.
+         * @param resultedSize
+         * Where the amount of bytes of the frame is placed.
+         * @return Execution::Passed = Packed | Execution::Failed = Invalid count or a value is not a chunk
+         */
+        Execution ToPackedUART(unsigned short* chunksToSend, int count, unsigned char* resultedBytes, int* resultedSize);
+
+        /**
+         * @brief Unpacks a frame made by ToPackedUART.
+         * The frame is only accepted if it holds a
+         * plane: a start chunk, byte and div chunks,
+         * then a check chunk. This is what lets a
+         * receiver find the next frame after noise.
+         * @param frame
+         * The received frame, marker included.
+         * @param frameSize
+         * Amount of bytes received.
+         * @param resultedChunks
+         * Where the chunks are placed. Must hold MAX_PLANE_PASSENGER_CAPACITY chunks.
+         * @param resultedCount
+         * Where the amount of chunks is placed.
+         * @return Execution::Passed = Unpacked | Execution::Failed = Not a frame or not a plane | Execution::Incompatibility = frameSize does not match the frame's chunk count
+         */
+        Execution FromPackedUART(unsigned char* frame, int frameSize, unsigned short* resultedChunks, int* resultedCount);
+
+        /**
+         * @brief Same as ToUART, but the 6 bits that
+         * ToUART leaves empty are used. Bits 1 to 15
+         * are a Hamming code of the chunk and of
+         * PROTECTED_UART_FLAG, at bit 15 (parity at
+         * 1, 2, 4 and 8). Bit 0 is the parity of the
+         * whole code.
+         * Only use it once the other side accepted
+         * WireMode::Protected.
+         * @param chunkToSend
+         * The chunk to protect.
+         * @param resulted2bytes
+         * 0: Second to send, 1: First to send. Same as ToUART.
+         * @return Execution::Passed = Protected | Execution::Failed = Value is not a chunk
+         */
+        Execution ToProtectedUART(unsigned short chunkToSend, unsigned char* resulted2bytes);
+
+        /**
+         * @brief Gets the chunk back from 2 bytes
+         * made by ToProtectedUART. A single flipped
+         * bit is corrected, PROTECTED_UART_FLAG
+         * included. Two flipped bits are detected.
+         * 32 of the 1024 unpacked chunks are a
+         * protected chunk whose flag flipped, and
+         * are read as such.
+         * @param received2bytes
+         * 0: Second received, 1: First received.
+         * @param resultedChunk
+         * Where the chunk is placed.
+         * @param corrected
+         * Set to true if a flipped bit was corrected.
+         * @return Execution::Passed = Chunk is good | Execution::Failed = Not a protected chunk or more than one flipped bit
+         */
+        Execution FromProtectedUART(unsigned char* received2bytes, unsigned short* resultedChunk, bool* corrected);
+
+        /**
+         * @brief Class of a chunk from CHUNK_CLASS_TABLE.
+         * 0 = Not a chunk. Otherwise, the chunk's
+         * ChunkType is (class - 1) << 8.
+         * No branches, no error handling. Use it in
+         * loops where ToType is too slow.
+         */
+        static constexpr unsigned char ClassOf(unsigned short chunk)
+        {
+            return CHUNK_CLASS_TABLE[chunk >> 8];
+        }
+
+        /**
+         * @brief Converts a whole array of bytes
+         * to chunks of the same ChunkType.
+         * @param bytesToConvert
+         * Bytes to convert.
+         * @param count
+         * How many bytes to convert.
+         * @param resultedChunks
+         * Where the chunks are placed. Must hold count chunks.
+         * @param typeToApply
+         * ChunkType given to every chunk.
+         * @return Execution::Passed = Converted | Execution::Failed = Invalid ChunkType
+         */
+        Execution ToChunks(unsigned char* bytesToConvert, int count, unsigned short* resultedChunks, int typeToApply);
+
+        /**
+         * @brief Classifies a whole array of chunks
+         * into a bitmap of the ChunkTypes found in it.
+         * See CHUNK_TYPE_BIT and CHUNK_INVALID_BIT.
+         * @param chunksToConvert
+         * Chunks to look at.
+         * @param count
+         * How many chunks to look at.
+         * @param resultedTypeBitmap
+         * Where the bitmap is placed.
+         * @return Execution::Passed = All chunks are valid | Execution::Failed = At least one value is not a chunk
+         */
+        Execution ToTypes(unsigned short* chunksToConvert, int count, unsigned char* resultedTypeBitmap);
+
+        /**
+         * @brief Extracts the byte of a whole
+         * array of chunks, whatever their type.
+         * @param chunksToConvert
+         * Chunks to extract bytes from.
+         * @param count
+         * How many chunks to convert.
+         * @param resultedBytes
+         * Where the bytes are placed. Must hold count bytes.
+         * @return Execution::Passed = Converted | Execution::Failed = At least one value is not a chunk
+         */
+        Execution ToBytes(unsigned short* chunksToConvert, int count, unsigned char* resultedBytes);
+};
+
+/**
+ * @brief Gathers packed UART frames one byte
+ * at a time as they arrive. Bytes are ignored
+ * until a PACKED_UART_MARKER shows up. When a
+ * frame does not unpack to a valid plane, the
+ * receiver drops bytes up to the next marker it
+ * already received and tries again from there.
+ */
+class cPackedUARTReceiver
+{
+    private:
+        /// @brief Bytes of the frame being received.
+        unsigned char _frame[PACKED_UART_SIZE(MAX_PLANE_PASSENGER_CAPACITY)];
+        /// @brief Amount of bytes in _frame.
+        int _received = 0;
+
+        /// @brief Drops the first bytes of _frame, then everything up to the next marker.
+        void _Resync(int from);
+
+    public:
+        /// @brief Last plane that landed.
+        unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+        /// @brief Amount of chunks in plane.
+        int planeSize = 0;
+        /// @brief Amount of bytes thrown away while looking for frames.
+        unsigned long droppedBytes = 0;
+
+        /**
+         * @brief Gives the receiver the next byte
+         * read from the UART.
+         * @return Execution::Passed = A plane landed in plane | Execution::Bypassed = Waiting for more bytes | Execution::Failed = Bytes were dropped and nothing landed
+         */
+        Execution Receive(unsigned char byte);
+
+        /// @brief true while a frame is partially received.
+        bool IsReceiving() { return _received != 0; }
+
+        /// @brief Forgets the frame being received.
+        void Clear() { _received = 0; }
 };
 #pragma endregion
 
@@ -180,28 +180,9 @@ Execution cData::ToBytes(int value, unsigned char* resultedByteArray, int sizeOf
  */
 Execution cData::ToBytes(unsigned long value,       unsigned char* resultedByteArray, int sizeOfGivenArray)
 {
-    _sizeOfByteArray = 8;
-
-    if(sizeOfGivenArray >= _sizeOfByteArray)
-    {
-        for(int i=0; i<8; ++i)
-        {
-            if(i<4) // unsigned long is 8 bytes on a 64 bit architecture... this is a 32 bit architecture. Youpiii.
-            {
-                unsigned long result = (value >> (i*8)) & 0xFF;
-                resultedByteArray[i] = (unsigned char) result;
-            }
-            else
-            {
-                resultedByteArray[i] = 0;
-            }
-        }
-        return Execution::Passed;
-    }
-    else
-    {
-        return Execution::Failed;
-    }   
+    // unsigned long is 4 bytes on the ESP32 and 8 bytes on 64 bit hosts.
+    // Going through unsigned long long gives the same 8 bytes on both.
+    return ToBytes((unsigned long long)value, resultedByteArray, sizeOfGivenArray);
 }
 
 /** @brief Convert a long (8 bytes) to an array of bytes
@@ -213,20 +194,9 @@ Execution cData::ToBytes(unsigned long value,       unsigned char* resultedByteA
  */
 Execution cData::ToBytes(long value, unsigned char* resultedByteArray, int sizeOfGivenArray)
 {
-    _sizeOfByteArray = 8;
-
-    if(sizeOfGivenArray >= _sizeOfByteArray)
-    {
-        unsigned char* p = reinterpret_cast<unsigned char*>(&value);
-        for (int i = 0; i < _sizeOfByteArray; i++) {
-            resultedByteArray[i] = *(p + i);
-        }
-        return Execution::Passed;
-    }
-    else
-    {
-        return Execution::Failed;
-    }
+    // long is 4 bytes on the ESP32 and 8 bytes on 64 bit hosts.
+    // Going through long long gives the same 8 bytes on both.
+    return ToBytes((long long)value, resultedByteArray, sizeOfGivenArray);
 }
 
 /// @brief Convert an unsigned int (4 bytes) to an array of bytes
@@ -622,7 +592,7 @@ Execution cData::ToData(int* value, unsigned char* ConvertedByteArray, int sizeO
 
 /**
  * @brief Convert a byte array to an unsigned long (8 bytes).
- * @attention This decodes ONLY THE FIRST 4 BYTES.
+ * @attention Bytes that do not fit in an unsigned long are dropped.
  * @param value pointer where the resulted data will be placed
  * @param ConvertedByteArray Array obtained from a ToByte function
  * @param sizeOfGivenArray size of the array given to this function
@@ -630,28 +600,18 @@ Execution cData::ToData(int* value, unsigned char* ConvertedByteArray, int sizeO
  */
 Execution cData::ToData(unsigned long* value,       unsigned char* ConvertedByteArray, int sizeOfGivenArray)
 {
-    _sizeOfByteArray = 8;
-
-    if(sizeOfGivenArray >= _sizeOfByteArray)
+    unsigned long long result = 0;
+    Execution execution = ToData(&result, ConvertedByteArray, sizeOfGivenArray);
+    if(execution == Execution::Passed)
     {
-        unsigned long result = 0;
-        for(int i=0; i<4; ++i)
-        {
-            unsigned char convertedByte = ConvertedByteArray[i];
-            result = result + (((unsigned long)convertedByte) << (8*i));
-        }
-        *value = result;
-        return Execution::Passed;
+        *value = (unsigned long)result;
     }
-    else
-    {
-        return Execution::Failed;
-    } 
+    return execution;
 }
 
 /**
  * @brief Convert a byte array to a long (8 bytes).
- * @attention This decodes ONLY THE FIRST 4 BYTES.
+ * @attention Bytes that do not fit in a long are dropped.
  * @param value pointer where the resulted data will be placed
  * @param ConvertedByteArray Array obtained from a ToByte function
  * @param sizeOfGivenArray size of the array given to this function
@@ -659,18 +619,13 @@ Execution cData::ToData(unsigned long* value,       unsigned char* ConvertedByte
  */
 Execution cData::ToData(long* value, unsigned char* ConvertedByteArray, int sizeOfGivenArray)
 {
-    if(sizeOfGivenArray >= 8)
+    long long result = 0;
+    Execution execution = ToData(&result, ConvertedByteArray, sizeOfGivenArray);
+    if(execution == Execution::Passed)
     {
-        unsigned char* p = reinterpret_cast<unsigned char*>(value);
-        for (int i = 0; i < 4; i++) {
-            *(p + i) = ConvertedByteArray[i];
-        }
-        return Execution::Passed;
+        *value = (long)result;
     }
-    else
-    {
-        return Execution::Failed;
-    }  
+    return execution;
 }
 
 /**
@@ -13,8 +13,9 @@
 
 /// @brief Local function that checks if the Master terminal's departures can be used with your plane
 /// @param planeSize 
+/// @param planeID
 /// @return 
-Execution _AskMasterTerminalForDeparture(int planeSize)
+Execution _AskMasterTerminalForDeparture(int planeSize, unsigned char planeID)
 {
     Execution result;
 
@@ -24,7 +25,7 @@ Execution _AskMasterTerminalForDeparture(int planeSize)
         return Execution::Failed;
     }
 
-    result = MasterTerminal.CanPlaneTaxi(planeSize);
+    result = MasterTerminal.CanPlaneTaxi(planeSize, planeID);
     if(result != Execution::Passed)
     {
         // The plane cannot taxi on this terminal's departure taxiway at the moment.
@@ -43,8 +44,9 @@ Execution _AskMasterTerminalForDeparture(int planeSize)
 
 /// @brief Local function that checks if the Slave terminal's departures can be used with your plane
 /// @param planeSize 
+/// @param planeID
 /// @return 
-Execution _AskSlaveTerminalForDeparture(int planeSize)
+Execution _AskSlaveTerminalForDeparture(int planeSize, unsigned char planeID)
 {
     Execution result;
 
@@ -54,7 +56,7 @@ Execution _AskSlaveTerminalForDeparture(int planeSize)
         return Execution::Failed;
     }
 
-    result = SlaveTerminal.CanPlaneTaxi(planeSize);
+    result = SlaveTerminal.CanPlaneTaxi(planeSize, planeID);
     if(result != Execution::Passed)
     {
         // The plane cannot taxi on this terminal's departure taxiway at the moment.
@@ -92,9 +94,12 @@ Execution cGateFoundation::GetStatus(unsigned char* currentStatus)
  * @brief Function that verifies the arrival to make
  * sure its the correct plane that docked to the gate.
  * @param arrivedPacket 
+ * @param arrivedView
+ * View opened over the arrived plane. Gates read
+ * their passengers from it without copying.
  * @return Execution 
  */
-Execution cGateFoundation::_VerifyArrival(unsigned char planeID, unsigned short* arrivedPlane, int planeSize)
+Execution cGateFoundation::_VerifyArrival(unsigned char planeID, unsigned short* arrivedPlane, int planeSize, cPacketView* arrivedView)
 {
     Execution execution;
 
@@ -111,16 +116,15 @@ Execution cGateFoundation::_VerifyArrival(unsigned char planeID, unsigned short*
         return Execution::Failed; 
     }
 
-    // Parse plane.
-    unsigned char amountOfParameters = 0;
-    execution = Packet.GetAmountOfParameters(arrivedPlane, planeSize, &amountOfParameters);
+    // Parse plane once. Segments are read from the view afterwards.
+    execution = arrivedView->Open(arrivedPlane, planeSize);
     if(execution != Execution::Passed)
     {
-        // Failed to get amount of parameters from docking plane.
+        // Failed to index the docking plane.
         return Execution::Crashed;
     }
 
-    if(amountOfParameters != expectedAmountOfParameters)
+    if(arrivedView->GetParameterCount() != expectedAmountOfParameters)
     {
         Device.SetErrorMessage("A plane had too many classes.");
         return Execution::Incompatibility;
@@ -142,6 +146,170 @@ Execution cGateFoundation::_SendErrorPlane(unsigned char errorCode)
     return Execution::Bypassed;
 }
 
+/// @brief Forgets the gate's deadline so the tower never wakes a gate that is gone.
+cGateFoundation::~cGateFoundation()
+{
+    Tower.Cancel(this);
+}
+
+/**
+ * @brief DeadlineCallback of every gate. The
+ * plane that departed did not come back in
+ * time: the gate can send it again and its
+ * next Update reports the failure.
+ * @param gate
+ * The gate, as given to the tower.
+ */
+void cGateFoundation::_ArrivalTimedOut(void* gate)
+{
+    cGateFoundation* self = (cGateFoundation*)gate;
+
+    if(self->status != GateStatus::AwaitingArrival && self->_requestsInFlightCount == 0)
+    {
+        return;
+    }
+
+    // Answers still in flight are given up on with it.
+    self->_requestsInFlightCount = 0;
+    self->_arrivalTimedOut = true;
+    if(self->status == GateStatus::AwaitingArrival)
+    {
+        self->status = GateStatus::ReadyForDeparture;
+    }
+    Device.SetStatus(Status::CommunicationError);
+}
+
+/// @brief Asks the tower to wake this gate if its plane is not back in timeLeftForArrival milliseconds.
+void cGateFoundation::_WatchArrival()
+{
+    // The oldest request in flight is already watched, and times out first.
+    if(_requestsInFlightCount > 0)
+    {
+        return;
+    }
+
+    _arrivalTimedOut = false;
+    Tower.Watch(this, _ArrivalTimedOut, timeLeftForArrival);
+}
+
+/// @brief The plane came back. The tower watches the oldest request still in flight, if any.
+void cGateFoundation::_StopWatchingArrival()
+{
+    if(_requestsInFlightCount > 0)
+    {
+        Tower.WatchUntil(this, _ArrivalTimedOut, _requestsInFlight[0].departedAt + timeLeftForArrival);
+        return;
+    }
+    Tower.Cancel(this);
+}
+
+/**
+ * @brief Remembers a request that departed
+ * with a sequence tag, so its answer can
+ * be matched to it.
+ * @param sequenceTag
+ * Tag the request carried.
+ * @return Execution::Passed = Tracked | Execution::Failed = Too many requests in flight
+ */
+Execution cGateFoundation::_TrackRequest(unsigned char sequenceTag)
+{
+    if(_requestsInFlightCount >= MAX_REQUESTS_IN_FLIGHT)
+    {
+        Device.SetErrorMessage("216:Gate -> Too many in flight");
+        return Execution::Failed;
+    }
+
+    _requestsInFlight[_requestsInFlightCount].sequenceTag = sequenceTag;
+    _requestsInFlight[_requestsInFlightCount].departedAt = millis();
+    _requestsInFlightCount++;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Matches a tagged answer to the
+ * request in flight carrying that tag, and
+ * forgets that request.
+ * @param sequenceTag
+ * Tag the answer carried.
+ * @return Execution::Passed = Matched | Execution::Failed = No request carries that tag
+ */
+Execution cGateFoundation::_MatchAnswer(unsigned char sequenceTag)
+{
+    for(int request = 0; request < _requestsInFlightCount; request++)
+    {
+        if(_requestsInFlight[request].sequenceTag != sequenceTag)
+        {
+            continue;
+        }
+
+        // Keeps the oldest first.
+        for(int next = request + 1; next < _requestsInFlightCount; next++)
+        {
+            _requestsInFlight[next - 1] = _requestsInFlight[next];
+        }
+        _requestsInFlightCount--;
+        return Execution::Passed;
+    }
+
+    Device.SetErrorMessage("252:Gate -> Stray answer      ");
+    return Execution::Failed;
+}
+
+/**
+ * @brief Remembers the tag of a request that
+ * landed, so its answer carries it. Answers
+ * board in the order their requests landed.
+ * @param sequenceTag
+ * Tag the request carried.
+ * @return Execution::Passed = Remembered | Execution::Failed = Too many requests to answer
+ */
+Execution cGateFoundation::_QueueReply(unsigned char sequenceTag)
+{
+    if(_tagsToReplyCount >= MAX_REQUESTS_IN_FLIGHT)
+    {
+        Device.SetErrorMessage("272:Gate -> Too many to reply ");
+        return Execution::Failed;
+    }
+
+    _tagsToReply[_tagsToReplyCount] = sequenceTag;
+    _tagsToReplyCount++;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Takes the tag of the oldest request
+ * still to answer.
+ * @return Its tag. NO_SEQUENCE_TAG if none.
+ */
+int cGateFoundation::_NextReply()
+{
+    int sequenceTag;
+
+    if(_tagsToReplyCount == 0)
+    {
+        return NO_SEQUENCE_TAG;
+    }
+
+    // Keeps the oldest first.
+    sequenceTag = _tagsToReply[0];
+    for(int next = 1; next < _tagsToReplyCount; next++)
+    {
+        _tagsToReply[next - 1] = _tagsToReply[next];
+    }
+    _tagsToReplyCount--;
+    return sequenceTag;
+}
+
+/**
+ * @brief Get the amount of tagged requests
+ * of this gate that await their answer.
+ * @return Amount of requests in flight.
+ */
+int cGateFoundation::GetRequestsInFlight()
+{
+    return _requestsInFlightCount;
+}
+
 
 /**
  * @brief This function returns Execution::Passed if
@@ -153,10 +321,13 @@ Execution cGateFoundation::_CanPlaneTaxiOnMaster()
 {
     Execution execution;
 
-    if(status == GateStatus::ReadyForDeparture)
+    // With sequence tags, more requests can leave while the first ones are still in flight.
+    bool pipelined = status == GateStatus::AwaitingArrival && _requestsInFlightCount > 0 && _requestsInFlightCount < MAX_REQUESTS_IN_FLIGHT;
+
+    if(status == GateStatus::ReadyForDeparture || pipelined)
     {
         // Is the terminal available for planes?
-        execution = _AskMasterTerminalForDeparture(maxSizeOfPlane);
+        execution = _AskMasterTerminalForDeparture(maxSizeOfPlane, gateID);
         if(execution != Execution::Passed)
         {
             // The gate cant allow planes to queue in on the Master terminal's taxiway
@@ -179,6 +350,7 @@ Execution cGateFoundation::_CanPlaneTaxiOnMaster()
             return Execution::Failed;
         }
     
+        _departureQueuedInFlight = pipelined;
         status = GateStatus::JustLeft;
         return Execution::Passed;
     }
@@ -200,7 +372,7 @@ Execution cGateFoundation::_CanPlaneTaxiOnSlave()
     Execution execution;
 
     // Is the terminal available for planes?
-    execution = _AskSlaveTerminalForDeparture(maxSizeOfPlane);
+    execution = _AskSlaveTerminalForDeparture(maxSizeOfPlane, gateID);
     if(execution != Execution::Passed)
     {
         // The gate cant allow planes to queue in on the Slave terminal's taxiway
@@ -243,16 +415,12 @@ cGate_Ping::cGate_Ping()
 /// @return 
 Execution cGate_Ping::Update()
 {
-    // - Gate is waiting for the plane to come back - //
-    if(status == GateStatus::AwaitingArrival)
+    // - The tower woke this gate, its plane never came back - //
+    if(_arrivalTimedOut)
     {
-        timeLeftForArrival--;
-        if(timeLeftForArrival == 0)
-        {
-            Device.SetErrorMessage("283:Gate -> PING FAILED       ");
-            Device.SetStatus(Status::CommunicationError);
-            return Execution::Failed;
-        }
+        _arrivalTimedOut = false;
+        Device.SetErrorMessage("283:Gate -> PING FAILED       ");
+        return Execution::Failed;
     }
     return Execution::Bypassed;
 }
@@ -270,44 +438,36 @@ Execution cGate_Ping::Update()
  */
 Execution cGate_Ping::_GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize)
 {
-    Execution execution;
-    unsigned char convertedVariable[4];
-    unsigned short temporaryBuffer[4];
-
     if(status != GateStatus::JustLeft)
     {
         Device.SetErrorMessage("207:Gates Inexisting plane    ");
         return Execution::Unecessary;
     }
 
-    // Convert variable to passengers
-    execution = Data.ToBytes(_ping, convertedVariable, 1);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("215:Gate -> Data.ToBytes      ");
-        return Execution::Crashed;
-    }
-
-    // Convert passengers into seated passengers
-    execution = Packet.GetParameterSegmentFromBytes(convertedVariable, temporaryBuffer, 1, 2);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("222:Gate -> Packet.GetParamSeg");
-        return Execution::Crashed;
-    }
-
-    // Put the seated passengers in a plane.
-    int resultedPacketSize = 4;
-    execution = Packet.CreateFromSegments(gateID, temporaryBuffer, 4, departingPlane, resultedPacketSize);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("230:Gate -> Packet.CreateFromS");
-        return Execution::Crashed;
-    }
+    // Seat the passengers straight in the departing plane.
+    cPlane_Ping::Encode(departingPlane, _ping);
 
-    *planeSize = 4;
+    *planeSize = cPlane_Ping::size;
     status = GateStatus::AwaitingArrival;
-    timeLeftForArrival = TIMEOUT_DURATION_MS;
+    _WatchArrival();
+    return Execution::Passed;
+}
+/**
+ * @brief Builds the answer to the request
+ * that docked through _DockMasterPlaneArrival.
+ * This function is called when that answer
+ * leaves the slave terminal's taxiway.
+ * 
+ * @param departingPlane 
+ * Array of chunks where the packet will be placed
+ * @param planeSize 
+ * The size of the packet to send.
+ * @return Execution 
+ */
+Execution cGate_Ping::_GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize)
+{
+    cPlane_Ping::Encode(departingPlane, _pingToReply);
+    *planeSize = cPlane_Ping::size;
     return Execution::Passed;
 }
 /**
@@ -326,36 +486,27 @@ Execution cGate_Ping::_GetDepartingMasterPlane(unsigned short* departingPlane, i
 Execution cGate_Ping::_DockSlavePlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
 {
     Execution execution;
-    unsigned char valuesArray[4];
-
-    // Get the whole plane through TSA
-    execution = _VerifyArrival(planeID, planeToDock, planeSize);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("262:Gate -> _VerifyArrival    ");
-        return execution;
-    }
+    bool result;
 
-    // Extract the passengers from the plane
-    execution = Packet.GetBytes(planeToDock, planeSize, 1, valuesArray, 1);
-    if(execution != Execution::Passed)
+    // Do the plane ID and gate ID match?
+    if(gateID != planeID)
     {
-        Device.SetErrorMessage("269:Gate -> Packet.GetBytes   ");
+        Device.SetErrorMessage("310:Gate -> Wrong gate        ");
         return Execution::Failed;
     }
 
-    // Get the variable from the passengers
-    bool result;
-    execution = Data.ToData(&result, valuesArray, 1);
+    // Get the passengers through TSA and off the plane
+    execution = cPlane_Ping::Decode(planeToDock, planeSize, &result);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("278:Gate -> Data.ToData       ");
-        return Execution::Crashed;
+        Device.SetErrorMessage("318:Gate -> Schema Decode     ");
+        return execution;
     }
 
     // Holy shit data should be good here riiight?
     _ping = result;
     status = GateStatus::AvailableArrival;
+    _StopWatchingArrival();
 
 
 
@@ -376,31 +527,21 @@ Execution cGate_Ping::_DockSlavePlaneArrival(unsigned char planeID, unsigned sho
 Execution cGate_Ping::_DockMasterPlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
 {
     Execution execution;
-    unsigned char valuesArray[4];
-
-    // Get the whole plane through TSA
-    execution = _VerifyArrival(planeID, planeToDock, planeSize);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("316:Gate -> _VerifyArrival    ");
-        return execution;
-    }
+    bool result;
 
-    // Extract the passengers from the plane
-    execution = Packet.GetBytes(planeToDock, planeSize, 1, valuesArray, 1);
-    if(execution != Execution::Passed)
+    // Do the plane ID and gate ID match?
+    if(gateID != planeID)
     {
-        Device.SetErrorMessage("324:Gate -> Packet.GetBytes   ");
+        Device.SetErrorMessage("350:Gate -> Wrong gate        ");
         return Execution::Failed;
     }
 
-    // Get the variable from the passengers
-    bool result;
-    execution = Data.ToData(&result, valuesArray, 1);
+    // Get the passengers through TSA and off the plane
+    execution = cPlane_Ping::Decode(planeToDock, planeSize, &result);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("333:Gate -> Data.ToData       ");
-        return Execution::Crashed;
+        Device.SetErrorMessage("358:Gate -> Schema Decode     ");
+        return execution;
     }
 
     // Holy shit data should be good here riiight?
@@ -485,16 +626,12 @@ cGate_Status::cGate_Status()
 /// @return 
 Execution cGate_Status::Update()
 {
-    // - Gate is waiting for the plane to come back - //
-    if(status == GateStatus::AwaitingArrival)
+    // - The tower woke this gate, its plane never came back - //
+    if(_arrivalTimedOut)
     {
-        timeLeftForArrival--;
-        if(timeLeftForArrival == 0)
-        {
-            Device.SetErrorMessage("502:Gate -> STATUS FAILED     ");
-            Device.SetStatus(Status::CommunicationError);
-            return Execution::Failed;
-        }
+        _arrivalTimedOut = false;
+        Device.SetErrorMessage("502:Gate -> STATUS FAILED     ");
+        return Execution::Failed;
     }
     return Execution::Bypassed;  
 }
@@ -512,44 +649,38 @@ Execution cGate_Status::Update()
  */
 Execution cGate_Status::_GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize)
 {
-    Execution execution;
-    unsigned char convertedVariable[4];
-    unsigned short temporaryBuffer[5];
-
     if(status != GateStatus::JustLeft)
     {
         Device.SetErrorMessage("529:Gates Inexisting plane    ");
         return Execution::Unecessary;
     }
 
-    // Convert variable to passengers
-    execution = Data.ToBytes(_status, convertedVariable, 4);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("537:Gate -> Data.ToBytes      ");
-        return Execution::Crashed;
-    }
-
-    // Convert passengers into seated passengers
-    execution = Packet.GetParameterSegmentFromBytes(convertedVariable, temporaryBuffer, 4, 5);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("222:Gate -> Packet.GetParamSeg");
-        return Execution::Crashed;
-    }
-
-    // Put the seated passengers in a plane.
-    int resultedPacketSize = 7;
-    execution = Packet.CreateFromSegments(gateID, temporaryBuffer, 5, departingPlane, resultedPacketSize);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("554:Gate -> Packet.CreateFromS");
-        return Execution::Crashed;
-    }
+    // Seat the passengers straight in the departing plane.
+    cPlane_Status::Encode(departingPlane, _status);
 
-    *planeSize = 4;
+    *planeSize = cPlane_Status::size;
     status = GateStatus::AwaitingArrival;
-    timeLeftForArrival = TIMEOUT_DURATION_MS;
+    _WatchArrival();
+    return Execution::Passed;
+}
+/**
+ * @brief Builds the answer to the request
+ * that docked through _DockMasterPlaneArrival.
+ * This function is called when that answer
+ * leaves the slave terminal's taxiway.
+ * 
+ * @param departingPlane 
+ * Array of chunks where the packet will be placed
+ * @param planeSize 
+ * The size of the packet to send.
+ * @return Execution 
+ */
+Execution cGate_Status::_GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize)
+{
+    // The status as it is when the answer leaves.
+    Device.GetStatus(&_statusToReply);
+    cPlane_Status::Encode(departingPlane, _statusToReply);
+    *planeSize = cPlane_Status::size;
     return Execution::Passed;
 }
 /**
@@ -568,36 +699,27 @@ Execution cGate_Status::_GetDepartingMasterPlane(unsigned short* departingPlane,
 Execution cGate_Status::_DockSlavePlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
 {
     Execution execution;
-    unsigned char valuesArray[4];
-
-    // Get the whole plane through TSA
-    execution = _VerifyArrival(planeID, planeToDock, planeSize);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("585:Gate -> _VerifyArrival    ");
-        return execution;
-    }
+    int result;
 
-    // Extract the passengers from the plane
-    execution = Packet.GetBytes(planeToDock, planeSize, 1, valuesArray, 4);
-    if(execution != Execution::Passed)
+    // Do the plane ID and gate ID match?
+    if(gateID != planeID)
     {
-        Device.SetErrorMessage("593:Gate -> Packet.GetBytes   ");
+        Device.SetErrorMessage("506:Gate -> Wrong gate        ");
         return Execution::Failed;
     }
 
-    // Get the variable from the passengers
-    int result;
-    execution = Data.ToData(&result, valuesArray, 4);
+    // Get the passengers through TSA and off the plane
+    execution = cPlane_Status::Decode(planeToDock, planeSize, &result);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("602:Gate -> Data.ToData       ");
-        return Execution::Crashed;
+        Device.SetErrorMessage("514:Gate -> Schema Decode     ");
+        return execution;
     }
 
     // Holy shit data should be good here riiight?
     _receivedStatus = result;
     status = GateStatus::AvailableArrival;
+    _StopWatchingArrival();
 
     return Execution::Passed;   
 }
@@ -616,31 +738,21 @@ Execution cGate_Status::_DockSlavePlaneArrival(unsigned char planeID, unsigned s
 Execution cGate_Status::_DockMasterPlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
 {
     Execution execution;
-    unsigned char valuesArray[4];
-
-    // Get the whole plane through TSA
-    execution = _VerifyArrival(planeID, planeToDock, planeSize);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("634:Gate -> _VerifyArrival    ");
-        return execution;
-    }
+    int result;
 
-    // Extract the passengers from the plane
-    execution = Packet.GetBytes(planeToDock, planeSize, 1, valuesArray, 4);
-    if(execution != Execution::Passed)
+    // Do the plane ID and gate ID match?
+    if(gateID != planeID)
     {
-        Device.SetErrorMessage("642:Gate -> Packet.GetBytes   ");
+        Device.SetErrorMessage("544:Gate -> Wrong gate        ");
         return Execution::Failed;
     }
 
-    // Get the variable from the passengers
-    bool result;
-    execution = Data.ToData(&result, valuesArray, 4);
+    // Get the passengers through TSA and off the plane
+    execution = cPlane_Status::Decode(planeToDock, planeSize, &result);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("651:Gate -> Data.ToData       ");
-        return Execution::Crashed;
+        Device.SetErrorMessage("552:Gate -> Schema Decode     ");
+        return execution;
     }
 
     // Holy shit data should be good here riiight?
@@ -724,16 +836,12 @@ cGate_ID::cGate_ID()
 /// @return 
 Execution cGate_ID::Update()
 {
-    // - Gate is waiting for the plane to come back - //
-    if(status == GateStatus::AwaitingArrival)
+    // - The tower woke this gate, its plane never came back - //
+    if(_arrivalTimedOut)
     {
-        timeLeftForArrival--;
-        if(timeLeftForArrival == 0)
-        {
-            Device.SetErrorMessage("727:Gate -> ID FAILED         ");
-            Device.SetStatus(Status::CommunicationError);
-            return Execution::Failed;
-        }
+        _arrivalTimedOut = false;
+        Device.SetErrorMessage("727:Gate -> ID FAILED         ");
+        return Execution::Failed;
     }
     return Execution::Bypassed;  
 }
@@ -751,44 +859,36 @@ Execution cGate_ID::Update()
  */
 Execution cGate_ID::_GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize)
 {
-    Execution execution;
-    unsigned char convertedVariable[8];
-    unsigned short temporaryBuffer[9];
-
     if(status != GateStatus::JustLeft)
     {
         Device.SetErrorMessage("754:Gates Inexisting plane    ");
         return Execution::Unecessary;
     }
 
-    // Convert variable to passengers
-    execution = Data.ToBytes(_ID, convertedVariable, 8);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("762:Gate -> Data.ToBytes      ");
-        return Execution::Crashed;
-    }
-
-    // Convert passengers into seated passengers
-    execution = Packet.GetParameterSegmentFromBytes(convertedVariable, temporaryBuffer, 8, 9);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("770:Gate -> Packet.GetParamSeg");
-        return Execution::Crashed;
-    }
-
-    // Put the seated passengers in a plane.
-    int resultedPacketSize = 9;
-    execution = Packet.CreateFromSegments(gateID, temporaryBuffer, 9, departingPlane, resultedPacketSize);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("779:Gate -> Packet.CreateFromS");
-        return Execution::Crashed;
-    }
+    // Seat the passengers straight in the departing plane.
+    cPlane_ID::Encode(departingPlane, _ID);
 
-    *planeSize = 11;
+    *planeSize = cPlane_ID::size;
     status = GateStatus::AwaitingArrival;
-    timeLeftForArrival = TIMEOUT_DURATION_MS;
+    _WatchArrival();
+    return Execution::Passed;
+}
+/**
+ * @brief Builds the answer to the request
+ * that docked through _DockMasterPlaneArrival.
+ * This function is called when that answer
+ * leaves the slave terminal's taxiway.
+ * 
+ * @param departingPlane 
+ * Array of chunks where the packet will be placed
+ * @param planeSize 
+ * The size of the packet to send.
+ * @return Execution 
+ */
+Execution cGate_ID::_GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize)
+{
+    cPlane_ID::Encode(departingPlane, _ID);
+    *planeSize = cPlane_ID::size;
     return Execution::Passed;
 }
 /**
@@ -807,36 +907,27 @@ Execution cGate_ID::_GetDepartingMasterPlane(unsigned short* departingPlane, int
 Execution cGate_ID::_DockSlavePlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
 {
     Execution execution;
-    unsigned char valuesArray[8];
+    unsigned long long result;
 
-    // Get the whole plane through TSA
-    execution = _VerifyArrival(planeID, planeToDock, planeSize);
-    if(execution != Execution::Passed)
+    // Do the plane ID and gate ID match?
+    if(gateID != planeID)
     {
-        Device.SetErrorMessage("585:Gate -> _VerifyArrival    ");
-        return execution;
+        Device.SetErrorMessage("699:Gate -> Wrong gate        ");
+        return Execution::Failed;
     }
 
-    // Extract the passengers from the plane
-    execution = Packet.GetBytes(planeToDock, planeSize, 1, valuesArray, 8);
+    // Get the passengers through TSA and off the plane
+    execution = cPlane_ID::Decode(planeToDock, planeSize, &result);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("818:Gate -> Packet.GetBytes   ");
-        return Execution::Failed;
-    }
-
-    // Get the variable from the passengers
-    int result;
-    execution = Data.ToData(&result, valuesArray, 8);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("827:Gate -> Data.ToData       ");
-        return Execution::Crashed;
+        Device.SetErrorMessage("707:Gate -> Schema Decode     ");
+        return execution;
     }
 
     // Holy shit data should be good here riiight?
     _receivedID = result;
     status = GateStatus::AvailableArrival;
+    _StopWatchingArrival();
 
     return Execution::Passed;   
 }
@@ -855,31 +946,21 @@ Execution cGate_ID::_DockSlavePlaneArrival(unsigned char planeID, unsigned short
 Execution cGate_ID::_DockMasterPlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
 {
     Execution execution;
-    unsigned char valuesArray[8];
-
-    // Get the whole plane through TSA
-    execution = _VerifyArrival(planeID, planeToDock, planeSize);
-    if(execution != Execution::Passed)
-    {
-        Device.SetErrorMessage("858:Gate -> _VerifyArrival    ");
-        return execution;
-    }
+    unsigned long long result;
 
-    // Extract the passengers from the plane
-    execution = Packet.GetBytes(planeToDock, planeSize, 1, valuesArray, 8);
-    if(execution != Execution::Passed)
+    // Do the plane ID and gate ID match?
+    if(gateID != planeID)
     {
-        Device.SetErrorMessage("866:Gate -> Packet.GetBytes   ");
+        Device.SetErrorMessage("737:Gate -> Wrong gate        ");
         return Execution::Failed;
     }
 
-    // Get the variable from the passengers
-    bool result;
-    execution = Data.ToData(&result, valuesArray, 8);
+    // Get the passengers through TSA and off the plane
+    execution = cPlane_ID::Decode(planeToDock, planeSize, &result);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("875:Gate -> Data.ToData       ");
-        return Execution::Crashed;
+        Device.SetErrorMessage("745:Gate -> Schema Decode     ");
+        return execution;
     }
 
     // Holy shit data should be good here riiight?
@@ -955,7 +1036,7 @@ cGate_UniversalInfo::cGate_UniversalInfo()
     expectedAmountOfParameters = UNIVERSALINFO_PARAM_COUNT;
     status = GateStatus::ReadyForDeparture;
     gateID = UNIVERSALINFO_PLANE_ID;
-    maxSizeOfPlane = 100;
+    maxSizeOfPlane = MAX_PLANE_PASSENGER_CAPACITY;
     built = true;
     /*
     Device.GetStatus(&_status);
@@ -965,16 +1046,12 @@ cGate_UniversalInfo::cGate_UniversalInfo()
 /// @return 
 Execution cGate_UniversalInfo::Update()
 {
-    // - Gate is waiting for the plane to come back - //
-    if(status == GateStatus::AwaitingArrival)
+    // - The tower woke this gate, its plane never came back - //
+    if(_arrivalTimedOut)
     {
-        timeLeftForArrival--;
-        if(timeLeftForArrival == 0)
-        {
-            Device.SetErrorMessage("727:Gate -> ID FAILED         ");
-            Device.SetStatus(Status::CommunicationError);
-            return Execution::Failed;
-        }
+        _arrivalTimedOut = false;
+        Device.SetErrorMessage("727:Gate -> ID FAILED         ");
+        return Execution::Failed;
     }
     return Execution::Bypassed;  
 }
@@ -993,8 +1070,6 @@ Execution cGate_UniversalInfo::Update()
 Execution cGate_UniversalInfo::_GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize)
 {
     Execution execution;
-    unsigned char convertedVariable[8];
-    unsigned short temporaryBuffer[9];
 
     if(status != GateStatus::JustLeft)
     {
@@ -1002,6 +1077,33 @@ Execution cGate_UniversalInfo::_GetDepartingMasterPlane(unsigned short* departin
         return Execution::Unecessary;
     }
 
+    execution = _SeatPassengers(departingPlane, planeSize);
+    if(execution != Execution::Passed)
+    {
+        return execution;
+    }
+
+    status = GateStatus::AwaitingArrival;
+    _WatchArrival();
+    return Execution::Passed;
+}
+/**
+ * @brief Seats this gate's ID in a plane.
+ * Requests and answers carry the same
+ * passengers.
+ * 
+ * @param departingPlane 
+ * Array of chunks where the packet will be placed
+ * @param planeSize 
+ * The size of the packet to send.
+ * @return Execution 
+ */
+Execution cGate_UniversalInfo::_SeatPassengers(unsigned short* departingPlane, int* planeSize)
+{
+    Execution execution;
+    unsigned char convertedVariable[8];
+    unsigned short temporaryBuffer[9];
+
     // Convert variable to passengers
     execution = Data.ToBytes(_ID, convertedVariable, 8);
     if(execution != Execution::Passed)
@@ -1028,10 +1130,24 @@ Execution cGate_UniversalInfo::_GetDepartingMasterPlane(unsigned short* departin
     }
 
     *planeSize = 11;
-    status = GateStatus::AwaitingArrival;
-    timeLeftForArrival = TIMEOUT_DURATION_MS;
     return Execution::Passed;
 }
+/**
+ * @brief Builds the answer to the request
+ * that docked through _DockMasterPlaneArrival.
+ * This function is called when that answer
+ * leaves the slave terminal's taxiway.
+ * 
+ * @param departingPlane 
+ * Array of chunks where the packet will be placed
+ * @param planeSize 
+ * The size of the packet to send.
+ * @return Execution 
+ */
+Execution cGate_UniversalInfo::_GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize)
+{
+    return _SeatPassengers(departingPlane, planeSize);
+}
 /**
  * @brief Attempt to dock a plane
  * carrying the answer to the request
@@ -1048,10 +1164,11 @@ Execution cGate_UniversalInfo::_GetDepartingMasterPlane(unsigned short* departin
 Execution cGate_UniversalInfo::_DockSlavePlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
 {
     Execution execution;
-    unsigned char valuesArray[8];
+    cPacketView view;
+    cSegmentView segment;
 
     // Get the whole plane through TSA
-    execution = _VerifyArrival(planeID, planeToDock, planeSize);
+    execution = _VerifyArrival(planeID, planeToDock, planeSize, &view);
     if(execution != Execution::Passed)
     {
         Device.SetErrorMessage("585:Gate -> _VerifyArrival    ");
@@ -1059,25 +1176,26 @@ Execution cGate_UniversalInfo::_DockSlavePlaneArrival(unsigned char planeID, uns
     }
 
     // Extract the passengers from the plane
-    execution = Packet.GetBytes(planeToDock, planeSize, 1, valuesArray, 8);
+    execution = view.GetSegment(1, &segment);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("818:Gate -> Packet.GetBytes   ");
+        Device.SetErrorMessage("1074:Gate -> view.GetSegment   ");
         return Execution::Failed;
     }
 
     // Get the variable from the passengers
-    int result;
-    execution = Data.ToData(&result, valuesArray, 8);
+    unsigned long long result;
+    execution = segment.ToData(&result);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("827:Gate -> Data.ToData       ");
+        Device.SetErrorMessage("1083:Gate -> segment.ToData    ");
         return Execution::Crashed;
     }
 
     // Holy shit data should be good here riiight?
     _receivedID = result;
     status = GateStatus::AvailableArrival;
+    _StopWatchingArrival();
 
     return Execution::Passed;   
 }
@@ -1096,10 +1214,11 @@ Execution cGate_UniversalInfo::_DockSlavePlaneArrival(unsigned char planeID, uns
 Execution cGate_UniversalInfo::_DockMasterPlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
 {
     Execution execution;
-    unsigned char valuesArray[8];
+    cPacketView view;
+    cSegmentView segment;
 
     // Get the whole plane through TSA
-    execution = _VerifyArrival(planeID, planeToDock, planeSize);
+    execution = _VerifyArrival(planeID, planeToDock, planeSize, &view);
     if(execution != Execution::Passed)
     {
         Device.SetErrorMessage("858:Gate -> _VerifyArrival    ");
@@ -1107,19 +1226,19 @@ Execution cGate_UniversalInfo::_DockMasterPlaneArrival(unsigned char planeID, un
     }
 
     // Extract the passengers from the plane
-    execution = Packet.GetBytes(planeToDock, planeSize, 1, valuesArray, 8);
+    execution = view.GetSegment(1, &segment);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("866:Gate -> Packet.GetBytes   ");
+        Device.SetErrorMessage("1123:Gate -> view.GetSegment   ");
         return Execution::Failed;
     }
 
     // Get the variable from the passengers
-    bool result;
-    execution = Data.ToData(&result, valuesArray, 8);
+    unsigned long long result;
+    execution = segment.ToData(&result);
     if(execution != Execution::Passed)
     {
-        Device.SetErrorMessage("875:Gate -> Data.ToData       ");
+        Device.SetErrorMessage("1132:Gate -> segment.ToData    ");
         return Execution::Crashed;
     }
 
@@ -1189,6 +1308,351 @@ Execution cGate_UniversalInfo::Read()
     */
     return Execution::Crashed;
 }
+/**
+ * @brief Makes this gate unload the passengers
+ * of UniversalInfo planes landing on that
+ * terminal while they are still landing. The
+ * received values are set, and the gate becomes
+ * GateStatus::AvailableArrival, in the same call
+ * that lands the plane's Check chunk.
+ * @param terminal
+ * The terminal planes land on.
+ * @return Execution 
+ */
+Execution cGate_UniversalInfo::DockCutThrough(cTerminal* terminal)
+{
+    _stagedSegments = 0;
+    return terminal->SetCutThroughGate(gateID, this, &cGate_UniversalInfo::_StageSegment, &cGate_UniversalInfo::_LandStagedPlane);
+}
+/**
+ * @brief SegmentArrivalCallback of this gate.
+ * Decodes one segment into the staged values.
+ * Segments come in order, starting at 1.
+ * @return Execution::Passed = Staged | Execution::Failed = Segment does not fit UniversalInfo
+ */
+Execution cGate_UniversalInfo::_StageSegment(void* gate, unsigned char, int segmentNumber, cSegmentView* segment)
+{
+    cGate_UniversalInfo* self = (cGate_UniversalInfo*)gate;
+    Execution execution;
+
+    switch(segmentNumber)
+    {
+        case(1): execution = segment->ToData(&self->_stagedID);             break;
+        case(2): execution = segment->ToData(&self->_stagedBFIO);           break;
+        case(3): execution = segment->ToData(&self->_stagedType);           break;
+        case(4): execution = segment->ToData(&self->_stagedStatus);         break;
+        case(5): execution = segment->ToData(self->_stagedGitRepository);   break;
+        case(6): execution = segment->ToData(self->_stagedDeviceName);      break;
+        case(7): execution = segment->ToData(self->_stagedRevision);        break;
+        default: execution = Execution::Failed;                             break;
+    }
+
+    if(execution != Execution::Passed)
+    {
+        return Execution::Failed;
+    }
+    self->_stagedSegments = segmentNumber;
+    return Execution::Passed;
+}
+/**
+ * @brief PlaneLandingCallback of this gate.
+ * Commits the staged values if the plane's
+ * check was verified and every parameter was
+ * staged. Otherwise they are thrown away.
+ */
+void cGate_UniversalInfo::_LandStagedPlane(void* gate, unsigned char, bool landed)
+{
+    cGate_UniversalInfo* self = (cGate_UniversalInfo*)gate;
+    int stagedSegments = self->_stagedSegments;
+
+    self->_stagedSegments = 0;
+    if(!landed || stagedSegments != UNIVERSALINFO_PARAM_COUNT)
+    {
+        return;
+    }
+
+    self->_receivedID = self->_stagedID;
+    self->_receivedBFIO = self->_stagedBFIO;
+    self->_receivedType = self->_stagedType;
+    self->_receivedStatus = self->_stagedStatus;
+    self->_receivedGitRepository.swap(self->_stagedGitRepository);
+    self->_receivedDeviceName.swap(self->_stagedDeviceName);
+    self->_receivedRevision.swap(self->_stagedRevision);
+    self->status = GateStatus::AvailableArrival;
+    self->_StopWatchingArrival();
+}
+/**
+ * @brief Get the values the last UniversalInfo
+ * plane carried.
+ * @return Execution::Passed = Values placed | Execution::Bypassed = Nothing to read.
+ */
+Execution cGate_UniversalInfo::ReadInfo(unsigned long long* deviceID, unsigned char* deviceType, std::string* deviceName, std::string* revision)
+{
+    if(status != GateStatus::AvailableArrival)
+    {
+        // There is no plane to get passengers from.
+        return Execution::Bypassed;
+    }
+
+    *deviceID = _receivedID;
+    *deviceType = _receivedType;
+    *deviceName = _receivedDeviceName;
+    *revision = _receivedRevision;
+    status = GateStatus::ReadyForDeparture;
+    return Execution::Passed;
+}
+#pragma endregion
+
+#pragma region SPECIFIC
+static_assert(RESPONSECURVE_POINT_COUNT == JOYSTICK_CURVE_POINTS, "ResponseCurve planes must carry every point of the custom curve");
+
+#pragma region --- ResponseCurve
+/// @brief Constructor
+cGate_ResponseCurve::cGate_ResponseCurve()
+{
+    expectedAmountOfParameters = RESPONSECURVE_PARAM_COUNT;
+    status = GateStatus::ReadyForDeparture;
+    gateID = RESPONSECURVE_PLANE_ID;
+    maxSizeOfPlane = RESPONSECURVE_PASSENGER_CAPACITY;
+    built = true;
+}
+/// @brief Time base handler of the object.
+/// @return 
+Execution cGate_ResponseCurve::Update()
+{
+    // - The tower woke this gate, its plane never came back - //
+    if(_arrivalTimedOut)
+    {
+        _arrivalTimedOut = false;
+        Device.SetErrorMessage("1285:Gate -> CURVE FAILED     ");
+        return Execution::Failed;
+    }
+    return Execution::Bypassed;
+}
+/**
+ * @brief This method places the departing of a plane
+ * into a departing buffer to be sent on the runway.
+ * This function is called when the plane is taking off
+ * and finished taxiing.
+ * 
+ * @param departingPlane 
+ * Array of chunks where the packet will be placed
+ * @param planeSize 
+ * The size of the packet to send.
+ * @return Execution 
+ */
+Execution cGate_ResponseCurve::_GetDepartingMasterPlane(unsigned short* departingPlane, int* planeSize)
+{
+    if(status != GateStatus::JustLeft)
+    {
+        Device.SetErrorMessage("1306:Gates Inexisting plane   ");
+        return Execution::Unecessary;
+    }
+
+    // Seat the passengers straight in the departing plane.
+    cPlane_ResponseCurve::Encode(departingPlane, _settings.joystickID, _settings.curve, _settings.strength, _settings.radialDeadzone,
+                                 _settings.points[0], _settings.points[1], _settings.points[2], _settings.points[3],
+                                 _settings.points[4], _settings.points[5], _settings.points[6], _settings.points[7]);
+
+    *planeSize = cPlane_ResponseCurve::size;
+    status = GateStatus::AwaitingArrival;
+    _WatchArrival();
+    return Execution::Passed;
+}
+/**
+ * @brief Builds the answer to the request
+ * that docked through _DockMasterPlaneArrival.
+ * This function is called when that answer
+ * leaves the slave terminal's taxiway.
+ * 
+ * @param departingPlane 
+ * Array of chunks where the packet will be placed
+ * @param planeSize 
+ * The size of the packet to send.
+ * @return Execution 
+ */
+Execution cGate_ResponseCurve::_GetDepartingSlavePlane(unsigned short* departingPlane, int* planeSize)
+{
+    // What the joystick ended up using, see _DockMasterPlaneArrival.
+    cPlane_ResponseCurve::Encode(departingPlane, _settingsToReply.joystickID, _settingsToReply.curve, _settingsToReply.strength, _settingsToReply.radialDeadzone,
+                                 _settingsToReply.points[0], _settingsToReply.points[1], _settingsToReply.points[2], _settingsToReply.points[3],
+                                 _settingsToReply.points[4], _settingsToReply.points[5], _settingsToReply.points[6], _settingsToReply.points[7]);
+    *planeSize = cPlane_ResponseCurve::size;
+    return Execution::Passed;
+}
+
+/// @brief Gets a ResponseCurve plane's passengers through TSA. Nothing is written unless the plane is valid.
+static Execution _DecodeResponseCurve(unsigned short* planeToDock, int planeSize, cResponseCurveSettings* settings)
+{
+    return cPlane_ResponseCurve::Decode(planeToDock, planeSize, &settings->joystickID, &settings->curve, &settings->strength, &settings->radialDeadzone,
+                                        &settings->points[0], &settings->points[1], &settings->points[2], &settings->points[3],
+                                        &settings->points[4], &settings->points[5], &settings->points[6], &settings->points[7]);
+}
+/**
+ * @brief Attempt to dock a plane
+ * carrying the answer to the request
+ * sent through the Request function.
+ * 
+ * @param planeID
+ * The ID of the plane attempting to dock
+ * @param planeToDock
+ * Array of chunks.
+ * @param planeSize 
+ * Size of the plane (how big is the array of chunks)
+ * @return Execution 
+ */
+Execution cGate_ResponseCurve::_DockSlavePlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
+{
+    Execution execution;
+
+    // Do the plane ID and gate ID match?
+    if(gateID != planeID)
+    {
+        Device.SetErrorMessage("1348:Gate -> Wrong gate       ");
+        return Execution::Failed;
+    }
+
+    execution = _DecodeResponseCurve(planeToDock, planeSize, &_receivedSettings);
+    if(execution != Execution::Passed)
+    {
+        Device.SetErrorMessage("1355:Gate -> Schema Decode    ");
+        return execution;
+    }
+
+    status = GateStatus::AvailableArrival;
+    _StopWatchingArrival();
+    return Execution::Passed;
+}
+/**
+ * @brief Attempt to dock a function
+ * request to this gate. The settings it
+ * carries are applied to the joystick
+ * before it leaves the gate.
+ * 
+ * @param planeID
+ * The ID of the plane attempting to dock
+ * @param planeToDock
+ * Array of chunks.
+ * @param planeSize 
+ * Size of the plane (how big is the array of chunks)
+ * @return Execution 
+ */
+Execution cGate_ResponseCurve::_DockMasterPlaneArrival(unsigned char planeID, unsigned short* planeToDock, int planeSize)
+{
+    Execution execution;
+
+    // Do the plane ID and gate ID match?
+    if(gateID != planeID)
+    {
+        Device.SetErrorMessage("1384:Gate -> Wrong gate       ");
+        return Execution::Failed;
+    }
+
+    execution = _DecodeResponseCurve(planeToDock, planeSize, &_receivedSettings);
+    if(execution != Execution::Passed)
+    {
+        Device.SetErrorMessage("1391:Gate -> Schema Decode    ");
+        return execution;
+    }
+
+    // Settings that cannot be applied are answered with the ones still in use.
+    ApplyResponseCurveSettings(&_receivedSettings, &_settingsToReply);
+    status = GateStatus::AvailableArrival;
+
+    // Can the plane taxi on the slave's runway?
+    execution = _CanPlaneTaxiOnSlave();
+    if(execution != Execution::Passed)
+    {
+        //Plane could not taxi on the departure taxiway :(
+        return execution;
+    }
+
+    return Execution::Passed;
+}
+/**
+ * @brief The method called to send settings
+ * to the other device and await the ones it
+ * applied.
+ * @return Execution::Passed = settings are sending
+ */
+Execution cGate_ResponseCurve::Request(const cResponseCurveSettings* settings)
+{
+    Execution execution;
+
+    // Can the plane taxi on da runway?
+    execution = _CanPlaneTaxiOnMaster();
+    if(execution != Execution::Passed)
+    {
+        //Plane could not taxi on the departure taxiway :(
+        return execution;
+    }
+
+    _settings = *settings;
+    status = GateStatus::JustLeft;
+    return Execution::Passed;
+}
+/**
+ * @brief This reads if any passengers just
+ * finished unloading from the plane.
+ * @return Execution::Passed = Reading worked | Execution::Bypassed = Nothing to read.
+ */
+Execution cGate_ResponseCurve::Read(cResponseCurveSettings* resultedSettings)
+{
+    if(status != GateStatus::AvailableArrival)
+    {
+        // There is no plane to get passengers from.
+        return Execution::Bypassed;
+    }
+
+    *resultedSettings = _receivedSettings;
+    status = GateStatus::ReadyForDeparture;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Applies response curve settings to
+ * one of the joysticks, then gets back what
+ * it ended up using.
+ * @param settings
+ * What to apply.
+ * @param appliedSettings
+ * Where what the joystick uses is placed.
+ * @return Execution::Passed = Applied | Execution::Failed = No such joystick, curve or radial deadzone
+ */
+Execution ApplyResponseCurveSettings(const cResponseCurveSettings* settings, cResponseCurveSettings* appliedSettings)
+{
+    cJoystick* joysticks[2] = {&LeftJoystick, &RightJoystick};
+    Execution execution = Execution::Passed;
+    cJoystickResponse response;
+    int radialDeadzone = 0;
+
+    *appliedSettings = *settings;
+    if(settings->joystickID >= 2)
+    {
+        Device.SetErrorMessage("1470:Gate -> No such joystick ");
+        return Execution::Failed;
+    }
+    cJoystick* joystick = joysticks[settings->joystickID];
+
+    // Points first: a custom curve is then only built once.
+    joystick->SetResponsePoints(settings->points);
+    if(joystick->SetResponseCurve(settings->curve, settings->strength) == Execution::Failed)
+    {
+        execution = Execution::Failed;
+    }
+    if(joystick->SetRadialDeadZone(settings->radialDeadzone * RESPONSECURVE_RADIAL_DEADZONE_STEP) == Execution::Failed)
+    {
+        execution = Execution::Failed;
+    }
+
+    joystick->GetResponse(&response);
+    joystick->GetRadialDeadZone(&radialDeadzone);
+    appliedSettings->curve = response.curve;
+    appliedSettings->strength = response.strength;
+    appliedSettings->radialDeadzone = (unsigned char)(radialDeadzone / RESPONSECURVE_RADIAL_DEADZONE_STEP);
+    memcpy(appliedSettings->points, response.points, RESPONSECURVE_POINT_COUNT);
+    return execution;
+}
 #pragma endregion
 
 #pragma endregion
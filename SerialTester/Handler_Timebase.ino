@@ -22,19 +22,94 @@
 #include "Handler_Timebase.h"
 /////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @brief Gives every interface and handler
+ * of the application to the Scheduler, with
+ * its period and time budget. Call it once,
+ * after InitializeProject.
+ * On the ESP32, the inputs are sampled on
+ * the other core by InputSamplingTask.
+ * @return Execution::Passed = Every task added | Execution::Failed = The scheduler refused one or the ADC scan or the sampling task could not start
+ */
+Execution ScheduleApplication()
+{
+    Execution execution;
+
+    // The axes are scanned from now on, whatever samples them.
+    execution = AdcScanner.Begin();
+    if(execution != Execution::Passed)
+    {
+        return execution;
+    }
+
+    // Added in ApplicationTask's order, which gives them their ID.
+#if defined(ARDUINO_ARCH_ESP32)
+    // A long transmit on this core no longer delays the inputs, nor the other way round.
+    if(xTaskCreatePinnedToCore(InputSamplingTask, "Inputs", INPUT_SAMPLING_STACK_SIZE, nullptr, INPUT_SAMPLING_PRIORITY, nullptr, INPUT_SAMPLING_CORE) != pdPASS)
+    {
+        Device.SetErrorMessage("43:Timebase -> Sampling task  ");
+        return Execution::Failed;
+    }
+#else
+    execution = Scheduler.AddTask(SampleInputs, INPUTS_PERIOD_US, INPUTS_BUDGET_US);
+    if(execution != Execution::Passed)
+    {
+        return execution;
+    }
+#endif
+
+    execution = Scheduler.AddTask(ProtocolBFIO, EVENT_DRIVEN_TASK, PROTOCOL_BUDGET_US);
+    if(execution != Execution::Passed)
+    {
+        return execution;
+    }
+
+    return Scheduler.AddTask(InterfaceRGB, RGB_PERIOD_US, RGB_BUDGET_US);
+}
+
 /**
  * @brief This function is the core callback
- * function of your application. It is executed
- * each X amount of clock cycles and executes all
- * the interfaces or handlers within your
- * program.
+ * function of your application. Call it from
+ * the loop. It runs the interfaces or handlers
+ * that are due, then idles until the next one is,
+ * until a gate's plane is late or until a byte
+ * arrives, whichever comes first.
  */
 void ApplicationCallback()
 {
-    InterfaceSwitch();
-    InterfaceJoysticks();
+    // Bytes the protocol left in the UART the last time it ran.
+    static int bytesSeen = 0;
+    int bytesWaiting = Serial.available();
+    unsigned long idleTime = 0;
+    unsigned long deadlineIn = 0;
+    bool canIdle = false;
+
+    // The protocol only wakes up for new bytes to read or for a gate whose plane is late.
+    if(bytesWaiting > bytesSeen || (Tower.GetTimeUntilNextDeadline(&deadlineIn) == Execution::Passed && deadlineIn == 0))
+    {
+        Scheduler.Signal(ApplicationTask::ProtocolTask);
+    }
+
+    Scheduler._Handle();
+    bytesSeen = Serial.available();
 
-    ProtocolBFIO();
+    // Idles until a task is due or a deadline expires, whichever comes first.
+    canIdle = Scheduler.GetTimeUntilNextTask(&idleTime) == Execution::Passed;
+    if(Tower.GetTimeUntilNextDeadline(&deadlineIn) == Execution::Passed)
+    {
+        deadlineIn *= 1000UL;
+        if(!canIdle || deadlineIn < idleTime)
+        {
+            idleTime = deadlineIn;
+        }
+        canIdle = true;
+    }
 
-    InterfaceRGB();
-}
\ No newline at end of file
+    // A byte can arrive at any time. The idle ends as soon as one does.
+    while(canIdle && idleTime > 0 && Serial.available() <= bytesSeen)
+    {
+        unsigned long pollTime = (idleTime < IDLE_POLL_US) ? idleTime : IDLE_POLL_US;
+        delayMicroseconds(pollTime);
+        idleTime -= pollTime;
+    }
+}
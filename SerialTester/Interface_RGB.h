@@ -23,8 +23,8 @@
     ############    ####      ##   ##########
     ############    ####      ##   ##########*/
 
-#ifndef INTERFACE_SWITCH_H
-  #define INTERFACE_SWITCH_H
+#ifndef INTERFACE_RGB_H
+  #define INTERFACE_RGB_H
 //=============================================//
 //	Include
 //=============================================//
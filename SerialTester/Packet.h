@@ -27,7 +27,87 @@
 #include "Globals.h"
 #pragma endregion
 
+#pragma region Defines
+/**
+ * @brief The maximum amount of parameters a
+ * plane can carry. Each parameter needs at
+ * least a Div chunk and a Byte chunk and the
+ * plane needs a Start and a Check chunk.
+ */
+#define MAX_PLANE_PARAMETER_COUNT ((MAX_PLANE_PASSENGER_CAPACITY - 2) / 2)
+
+/**
+ * @brief Amount of chunks a plane needs to carry
+ * that many bytes split in that many segments.
+ * One Div chunk per segment, plus the Start and
+ * Check chunks. Use it to size plane buffers at
+ * compile time.
+ */
+#define PLANE_SIZE(byteCount, segmentCount) ((byteCount) + (segmentCount) + 2)
+
+/// @brief CRC-8 polynomial used by PlaneCheck::CRC8. x^8 + x^2 + x + 1, no reflection, starts at 0.
+#define PLANE_CRC8_POLYNOMIAL 0x07
+
+/// @brief CRC-8 of a single byte. Only used to generate PLANE_CRC8_TABLE.
+constexpr unsigned char _PlaneCRC8Of(unsigned char crc, int bitsLeft)
+{
+    return (bitsLeft == 0) ? crc
+         : _PlaneCRC8Of((unsigned char)((crc & 0x80) ? ((crc << 1) ^ PLANE_CRC8_POLYNOMIAL) : (crc << 1)), bitsLeft - 1);
+}
+
+#define _PLANE_CRC8_4(byte)  _PlaneCRC8Of((byte), 8), _PlaneCRC8Of((byte) + 1, 8), _PlaneCRC8Of((byte) + 2, 8), _PlaneCRC8Of((byte) + 3, 8)
+#define _PLANE_CRC8_16(byte) _PLANE_CRC8_4(byte), _PLANE_CRC8_4((byte) + 4), _PLANE_CRC8_4((byte) + 8), _PLANE_CRC8_4((byte) + 12)
+#define _PLANE_CRC8_64(byte) _PLANE_CRC8_16(byte), _PLANE_CRC8_16((byte) + 16), _PLANE_CRC8_16((byte) + 32), _PLANE_CRC8_16((byte) + 48)
+
+/**
+ * @brief CRC-8 of every possible byte,
+ * generated at compile time. Each byte added
+ * to a CRC is then a single load.
+ */
+constexpr unsigned char PLANE_CRC8_TABLE[256] = {
+    _PLANE_CRC8_64(0), _PLANE_CRC8_64(64), _PLANE_CRC8_64(128), _PLANE_CRC8_64(192)
+};
+static_assert(PLANE_CRC8_TABLE[1] == PLANE_CRC8_POLYNOMIAL, "PLANE_CRC8_TABLE was not generated correctly");
+#pragma endregion
+
 #pragma region Class
+/**
+ * @brief Result of a single pass over a plane.
+ * Holds where each of its segments are so
+ * parameters can be located without scanning
+ * the plane again.
+ * Filled by @ref cPacket::IndexPlane.
+ */
+class cPlaneIndex
+{
+    public:
+        /// @brief The ID found in the plane's Start chunk.
+        unsigned char planeID = 0;
+        /// @brief Total amount of chunks, Start and Check chunks included.
+        int planeSize = 0;
+        /// @brief How many parameter segments were found.
+        int parameterCount = 0;
+        /// @brief Checksum calculated from the plane's chunks.
+        unsigned char calculatedCheckSum = 0;
+        /// @brief Checksum carried by the plane's Check chunk.
+        unsigned char receivedCheckSum = 0;
+        /// @brief Set to true if a Start chunk was found.
+        bool startFound = false;
+        /// @brief Set to true if a Check chunk was found.
+        bool checkFound = false;
+        /// @brief Amount of Byte chunks found before the first Div chunk.
+        int freeByteCount = 0;
+        /**
+         * @brief Index of the first Byte chunk of
+         * each segment. Segment 1 is at [0].
+         * Arrays scanned by GetBytes can be longer
+         * than a plane, hence not a byte.
+         */
+        unsigned short segmentOffsets[MAX_PLANE_PARAMETER_COUNT];
+        /// @brief Amount of Byte chunks in each segment. Segment 1 is at [0].
+        unsigned short segmentLengths[MAX_PLANE_PARAMETER_COUNT];
+};
+
 /**
  * @brief The packet class is used to
  * store methods used to decypher packets as a whole.
@@ -195,6 +275,285 @@ class cPacket
          * @return Execution::Passed = size found | Execution::Crashed = fatal analisis error | Execution::Incompatibility = Not in BFIO ids | Execution::Failed Something went wrong
          */
         Execution FullyAnalyze(unsigned short* packetToAnalyze, int* resultedPacketsize, int* amountOfParameters, unsigned char* packetID);
+
+        /**
+         * @brief Validates a plane in a single pass
+         * and records where each of its segments are.
+         * The Start chunk must be first, segments must
+         * start with a Div chunk and hold at least one
+         * Byte chunk, the Check chunk must hold the
+         * right checksum and the ID must be supported.
+         * @param plane
+         * The plane to index. Scanning stops at its Check chunk.
+         * @param planeSize
+         * How many chunks can be read from plane at most.
+         * @param resultedIndex
+         * Where the segment table and plane informations are placed.
+         * @param check
+         * What the Check chunk carries.
+         * @return Execution::Passed = Valid plane | Execution::Failed = Invalid structure or checksum | Execution::Incompatibility = Not in BFIO ids | Execution::Crashed = Corrupted chunks
+         */
+        Execution IndexPlane(unsigned short* plane, int planeSize, cPlaneIndex* resultedIndex, PlaneCheck check = PlaneCheck::AdditiveSum);
+
+        /**
+         * @brief Adds one chunk to a running CRC-8.
+         * The chunk counts as the 2 bytes ToUART
+         * sends, type first. This is what lets a
+         * terminal check a plane while it lands.
+         * @param crc
+         * CRC so far. 0 before the Start chunk.
+         * @param chunk
+         * Chunk to add.
+         * @return The new CRC.
+         */
+        static constexpr unsigned char UpdateCRC8(unsigned char crc, unsigned short chunk)
+        {
+            return PLANE_CRC8_TABLE[PLANE_CRC8_TABLE[(crc ^ (chunk >> 8)) & 0xFF] ^ (chunk & 0xFF)];
+        }
+
+        /**
+         * @brief CRC-8 carried by the Check chunk of
+         * a plane in PlaneCheck::CRC8 mode. Covers
+         * the Start chunk and every chunk up to the
+         * Check chunk. Unlike the sum, swapped bytes
+         * and moved Div chunks change it.
+         * @param chunks
+         * The plane, from its Start chunk.
+         * @param count
+         * Amount of chunks before the Check chunk.
+         * @param resultedCRC
+         * Where the CRC is placed.
+         * @return Execution::Passed
+         */
+        Execution GetCRC8(unsigned short* chunks, int count, unsigned char* resultedCRC);
+
+        /**
+         * @brief Gets a specific segment's bytes using
+         * an index made by @ref IndexPlane. The segment
+         * is located without scanning the plane.
+         * @param planeIndex
+         * The index made from that plane.
+         * @param plane
+         * The plane that was indexed.
+         * @param segmentNumber
+         * Which segment to extract bytes from. STARTS AT 1.
+         * @param resultParameter
+         * Array of bytes where the parameter will be stored.
+         * @param sizeOfResultParameter
+         * How much space is available to store that array.
+         * @return Execution::Passed = Worked | Execution::Failed = No such segment | Execution::Crashed = Array too small
+         */
+        Execution GetBytes(cPlaneIndex* planeIndex, unsigned short* plane, int segmentNumber, unsigned char* resultParameter, int sizeOfResultParameter);
+
+    private:
+        /**
+         * @brief The single pass used by IndexPlane and
+         * GetBytes. Only the chunks themselves are
+         * validated here, plane rules are left to the
+         * caller so segments without Start or Check
+         * chunks can still be indexed.
+         */
+        Execution _IndexSegments(unsigned short* chunks, int chunkCount, cPlaneIndex* resultedIndex);
+};
+
+/**
+ * @brief Read only view over one parameter
+ * segment of a plane. Bytes are decoded straight
+ * from the plane's chunks. Nothing is copied, so
+ * the plane must outlive the view.
+ * Decoding follows the same byte order and sizes
+ * as the cData class.
+ */
+class cSegmentView
+{
+    private:
+        /// @brief First Byte chunk of the segment, right after its Div chunk.
+        unsigned short* _chunks = nullptr;
+        /// @brief Amount of Byte chunks in the segment.
+        int _size = 0;
+
+        /// @brief Assembles byteCount bytes, little endian, into one value.
+        unsigned long long _ReadLittleEndian(int byteCount);
+    public:
+        /// @brief Construct an empty view. Size() is 0.
+        cSegmentView();
+        /**
+         * @brief Construct a view over Byte chunks
+         * that were already validated.
+         * @param chunks
+         * First Byte chunk of the segment.
+         * @param size
+         * How many Byte chunks the segment holds.
+         */
+        cSegmentView(unsigned short* chunks, int size);
+
+        /// @brief How many bytes the segment holds.
+        int Size();
+
+        /**
+         * @brief Get a single byte of the segment.
+         * @param index
+         * Which byte. STARTS AT 0.
+         * @param resultedByte
+         * Where the byte will be placed.
+         * @return Execution::Passed = Worked | Execution::Failed = Index outside of the segment
+         */
+        Execution GetByte(int index, unsigned char* resultedByte);
+
+        /**
+         * @brief Decode the segment into a variable.
+         * The segment must hold at least as many bytes
+         * as cData::ToBytes produces for that type.
+         * @return Execution::Passed = Worked | Execution::Failed = Segment too small
+         */
+        Execution ToData(bool* value);
+        Execution ToData(unsigned char* value);
+        Execution ToData(char* value);
+        Execution ToData(unsigned short* value);
+        Execution ToData(short* value);
+        Execution ToData(unsigned int* value);
+        Execution ToData(int* value);
+        Execution ToData(unsigned long* value);
+        Execution ToData(long* value);
+        Execution ToData(unsigned long long* value);
+        Execution ToData(long long* value);
+        Execution ToData(float* value);
+        Execution ToData(double* value);
+        Execution ToData(std::string& value);
+};
+
+/**
+ * @brief Read only view over a received plane.
+ * The plane is indexed once when the view is
+ * opened, after which any of its segments can
+ * be looked at without copying its chunks.
+ * The plane must outlive the view.
+ */
+class cPacketView
+{
+    private:
+        unsigned short* _plane = nullptr;
+        cPlaneIndex _index;
+    public:
+        /// @brief Set to true once Open succeeded.
+        bool built = false;
+
+        /// @brief Construct a closed view.
+        cPacketView();
+
+        /**
+         * @brief Validates and indexes a plane.
+         * See @ref cPacket::IndexPlane.
+         * @param plane
+         * The plane to look at. It is not copied.
+         * @param planeSize
+         * How many chunks can be read from plane at most.
+         * @param check
+         * What the Check chunk carries.
+         * @return Execution Same values as cPacket::IndexPlane.
+         */
+        Execution Open(unsigned short* plane, int planeSize, PlaneCheck check = PlaneCheck::AdditiveSum);
+
+        /**
+         * @brief Opens a plane that was already
+         * validated and indexed, like the planes
+         * a cTerminal hands out. Nothing is scanned.
+         * @param plane
+         * The plane to look at. It is not copied.
+         * @param planeIndex
+         * Its index. It is copied.
+         * @return Execution::Passed = Opened | Execution::Failed = Index is not of a whole plane
+         */
+        Execution Open(unsigned short* plane, cPlaneIndex* planeIndex);
+
+        /// @brief The ID of the opened plane.
+        unsigned char GetID();
+
+        /// @brief Total amount of chunks of the opened plane.
+        int GetSize();
+
+        /// @brief How many parameter segments the opened plane has.
+        int GetParameterCount();
+
+        /**
+         * @brief Get a view over one of the plane's segments.
+         * @param segmentNumber
+         * Which segment. STARTS AT 1.
+         * @param resultedSegment
+         * Where the segment's view will be placed.
+         * @return Execution::Passed = Worked | Execution::Failed = No such segment | Execution::Crashed = View is not opened
+         */
+        Execution GetSegment(int segmentNumber, cSegmentView* resultedSegment);
+};
+
+/**
+ * @brief Builds a plane straight into the
+ * buffer it will take off from. The Start chunk,
+ * each Div + Byte segment and the Check chunk are
+ * written once, in order, and the checksum is
+ * kept up to date while segments are added.
+ * 
+ * Usage: Begin -> AddSegment (as many as needed) -> Finish
+ */
+class cPacketBuilder
+{
+    private:
+        unsigned short* _plane = nullptr;
+        int _capacity = 0;
+        int _size = 0;
+        unsigned char _checkSum = 0;
+    public:
+        /// @brief True between a successful Begin and Finish.
+        bool built = false;
+
+        /// @brief Construct an idle builder.
+        cPacketBuilder();
+
+        /**
+         * @brief Starts a new plane in the given buffer.
+         * Writes its Start chunk.
+         * @param functionID
+         * ID given to the plane's Start chunk.
+         * @param resultedPlane
+         * Buffer the plane is built into.
+         * @param sizeOfResultedPlane
+         * How many chunks that buffer can hold. See PLANE_SIZE.
+         * @return Execution::Passed = Started | Execution::Failed = Buffer cannot even hold Start and Check
+         */
+        Execution Begin(unsigned char functionID, unsigned short* resultedPlane, int sizeOfResultedPlane);
+
+        /**
+         * @brief Adds a Div chunk followed by one
+         * Byte chunk per given byte.
+         * @param bytes
+         * Bytes of the parameter, usually from cData::ToBytes.
+         * @param byteCount
+         * How many bytes the parameter has. Must be at least 1.
+         * @return Execution::Passed = Added | Execution::Failed = Would not leave room for the Check chunk | Execution::Crashed = Begin was not called
+         */
+        Execution AddSegment(unsigned char* bytes, int byteCount);
+
+        /**
+         * @brief Writes the Check chunk. The plane is
+         * then ready for take off.
+         * @param resultedPlaneSize
+         * Where the final amount of chunks will be placed.
+         * @param check
+         * What the Check chunk carries.
+         * @return Execution::Passed = Finished | Execution::Crashed = Begin was not called
+         */
+        Execution Finish(int* resultedPlaneSize, PlaneCheck check = PlaneCheck::AdditiveSum);
+
+        /**
+         * @brief Drops the plane being built, so a
+         * plane missing segments is never finished.
+         * Finish fails until the next Begin.
+         * @return Execution::Passed = Dropped | Execution::Unecessary = Nothing was being built
+         */
+        Execution Abort();
+
+        /// @brief Amount of chunks written so far.
+        int GetSize();
 };
 #pragma endregion
 
@@ -0,0 +1,261 @@
+/**
+ * @file PlaneSchema.h
+ * @author Lyam (Lyam.BRS@gmail.com)
+ * @brief This file contains the cPlaneSchema
+ * template. A schema describes a BFIO plane by
+ * its ID and the types of its parameters, so its
+ * exact size is known at compile time and its
+ * encoder and decoder are generated inline.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef PLANESCHEMA_H
+  #define PLANESCHEMA_H
+
+#pragma region  Include
+#include "Globals.h"
+#pragma endregion
+
+#pragma region Fields
+/**
+ * @brief Amount of bytes a type takes in a
+ * plane segment. Same sizes as cData::ToBytes.
+ * Types without a specialisation cannot be
+ * used in a schema. Strings have no fixed size
+ * and must go through cPacketBuilder instead.
+ */
+template<typename T> struct cPlaneField;
+
+template<> struct cPlaneField<bool>                 { static constexpr int size = 1; };
+template<> struct cPlaneField<unsigned char>        { static constexpr int size = 1; };
+template<> struct cPlaneField<char>                 { static constexpr int size = 1; };
+template<> struct cPlaneField<unsigned short>       { static constexpr int size = 2; };
+template<> struct cPlaneField<short>                { static constexpr int size = 2; };
+template<> struct cPlaneField<unsigned int>         { static constexpr int size = 4; };
+template<> struct cPlaneField<int>                  { static constexpr int size = 4; };
+/// @attention Like cData, (unsigned) longs always travel as 8 bytes.
+template<> struct cPlaneField<unsigned long>        { static constexpr int size = 8; };
+template<> struct cPlaneField<long>                 { static constexpr int size = 8; };
+template<> struct cPlaneField<unsigned long long>   { static constexpr int size = 8; };
+template<> struct cPlaneField<long long>            { static constexpr int size = 8; };
+template<> struct cPlaneField<float>                { static constexpr int size = 4; };
+template<> struct cPlaneField<double>               { static constexpr int size = 8; };
+
+/// @brief Memory image of an integer. Signed values are sign extended like cData does.
+template<typename T>
+inline unsigned long long _PlaneFieldToBits(T value)
+{
+    return (unsigned long long)value;
+}
+
+inline unsigned long long _PlaneFieldToBits(float value)
+{
+    unsigned int bits;
+    memcpy(&bits, &value, sizeof(float));
+    return bits;
+}
+
+inline unsigned long long _PlaneFieldToBits(double value)
+{
+    unsigned long long bits;
+    memcpy(&bits, &value, sizeof(double));
+    return bits;
+}
+
+/// @brief Value back from its memory image.
+template<typename T>
+inline void _PlaneFieldFromBits(unsigned long long bits, T* value)
+{
+    *value = (T)bits;
+}
+
+inline void _PlaneFieldFromBits(unsigned long long bits, bool* value)
+{
+    *value = (bits & 0xFF) != 0;
+}
+
+inline void _PlaneFieldFromBits(unsigned long long bits, float* value)
+{
+    unsigned int floatBits = (unsigned int)bits;
+    memcpy(value, &floatBits, sizeof(float));
+}
+
+inline void _PlaneFieldFromBits(unsigned long long bits, double* value)
+{
+    memcpy(value, &bits, sizeof(double));
+}
+#pragma endregion
+
+#pragma region Segments
+/**
+ * @brief Walks the parameter segments of a
+ * schema. Each step handles one field, then
+ * hands the rest of the plane to the next one.
+ * Everything is resolved at compile time.
+ */
+template<typename... Fields> struct _cPlaneSegments
+{
+    static constexpr int byteCount = 0;
+
+    static inline void Write(unsigned short*, unsigned char*) {}
+    static inline bool Verify(unsigned short*, unsigned char*) { return true; }
+    static inline void Read(unsigned short*) {}
+};
+
+template<typename First, typename... Rest> struct _cPlaneSegments<First, Rest...>
+{
+    static constexpr int byteCount = cPlaneField<First>::size + _cPlaneSegments<Rest...>::byteCount;
+
+    /// @brief Writes Div + the field's bytes, then the remaining fields.
+    static inline void Write(unsigned short* cursor, unsigned char* checkSum, First value, Rest... rest)
+    {
+        unsigned long long bits = _PlaneFieldToBits(value);
+
+        cursor[0] = ChunkType::Div;
+        for(int index = 0; index < cPlaneField<First>::size; index++)
+        {
+            unsigned char byte = (unsigned char)(bits >> (8*index));
+            cursor[index + 1] = byte;
+            *checkSum += byte;
+        }
+        _cPlaneSegments<Rest...>::Write(&cursor[cPlaneField<First>::size + 1], checkSum, rest...);
+    }
+
+    /// @brief Makes sure a Div chunk starts the segment and that only Byte chunks follow.
+    static inline bool Verify(unsigned short* cursor, unsigned char* checkSum)
+    {
+        if(cursor[0] != ChunkType::Div)
+        {
+            return false;
+        }
+
+        for(int index = 1; index <= cPlaneField<First>::size; index++)
+        {
+            if(cursor[index] > 0xFF)
+            {
+                return false;
+            }
+            *checkSum += (unsigned char)cursor[index];
+        }
+        return _cPlaneSegments<Rest...>::Verify(&cursor[cPlaneField<First>::size + 1], checkSum);
+    }
+
+    /// @brief Reads the field from a segment that was already verified.
+    static inline void Read(unsigned short* cursor, First* value, Rest*... rest)
+    {
+        unsigned long long bits = 0;
+        for(int index = 0; index < cPlaneField<First>::size; index++)
+        {
+            bits = bits | ((unsigned long long)(cursor[index + 1] & 0xFF) << (8*index));
+        }
+        _PlaneFieldFromBits(bits, value);
+        _cPlaneSegments<Rest...>::Read(&cursor[cPlaneField<First>::size + 1], rest...);
+    }
+};
+#pragma endregion
+
+#pragma region Class
+/**
+ * @brief Describes one BFIO plane at compile time.
+ * Each type given after the ID is one parameter
+ * segment, in order.
+ *
+ * Example: cPlaneSchema<PING_PLANE_ID, bool>
+ *
+ * size and parameterCount are constants, so plane
+ * buffers can be sized exactly and Encode needs
+ * no size checks or error branches.
+ *
+ * @tparam ID
+ * Function ID found in the plane's Start chunk.
+ * @tparam Fields
+ * Type of each parameter. See cPlaneField.
+ */
+template<unsigned char ID, typename... Fields>
+class cPlaneSchema
+{
+    public:
+        /// @brief Function ID of the plane.
+        static constexpr unsigned char id = ID;
+        /// @brief Amount of parameter segments.
+        static constexpr int parameterCount = sizeof...(Fields);
+        /// @brief Amount of Byte chunks in the whole plane.
+        static constexpr int byteCount = _cPlaneSegments<Fields...>::byteCount;
+        /// @brief Exact amount of chunks of the plane. See PLANE_SIZE.
+        static constexpr int size = PLANE_SIZE(byteCount, parameterCount);
+
+        static_assert(size <= MAX_PLANE_PASSENGER_CAPACITY, "Plane schema exceeds MAX_PLANE_PASSENGER_CAPACITY");
+
+        /**
+         * @brief Builds the plane in a single pass.
+         * @param resultedPlane
+         * Buffer of at least size chunks.
+         * @param values
+         * One value per parameter, in order.
+         */
+        static inline void Encode(unsigned short* resultedPlane, Fields... values)
+        {
+            unsigned char checkSum = ID;
+
+            resultedPlane[0] = ChunkType::Start + ID;
+            _cPlaneSegments<Fields...>::Write(&resultedPlane[1], &checkSum, values...);
+            resultedPlane[size - 1] = ChunkType::Check + checkSum;
+        }
+
+        /**
+         * @brief Checks that a received plane follows
+         * the schema, then reads its parameters.
+         * Nothing is written to values unless the
+         * whole plane is valid.
+         * @param plane
+         * The received plane.
+         * @param planeSize
+         * Amount of chunks received.
+         * @param values
+         * Where each parameter will be placed, in order.
+         * @return Execution::Passed = Decoded | Execution::Failed = Other ID or wrong checksum | Execution::Incompatibility = Plane does not follow the schema
+         */
+        static inline Execution Decode(unsigned short* plane, int planeSize, Fields*... values)
+        {
+            unsigned char checkSum = ID;
+
+            if(planeSize != size)
+            {
+                return Execution::Incompatibility;
+            }
+
+            if(plane[0] != ChunkType::Start + ID)
+            {
+                return Execution::Failed;
+            }
+
+            if(!_cPlaneSegments<Fields...>::Verify(&plane[1], &checkSum))
+            {
+                return Execution::Incompatibility;
+            }
+
+            if(plane[size - 1] != ChunkType::Check + checkSum)
+            {
+                return Execution::Failed;
+            }
+
+            _cPlaneSegments<Fields...>::Read(&plane[1], values...);
+            return Execution::Passed;
+        }
+};
+#pragma endregion
+
+#endif
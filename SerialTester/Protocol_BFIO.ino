@@ -32,5 +32,8 @@
  */
 void ProtocolBFIO()
 {
+    // Only gates whose planes are late are woken.
+    Tower._Handle();
+
     // TO DO
 }
\ No newline at end of file
@@ -27,79 +27,227 @@
 //=============================================//
 #include "Globals.h"
 
+/// @brief Most UART bytes a plane can take, in any WireMode.
+#define SIZE_OF_DEPARTURE_RUNWAY (2 * MAX_PLANE_PASSENGER_CAPACITY)
+
+/// @brief UART bytes the arrival runway can hold before the terminal drains them. Must be a power of 2.
+#define SIZE_OF_ARRIVAL_RUNWAY 256
+static_assert((SIZE_OF_ARRIVAL_RUNWAY & (SIZE_OF_ARRIVAL_RUNWAY - 1)) == 0, "SIZE_OF_ARRIVAL_RUNWAY must be a power of 2");
+
 /**
  * @brief Class that builds a runway
  * that handles plane departures.
+ * The whole plane is encoded into UART bytes
+ * when it is set for takeoff. Each _Handle
+ * then writes as many of them as the stream's
+ * TX FIFO accepts, so the loop never waits on
+ * the UART.
  */
 class cDepartureRunway
  {       
     private:
 
-        Stream *_streamRef;
-        /**
-         * @brief The runway space available for a plane
-         * to take off.
-         */
-        unsigned short _runway[SIZE_OF_ARRIVAL_PLANE];
+        Stream *_streamRef = nullptr;
 
+        /// @brief Terminal whose gates build the planes set for takeoff by ID.
+        cTerminal *_terminalRef = nullptr;
         /**
-         * @brief The current mode.
-         * 0: regular (default)
-         * 1: Rejecting incoming packets (Will not save the chunks other than start and check chunk.)
+         * @brief The runway space available for a plane
+         * to take off, already encoded in UART bytes.
          */
-        unsigned char _currentMode = 0;
+        unsigned char _runway[SIZE_OF_DEPARTURE_RUNWAY];
 
-        /**
-         * @brief 
-         * Checksum currently being calculated
-         * as the plane is landing on the arrival
-         * runway.
-         */
-        unsigned char _calculatedChecksum = 0;
+        /// @brief Amount of UART bytes the plane on the runway takes.
+        int _bytesToSend = 0;
 
         /**
-         * @brief Indicates where we are in the sending of the plane's chunks.
+         * @brief Indicates where we are in the sending of the plane's bytes.
          * Defaults to 0.
          */
-        unsigned char currentPlaneChunk = 0;
+        int _bytesSent = 0;
+
+        /// @brief micros() at which the plane on the runway was set for takeoff.
+        unsigned long _takeOffTime = 0;
+
+        /// @brief Time, in microseconds, planes that took off spent on the runway. See GetBytesPerSecond.
+        unsigned long long _timeOnRunway = 0;
+
+        /// @brief UART bytes of the planes that took off.
+        unsigned long long _bytesInTheAir = 0;
 
     public:
         /// @brief set to true if the class is constructed.
         bool built = false;
 
-        /// @brief Is set to true if a packet is ready to transfer
-        bool planeAvailable = false;
-
-        /// @brief Is set to true if the function is currently receiving a packet
+        /// @brief Is set to true if the function is currently sending a plane
         bool sendingPlane = false;
 
         /// @brief The status of the terminals departure. defaults to closed.
         HighwayStatus status = HighwayStatus::Closed;
 
+        /// @brief How planes are laid on the UART. Set it to what was agreed on during the handshake.
+        WireMode wireMode = WireMode::Unpacked;
+
+        /// @brief Amount of planes that fully took off.
+        unsigned long planesSent = 0;
+
+        /// @brief Amount of UART bytes written to the stream.
+        unsigned long bytesSent = 0;
+
+        /// @brief Amount of _Handle calls that could not write anything because the TX FIFO was full.
+        unsigned long stalls = 0;
+
         //////////////////////////////////////////////
         cDepartureRunway();
 
         cDepartureRunway(Stream *streamObject);
+
+        cDepartureRunway(Stream *streamObject, cTerminal *terminal);
         //////////////////////////////////////////////
 
         /**
          * @brief Time base function executed
-         * periodically. This handles chunks departure.
-         * 
-         * @return Execution 
+         * periodically. This handles plane departure.
+         * Writes as many bytes as availableForWrite
+         * allows, in one write call.
+         * @attention
+         * The stream must report its TX FIFO space
+         * through availableForWrite. A stream that
+         * always reports 0 only stalls.
+         * @return Execution::Passed = Plane fully sent | Execution::Bypassed = Plane still taking off | Execution::Unecessary = No plane on the runway | Execution::Failed = Runway not built
          */
         Execution _Handle();
 
+        /**
+         * @brief Sets a plane for takeoff on this runway.
+         * The plane is encoded according to wireMode
+         * right away, nothing is sent until _Handle.
+         * @attention this function will not verify your plane.
+         * @param plane
+         * The plane's chunks. They are not needed anymore once this returns.
+         * @param planeSize
+         * Amount of chunks.
+         * @return Execution::Passed = Plane is on the runway | Execution::Bypassed = Another plane is taking off | Execution::Failed = Plane could not be encoded
+         */
+        Execution SetPlaneForTakeOff(unsigned short* plane, int planeSize);
+
         /**
          * @brief Sets a plane for takeoff on this runway.
          * This function will get the plane from the gate,
          * build it, verify it, and queue it on the runway
-         * if everything goes well.
+         * if everything goes well. The gate is found
+         * through the terminal's docking gates.
          * @param planeID 
          * The plane's function ID.
-         * @return Execution 
+         * @return Execution::Passed = Plane is on the runway | Execution::Bypassed = Another plane is taking off | Execution::Incompatibility = No terminal or no gate for that ID | Otherwise what the gate returned
          */
         Execution SetPlaneForTakeOff(unsigned char planeID);
+
+        /**
+         * @brief Average speed at which planes left
+         * this runway, from the moment they were set
+         * for takeoff to their last byte.
+         * @param bytesPerSecond
+         * Where the speed is placed.
+         * @return Execution::Passed = Speed placed | Execution::Unecessary = No plane took off in a measurable time yet
+         */
+        Execution GetBytesPerSecond(unsigned long* bytesPerSecond);
+ };
+
+/**
+ * @brief Class that builds a runway
+ * that handles UART bytes arriving from
+ * the other side. It is a lock free ring
+ * with a single producer and a single
+ * consumer:
+ * - The producer is the UART ISR or event
+ *   task. It only calls Land or
+ *   _HandleReception.
+ * - The consumer is the loop. It only calls
+ *   DrainInto and GetWaitingBytes.
+ * Each side only ever writes its own index,
+ * so no lock is needed between the two.
+ */
+class cArrivalRunway
+ {
+    private:
+
+        Stream *_streamRef = nullptr;
+
+        /// @brief The UART bytes waiting for the terminal.
+        unsigned char _runway[SIZE_OF_ARRIVAL_RUNWAY];
+
+        /// @brief Total bytes landed. Only written by the producer.
+        std::atomic<unsigned int> _head;
+
+        /// @brief Total bytes drained. Only written by the consumer.
+        std::atomic<unsigned int> _tail;
+
+    public:
+        /// @brief set to true if the class is constructed.
+        bool built = false;
+
+        /// @brief Bytes Land could not fit and had to drop. Written by the producer.
+        std::atomic<unsigned long> droppedBytes;
+
+        /// @brief Amount of _HandleReception calls that left bytes in the stream because the runway was full.
+        std::atomic<unsigned long> stalls;
+
+        /// @brief Bytes given to the terminal. Written by the consumer.
+        unsigned long drainedBytes = 0;
+
+        /// @brief Most bytes that were waiting on the runway when DrainInto was called.
+        unsigned int mostBytesWaiting = 0;
+
+        //////////////////////////////////////////////
+        cArrivalRunway();
+
+        cArrivalRunway(Stream *streamObject);
+        //////////////////////////////////////////////
+
+        /**
+         * @brief Producer side. Puts received
+         * bytes on the runway. Safe to call from
+         * an ISR, it never blocks and never
+         * touches Device.
+         * @param bytes
+         * The received bytes.
+         * @param count
+         * Amount of bytes.
+         * @return Amount of bytes that fit. The others are counted in droppedBytes.
+         */
+        int Land(const unsigned char* bytes, int count);
+
+        /**
+         * @brief Producer side. Moves everything
+         * the stream received onto the runway in
+         * at most two readBytes calls. Bytes that
+         * do not fit stay in the stream for the
+         * next call.
+         * @return Execution::Passed = Bytes landed | Execution::Unecessary = Nothing received | Execution::Bypassed = Runway full | Execution::Failed = Runway not built
+         */
+        Execution _HandleReception();
+
+        /**
+         * @brief Consumer side. Amount of bytes
+         * waiting for the terminal.
+         */
+        int GetWaitingBytes();
+
+        /**
+         * @brief Consumer side. Gives every
+         * waiting byte to the terminal's
+         * _HandleUARTArrival, then frees them
+         * all at once for the producer.
+         * Stops right after a plane lands so it
+         * can be handled before the next one
+         * lands over it. The rest waits for the
+         * next call.
+         * @param terminal
+         * The terminal the bytes arrive at.
+         * @return Execution::Passed = A plane landed | Execution::Bypassed = Bytes given, no plane landed yet | Execution::Unecessary = Nothing to drain
+         */
+        Execution DrainInto(cTerminal* terminal);
  };
 
-#endif
\ No newline at end of file
+#endif
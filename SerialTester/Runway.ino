@@ -34,46 +34,133 @@ cDepartureRunway::cDepartureRunway(Stream *streamObject)
       status = HighwayStatus::Empty;
 }
 
+cDepartureRunway::cDepartureRunway(Stream *streamObject, cTerminal *terminal)
+{
+      _streamRef = streamObject;
+      _terminalRef = terminal;
+      built = true;
+      status = HighwayStatus::Empty;
+}
+
 /**
  * @brief Time base function executed
- * periodically. This handles chunks departure.
- * 
- * @return Execution 
+ * periodically. This handles plane departure.
+ * Writes as many bytes as availableForWrite
+ * allows, in one write call.
+ * @attention
+ * The stream must report its TX FIFO space
+ * through availableForWrite. A stream that
+ * always reports 0 only stalls.
+ * @return Execution::Passed = Plane fully sent | Execution::Bypassed = Plane still taking off | Execution::Unecessary = No plane on the runway | Execution::Failed = Runway not built
  */
 Execution cDepartureRunway::_Handle()
 {
-    Execution execution;
+    if(!built)
+    {
+        return Execution::Failed;
+    }
+
+    if(!sendingPlane)
+    {
+        return Execution::Unecessary;
+    }
+
+    // - Only what the TX FIFO can take right now - //
+    int bytesLeft = _bytesToSend - _bytesSent;
+    int room = _streamRef->availableForWrite();
+    if(room <= 0)
+    {
+        stalls++;
+        status = HighwayStatus::Jammed;
+        return Execution::Bypassed;
+    }
 
-    if(planeAvailable)
+    if(room > bytesLeft)
     {
-        // A new plane is ready for takeoff!
-        currentPlaneChunk = 0;
-        planeAvailable = false;             // No planes are available for takeoff anymore
-        sendingPlane = true;                // There is currently a plane on the runway.
-        status = HighwayStatus::Traffic;    // There is traffic on the runway.
+        room = bytesLeft;
     }
 
-    // - Plane is taking off on this runway - //
+    int written = (int)_streamRef->write(&_runway[_bytesSent], (size_t)room);
+    _bytesSent += written;
+    bytesSent += written;
+    status = HighwayStatus::Traffic;
+
+    if(_bytesSent < _bytesToSend)
+    {
+        return Execution::Bypassed;
+    }
+
+    // - Plane is in the air - //
+    _timeOnRunway += micros() - _takeOffTime;
+    _bytesInTheAir += _bytesToSend;
+    planesSent++;
+    sendingPlane = false;
+    status = HighwayStatus::Empty;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Sets a plane for takeoff on this runway.
+ * The plane is encoded according to wireMode
+ * right away, nothing is sent until _Handle.
+ * @attention this function will not verify your plane.
+ * @param plane
+ * The plane's chunks. They are not needed anymore once this returns.
+ * @param planeSize
+ * Amount of chunks.
+ * @return Execution::Passed = Plane is on the runway | Execution::Bypassed = Another plane is taking off | Execution::Failed = Plane could not be encoded
+ */
+Execution cDepartureRunway::SetPlaneForTakeOff(unsigned short* plane, int planeSize)
+{
+    Execution execution = Execution::Passed;
+    int encodedSize = 0;
+
     if(sendingPlane)
     {
-        // Step 1 is to convert the BFIO chunk into an UART 2 bytes chunk.
-        unsigned char UART_ChunksToSend[2];
-        unsigned short chunkToSend = _runway[currentPlaneChunk];
+        return Execution::Bypassed;
+    }
+
+    if(planeSize > MAX_PLANE_PASSENGER_CAPACITY)
+    {
+        Device.SetErrorMessage("116:Runway -> Plane too large ");
+        return Execution::Failed;
+    }
 
-        execution = Chunk.ToUART(chunkToSend, UART_ChunksToSend);
-        if(execution != Execution::Passed)
+    if(wireMode == WireMode::Packed)
+    {
+        execution = Chunk.ToPackedUART(plane, planeSize, _runway, &encodedSize);
+    }
+    else
+    {
+        // Same byte order as Chunk.ToUART gives them, high byte first on the line.
+        unsigned char uartChunk[2];
+        for(int index = 0; index < planeSize && execution == Execution::Passed; index++)
         {
-            Device.SetErrorMessage("65:Runway -> Chunk.ToUART     ");
-            Device.SetStatus(Status::CommunicationError);
-            return Execution::Crashed;
+            if(wireMode == WireMode::Protected)
+            {
+                execution = Chunk.ToProtectedUART(plane[index], uartChunk);
+            }
+            else
+            {
+                execution = Chunk.ToUART(plane[index], uartChunk);
+            }
+            _runway[encodedSize++] = uartChunk[1];
+            _runway[encodedSize++] = uartChunk[0];
         }
+    }
 
-        // - Sending the UART Chunks - //
-        _streamRef->print(UART_ChunksToSend[0]);
-        _streamRef->print(UART_ChunksToSend[1]);
-        currentPlaneChunk++;
+    if(execution != Execution::Passed)
+    {
+        Device.SetErrorMessage("145:Runway -> Chunk encoding  ");
+        Device.SetStatus(Status::CommunicationError);
+        return Execution::Failed;
     }
 
+    _bytesToSend = encodedSize;
+    _bytesSent = 0;
+    _takeOffTime = micros();
+    sendingPlane = true;
+    status = HighwayStatus::Traffic;
     return Execution::Passed;
 }
 
@@ -81,12 +168,214 @@ Execution cDepartureRunway::_Handle()
  * @brief Sets a plane for takeoff on this runway.
  * This function will get the plane from the gate,
  * build it, verify it, and queue it on the runway
- * if everything goes well.
+ * if everything goes well. The gate is found
+ * through the terminal's docking gates.
  * @param planeID 
  * The plane's function ID.
- * @return Execution 
+ * @return Execution::Passed = Plane is on the runway | Execution::Bypassed = Another plane is taking off | Execution::Incompatibility = No terminal or no gate for that ID | Otherwise what the gate returned
  */
 Execution cDepartureRunway::SetPlaneForTakeOff(unsigned char planeID)
 {
-    return Execution::Bypassed;
-}
\ No newline at end of file
+    Execution execution;
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    int planeSize = 0;
+
+    if(_terminalRef == nullptr)
+    {
+        return Execution::Incompatibility;
+    }
+
+    // Checked first, the gate considers its plane gone once it built it.
+    if(sendingPlane)
+    {
+        return Execution::Bypassed;
+    }
+
+    execution = _terminalRef->BoardPlane(planeID, plane, &planeSize);
+    if(execution != Execution::Passed)
+    {
+        return execution;
+    }
+    return SetPlaneForTakeOff(plane, planeSize);
+}
+
+/**
+ * @brief Average speed at which planes left
+ * this runway, from the moment they were set
+ * for takeoff to their last byte.
+ * @param bytesPerSecond
+ * Where the speed is placed.
+ * @return Execution::Passed = Speed placed | Execution::Unecessary = No plane took off in a measurable time yet
+ */
+Execution cDepartureRunway::GetBytesPerSecond(unsigned long* bytesPerSecond)
+{
+    if(_timeOnRunway == 0)
+    {
+        return Execution::Unecessary;
+    }
+
+    *bytesPerSecond = (unsigned long)(_bytesInTheAir * 1000000ULL / _timeOnRunway);
+    return Execution::Passed;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+cArrivalRunway::cArrivalRunway()
+{
+    _head.store(0);
+    _tail.store(0);
+    droppedBytes.store(0);
+    stalls.store(0);
+    built = false;
+}
+
+cArrivalRunway::cArrivalRunway(Stream *streamObject)
+{
+    _streamRef = streamObject;
+    _head.store(0);
+    _tail.store(0);
+    droppedBytes.store(0);
+    stalls.store(0);
+    built = true;
+}
+
+/**
+ * @brief Producer side. Puts received
+ * bytes on the runway. Safe to call from
+ * an ISR, it never blocks and never
+ * touches Device.
+ * @param bytes
+ * The received bytes.
+ * @param count
+ * Amount of bytes.
+ * @return Amount of bytes that fit. The others are counted in droppedBytes.
+ */
+int cArrivalRunway::Land(const unsigned char* bytes, int count)
+{
+    unsigned int head = _head.load(std::memory_order_relaxed);
+    unsigned int tail = _tail.load(std::memory_order_acquire);
+    int room = SIZE_OF_ARRIVAL_RUNWAY - (int)(head - tail);
+
+    if(count > room)
+    {
+        droppedBytes.fetch_add(count - room, std::memory_order_relaxed);
+        count = room;
+    }
+
+    for(int index = 0; index < count; index++)
+    {
+        _runway[(head + index) & (SIZE_OF_ARRIVAL_RUNWAY - 1)] = bytes[index];
+    }
+
+    // - Bytes are only visible to the consumer once they are all written - //
+    _head.store(head + count, std::memory_order_release);
+    return count;
+}
+
+/**
+ * @brief Producer side. Moves everything
+ * the stream received onto the runway in
+ * at most two readBytes calls. Bytes that
+ * do not fit stay in the stream for the
+ * next call.
+ * @return Execution::Passed = Bytes landed | Execution::Unecessary = Nothing received | Execution::Bypassed = Runway full | Execution::Failed = Runway not built
+ */
+Execution cArrivalRunway::_HandleReception()
+{
+    if(!built)
+    {
+        return Execution::Failed;
+    }
+
+    int received = _streamRef->available();
+    if(received <= 0)
+    {
+        return Execution::Unecessary;
+    }
+
+    unsigned int head = _head.load(std::memory_order_relaxed);
+    unsigned int tail = _tail.load(std::memory_order_acquire);
+    int room = SIZE_OF_ARRIVAL_RUNWAY - (int)(head - tail);
+
+    if(received > room)
+    {
+        stalls.fetch_add(1, std::memory_order_relaxed);
+        received = room;
+    }
+
+    if(received == 0)
+    {
+        return Execution::Bypassed;
+    }
+
+    // - The ring may wrap, in which case it takes 2 reads - //
+    int index = (int)(head & (SIZE_OF_ARRIVAL_RUNWAY - 1));
+    int firstPart = SIZE_OF_ARRIVAL_RUNWAY - index;
+    if(firstPart > received)
+    {
+        firstPart = received;
+    }
+
+    int landed = (int)_streamRef->readBytes(&_runway[index], (size_t)firstPart);
+    if(landed == firstPart && received > firstPart)
+    {
+        landed += (int)_streamRef->readBytes(&_runway[0], (size_t)(received - firstPart));
+    }
+
+    _head.store(head + landed, std::memory_order_release);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Consumer side. Amount of bytes
+ * waiting for the terminal.
+ */
+int cArrivalRunway::GetWaitingBytes()
+{
+    return (int)(_head.load(std::memory_order_acquire) - _tail.load(std::memory_order_relaxed));
+}
+
+/**
+ * @brief Consumer side. Gives every
+ * waiting byte to the terminal's
+ * _HandleUARTArrival, then frees them
+ * all at once for the producer.
+ * Stops right after a plane lands so it
+ * can be handled before the next one
+ * lands over it. The rest waits for the
+ * next call.
+ * @param terminal
+ * The terminal the bytes arrive at.
+ * @return Execution::Passed = A plane landed | Execution::Bypassed = Bytes given, no plane landed yet | Execution::Unecessary = Nothing to drain
+ */
+Execution cArrivalRunway::DrainInto(cTerminal* terminal)
+{
+    Execution result = Execution::Bypassed;
+    unsigned int drained;
+    unsigned int tail = _tail.load(std::memory_order_relaxed);
+    unsigned int head = _head.load(std::memory_order_acquire);
+    unsigned int waiting = head - tail;
+
+    if(waiting == 0)
+    {
+        return Execution::Unecessary;
+    }
+
+    if(waiting > mostBytesWaiting)
+    {
+        mostBytesWaiting = waiting;
+    }
+
+    for(drained = 0; drained < waiting && result != Execution::Passed; drained++)
+    {
+        result = terminal->_HandleUARTArrival(_runway[(tail + drained) & (SIZE_OF_ARRIVAL_RUNWAY - 1)]);
+        if(result != Execution::Passed)
+        {
+            result = Execution::Bypassed;
+        }
+    }
+    tail += drained;
+
+    drainedBytes += drained;
+    _tail.store(tail, std::memory_order_release);
+    return result;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file Sampler.h
+ * @author Lyam (Lyam.brs@gmail.com)
+ * @brief This file contains the input
+ * sampler class. The inputs are sampled in
+ * their own task and published as a single
+ * snapshot other tasks read without locks.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+#ifndef SAMPLER_H
+  #define SAMPLER_H
+//=============================================//
+//	Include
+//=============================================//
+#include "Globals.h"
+
+/// @brief Bit of cInputSnapshot::switches holding the left joystick's switch. Buttons 1 to 5 are bits 0 to 4.
+#define SNAPSHOT_LEFT_SWITCH_BIT 5
+/// @brief Bit of cInputSnapshot::switches holding the right joystick's switch.
+#define SNAPSHOT_RIGHT_SWITCH_BIT 6
+
+/// @brief Times Read tries again while the sampler is publishing before giving up.
+#define MAX_SNAPSHOT_READ_ATTEMPTS 8
+
+#if defined(ARDUINO_ARCH_ESP32)
+/// @brief Core the input sampling task is pinned to. The Arduino loop runs on the other one.
+#define INPUT_SAMPLING_CORE 0
+#define INPUT_SAMPLING_STACK_SIZE 4096
+#define INPUT_SAMPLING_PRIORITY 2
+/// @brief Milliseconds between 2 samples of the input sampling task.
+#define INPUT_SAMPLING_PERIOD_MS 1
+#endif
+
+/**
+ * @brief Every input of Gamepad, as they
+ * were at one instant.
+ */
+struct cInputSnapshot
+{
+    int leftX = 0;
+    int leftY = 0;
+    int rightX = 0;
+    int rightY = 0;
+    /// @brief One bit per switch. See SNAPSHOT_LEFT_SWITCH_BIT.
+    unsigned int switches = 0;
+    /// @brief Set by Publish. Tells snapshots apart.
+    unsigned int sampleNumber = 0;
+    /// @brief micros() when it was sampled.
+    unsigned long sampledAt = 0;
+};
+
+/// @brief Amount of words a snapshot is published in.
+#define INPUT_SNAPSHOT_WORDS (sizeof(cInputSnapshot) / sizeof(unsigned int))
+static_assert(sizeof(cInputSnapshot) % sizeof(unsigned int) == 0, "cInputSnapshot must be made of whole words");
+
+/**
+ * @brief Class that hands the latest input
+ * snapshot from the task sampling the inputs
+ * to the tasks using them, through a seqlock.
+ * The sampler never waits on readers and
+ * readers never block it: a reader that raced
+ * a publish just reads again.
+ * @attention
+ * Only one task may Publish. Any amount of
+ * tasks, on any core, may Read.
+ */
+class cInputSampler
+ {
+    private:
+        /// @brief Odd while a snapshot is being published. Incremented twice per snapshot.
+        std::atomic<unsigned int> _sequence;
+
+        /// @brief The snapshot, word by word, so no access is ever a data race.
+        std::atomic<unsigned int> _words[INPUT_SNAPSHOT_WORDS];
+
+    public:
+        /// @brief set to true if the class is constructed.
+        bool built = false;
+
+        /// @brief Amount of times a Read raced a Publish and read again.
+        std::atomic<unsigned long> readRetries;
+
+        //////////////////////////////////////////////
+        cInputSampler();
+        //////////////////////////////////////////////
+
+        /**
+         * @brief Makes a snapshot the latest one.
+         * Never waits.
+         * @param snapshot
+         * The inputs. Its sampleNumber is ignored.
+         * @return Execution::Passed = Published
+         */
+        Execution Publish(const cInputSnapshot* snapshot);
+
+        /**
+         * @brief Copies the latest snapshot. Never
+         * returns a snapshot that was half published.
+         * @param resultedSnapshot
+         * Where the snapshot is placed.
+         * @return Execution::Passed = Snapshot placed | Execution::Unecessary = Nothing published yet | Execution::Bypassed = Kept racing the sampler, try again later
+         */
+        Execution Read(cInputSnapshot* resultedSnapshot);
+ };
+
+/**
+ * @brief Updates the joysticks and switches,
+ * then publishes their values through the
+ * Sampler as one snapshot.
+ * @attention
+ * With the sampling task, read the inputs
+ * through Sampler.Read only. Their objects
+ * are updated from the other core.
+ */
+void SampleInputs();
+
+#if defined(ARDUINO_ARCH_ESP32)
+/**
+ * @brief FreeRTOS task sampling the inputs
+ * every INPUT_SAMPLING_PERIOD_MS, on its own
+ * core, so the protocol never delays it.
+ * See ScheduleApplication.
+ * @param parameters
+ * Unused.
+ */
+void InputSamplingTask(void* parameters);
+#endif
+
+#endif
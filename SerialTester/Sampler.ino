@@ -0,0 +1,152 @@
+/**
+ * @file Sampler.ino
+ * @author Lyam (Lyam.brs@gmail.com)
+ * @brief The code methods of the
+ * input sampler class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########   */
+/////////////////////////////////////////////////////////////////////////////
+#include "Sampler.h"
+/////////////////////////////////////////////////////////////////////////////
+cInputSampler::cInputSampler()
+{
+    _sequence.store(0);
+    for(unsigned int word = 0; word < INPUT_SNAPSHOT_WORDS; word++)
+    {
+        _words[word].store(0);
+    }
+    readRetries.store(0);
+    built = true;
+}
+
+/**
+ * @brief Makes a snapshot the latest one.
+ * Never waits.
+ * @param snapshot
+ * The inputs. Its sampleNumber is ignored.
+ * @return Execution::Passed = Published
+ */
+Execution cInputSampler::Publish(const cInputSnapshot* snapshot)
+{
+    unsigned int words[INPUT_SNAPSHOT_WORDS];
+    cInputSnapshot published = *snapshot;
+    unsigned int sequence = _sequence.load(std::memory_order_relaxed);
+
+    published.sampleNumber = sequence / 2 + 1;
+    memcpy(words, &published, sizeof(words));
+
+    // Odd: readers that start now wait. The release stores keep the words after it.
+    _sequence.store(sequence + 1, std::memory_order_relaxed);
+    for(unsigned int word = 0; word < INPUT_SNAPSHOT_WORDS; word++)
+    {
+        _words[word].store(words[word], std::memory_order_release);
+    }
+    _sequence.store(sequence + 2, std::memory_order_release);
+    return Execution::Passed;
+}
+
+/**
+ * @brief Copies the latest snapshot. Never
+ * returns a snapshot that was half published.
+ * @param resultedSnapshot
+ * Where the snapshot is placed.
+ * @return Execution::Passed = Snapshot placed | Execution::Unecessary = Nothing published yet | Execution::Bypassed = Kept racing the sampler, try again later
+ */
+Execution cInputSampler::Read(cInputSnapshot* resultedSnapshot)
+{
+    unsigned int words[INPUT_SNAPSHOT_WORDS];
+
+    for(int attempt = 0; attempt < MAX_SNAPSHOT_READ_ATTEMPTS; attempt++)
+    {
+        unsigned int before = _sequence.load(std::memory_order_acquire);
+        if(before == 0)
+        {
+            return Execution::Unecessary;
+        }
+
+        if((before & 1) == 0)
+        {
+            // Acquire loads: if one saw a word of the next snapshot, the sequence below saw it too.
+            for(unsigned int word = 0; word < INPUT_SNAPSHOT_WORDS; word++)
+            {
+                words[word] = _words[word].load(std::memory_order_acquire);
+            }
+
+            if(_sequence.load(std::memory_order_relaxed) == before)
+            {
+                memcpy(resultedSnapshot, words, sizeof(words));
+                return Execution::Passed;
+            }
+        }
+        readRetries.fetch_add(1, std::memory_order_relaxed);
+    }
+    return Execution::Bypassed;
+}
+
+/**
+ * @brief Updates the joysticks and switches,
+ * then publishes their values through the
+ * Sampler as one snapshot.
+ * @attention
+ * With the sampling task, read the inputs
+ * through Sampler.Read only. Their objects
+ * are updated from the other core.
+ */
+void SampleInputs()
+{
+    cInputSnapshot snapshot;
+    cSwitch* buttons[5] = {&Button1, &Button2, &Button3, &Button4, &Button5};
+    bool state = false;
+
+    InterfaceJoysticks();
+    InterfaceSwitch();
+
+    LeftJoystick.GetEverything(&snapshot.leftX, &snapshot.leftY, &state);
+    snapshot.switches |= (unsigned int)state << SNAPSHOT_LEFT_SWITCH_BIT;
+    RightJoystick.GetEverything(&snapshot.rightX, &snapshot.rightY, &state);
+    snapshot.switches |= (unsigned int)state << SNAPSHOT_RIGHT_SWITCH_BIT;
+
+    for(int button = 0; button < 5; button++)
+    {
+        buttons[button]->GetLatestValue(&state);
+        snapshot.switches |= (unsigned int)state << button;
+    }
+
+    snapshot.sampledAt = micros();
+    Sampler.Publish(&snapshot);
+}
+
+#if defined(ARDUINO_ARCH_ESP32)
+/**
+ * @brief FreeRTOS task sampling the inputs
+ * every INPUT_SAMPLING_PERIOD_MS, on its own
+ * core, so the protocol never delays it.
+ * See ScheduleApplication.
+ * @param parameters
+ * Unused.
+ */
+void InputSamplingTask(void* parameters)
+{
+    TickType_t lastWake = xTaskGetTickCount();
+
+    while(true)
+    {
+        SampleInputs();
+        // Fixed rate, like the scheduler's tasks.
+        vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(INPUT_SAMPLING_PERIOD_MS));
+    }
+}
+#endif
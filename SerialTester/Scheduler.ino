@@ -0,0 +1,279 @@
+/**
+ * @file Scheduler.ino
+ * @author Lyam (Lyam.brs@gmail.com)
+ * @brief The code methods of the
+ * cooperative scheduler class.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########   */
+/////////////////////////////////////////////////////////////////////////////
+#include "Scheduler.h"
+/////////////////////////////////////////////////////////////////////////////
+cScheduler::cScheduler()
+{
+    _taskCount = 0;
+    _clock = _Micros;
+    built = true;
+}
+
+/**
+ * @brief Scheduler running on another
+ * clock than micros(). Used by the unit
+ * tests to control time.
+ * @param clock
+ * Gives the time, in microseconds.
+ */
+cScheduler::cScheduler(SchedulerClock clock)
+{
+    _taskCount = 0;
+    _clock = clock;
+    built = true;
+}
+
+/**
+ * @brief Runs a task and measures it.
+ * @param task
+ * The task.
+ * @param dueAt
+ * When it should have started.
+ */
+void cScheduler::_Run(cTask* task, unsigned long dueAt)
+{
+    unsigned long startedAt = _clock();
+
+    task->callback();
+
+    unsigned long runtime = _clock() - startedAt;
+    unsigned long jitter = _IsBefore(startedAt, dueAt) ? 0 : startedAt - dueAt;
+
+    task->runs++;
+    task->lastRuntime = runtime;
+    task->totalRuntime += runtime;
+    task->lastJitter = jitter;
+    if(runtime > task->longestRuntime)
+    {
+        task->longestRuntime = runtime;
+    }
+    if(jitter > task->worstJitter)
+    {
+        task->worstJitter = jitter;
+    }
+    if(task->budget != NO_TASK_BUDGET && runtime > task->budget)
+    {
+        task->overruns++;
+    }
+}
+
+/**
+ * @brief Time base function executed in
+ * the loop. Runs every task that is due
+ * and every task that was signaled.
+ * @return Execution::Passed = At least one task ran | Execution::Bypassed = Nothing was due | Execution::Unecessary = No tasks
+ */
+Execution cScheduler::_Handle()
+{
+    Execution execution = Execution::Bypassed;
+
+    if(_taskCount == 0)
+    {
+        return Execution::Unecessary;
+    }
+
+    for(int taskID = 0; taskID < _taskCount; taskID++)
+    {
+        cTask* task = &_tasks[taskID];
+        unsigned long dueAt = task->nextRunAt;
+
+        if(task->period == EVENT_DRIVEN_TASK)
+        {
+            if(!task->signaled)
+            {
+                continue;
+            }
+            task->signaled = false;
+        }
+        else
+        {
+            // Read again for each task: the ones before may have taken a while.
+            unsigned long now = _clock();
+            if(_IsBefore(now, dueAt))
+            {
+                continue;
+            }
+
+            // Fixed rate. Periods that went by entirely are skipped, not caught up on.
+            unsigned long missedPeriods = (now - dueAt) / task->period;
+            task->skippedPeriods += missedPeriods;
+            dueAt += missedPeriods * task->period;
+            task->nextRunAt = dueAt + task->period;
+        }
+
+        _Run(task, dueAt);
+        execution = Execution::Passed;
+    }
+    return execution;
+}
+
+/**
+ * @brief Adds a task. Its ID is the amount
+ * of tasks added before it. Periodic tasks
+ * are due right away, then every period.
+ * @param callback
+ * What the task runs.
+ * @param period
+ * Microseconds between 2 runs. EVENT_DRIVEN_TASK to only run when signaled.
+ * @param budget
+ * Microseconds a run should take at most. NO_TASK_BUDGET if unlimited.
+ * @return Execution::Passed = Task added | Execution::Failed = Scheduler full or no callback
+ */
+Execution cScheduler::AddTask(TaskCallback callback, unsigned long period, unsigned long budget)
+{
+    if(callback == nullptr)
+    {
+        Device.SetErrorMessage("144:Scheduler -> No callback  ");
+        return Execution::Failed;
+    }
+
+    if(_taskCount == MAX_SCHEDULED_TASKS)
+    {
+        Device.SetErrorMessage("150:Scheduler -> Full         ");
+        return Execution::Failed;
+    }
+
+    _tasks[_taskCount] = cTask();
+    _tasks[_taskCount].callback = callback;
+    _tasks[_taskCount].period = period;
+    _tasks[_taskCount].budget = budget;
+    _tasks[_taskCount].nextRunAt = _clock();
+    _taskCount++;
+    return Execution::Passed;
+}
+
+/**
+ * @brief Has an event driven task run on
+ * the next _Handle. Signaling it again
+ * before it ran does nothing.
+ * @attention
+ * Call it from the loop, not from an ISR.
+ * @param taskID
+ * ID of the task.
+ * @return Execution::Passed = Signaled | Execution::Unecessary = Already signaled | Execution::Failed = No such event driven task
+ */
+Execution cScheduler::Signal(int taskID)
+{
+    if(taskID < 0 || taskID >= _taskCount || _tasks[taskID].period != EVENT_DRIVEN_TASK)
+    {
+        return Execution::Failed;
+    }
+
+    if(_tasks[taskID].signaled)
+    {
+        return Execution::Unecessary;
+    }
+
+    // Its jitter is how long it waited after the event.
+    _tasks[taskID].signaled = true;
+    _tasks[taskID].nextRunAt = _clock();
+    return Execution::Passed;
+}
+
+/**
+ * @brief Get how long until a task is due.
+ * The loop can idle that long.
+ * @param microsecondsLeft
+ * Where the time is placed. 0 if a task is already due.
+ * @return Execution::Passed = Time placed | Execution::Unecessary = Nothing periodic nor signaled
+ */
+Execution cScheduler::GetTimeUntilNextTask(unsigned long* microsecondsLeft)
+{
+    Execution execution = Execution::Unecessary;
+    unsigned long now = _clock();
+    unsigned long closest = 0;
+
+    for(int taskID = 0; taskID < _taskCount; taskID++)
+    {
+        cTask* task = &_tasks[taskID];
+        unsigned long left;
+
+        if(task->period == EVENT_DRIVEN_TASK)
+        {
+            if(!task->signaled)
+            {
+                continue;
+            }
+            left = 0;
+        }
+        else
+        {
+            left = _IsBefore(now, task->nextRunAt) ? task->nextRunAt - now : 0;
+        }
+
+        if(execution == Execution::Unecessary || left < closest)
+        {
+            closest = left;
+        }
+        execution = Execution::Passed;
+    }
+
+    if(execution == Execution::Passed)
+    {
+        *microsecondsLeft = closest;
+    }
+    return execution;
+}
+
+/**
+ * @brief Get a copy of a task and of what
+ * was measured on it.
+ * @param taskID
+ * ID of the task.
+ * @param resultedTask
+ * Where the copy is placed.
+ * @return Execution::Passed = Copied | Execution::Failed = No such task
+ */
+Execution cScheduler::GetTask(int taskID, cTask* resultedTask)
+{
+    if(taskID < 0 || taskID >= _taskCount)
+    {
+        return Execution::Failed;
+    }
+
+    *resultedTask = _tasks[taskID];
+    return Execution::Passed;
+}
+
+/// @brief Clears what was measured on every task. Their schedule is kept.
+Execution cScheduler::ResetStatistics()
+{
+    for(int taskID = 0; taskID < _taskCount; taskID++)
+    {
+        cTask* task = &_tasks[taskID];
+        task->runs = 0;
+        task->lastRuntime = 0;
+        task->longestRuntime = 0;
+        task->totalRuntime = 0;
+        task->lastJitter = 0;
+        task->worstJitter = 0;
+        task->overruns = 0;
+        task->skippedPeriods = 0;
+    }
+    return Execution::Passed;
+}
+
+/// @brief Amount of tasks added.
+int cScheduler::GetTaskCount()
+{
+    return _taskCount;
+}
@@ -27,6 +27,12 @@
 #define MAX_PLANE_SIZE 40
 
 EspSoftwareSerial::UART kontrolToGamepad;
+/// @brief Sends planes to the master without ever waiting on kontrolToGamepad.
+cDepartureRunway gamepadRunway(&kontrolToGamepad);
+/// @brief Holds what kontrolToGamepad received until the loop gives it to MasterTerminal.
+cArrivalRunway masterArrivals(&kontrolToGamepad);
+
+void PlaneTakeOff(unsigned short* planePassengers, int sizeOfPlane);
 
 void setup() {
 
@@ -62,16 +68,20 @@ Serial.begin(9600);
 
 
 unsigned char UniversalInformationPlane[180] = {2,7,1,0,0,121,0,49,0,64,0,0,0,0,0,0,0,0,0,0,1,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,1,0,0,1,1,0,0,104,0,116,0,116,0,112,0,115,0,58,0,47,0,47,0,103,0,105,0,116,0,104,0,117,0,98,0,46,0,99,0,111,0,109,0,47,0,76,0,121,0,97,0,109,0,66,0,82,0,83,0,47,0,66,0,114,0,83,0,112,0,97,0,110,0,100,0,95,0,71,0,97,0,109,0,101,0,80,0,97,0,100,0,46,0,103,0,105,0,116,1,0,0,71,0,97,0,109,0,101,0,80,0,97,0,100,1,0,0,82,0,101,0,118,0,32,0,65,3,173};
-unsigned char receivedPassengers[200];
-unsigned char uartBytesToSend[100];
-unsigned short hardwarePlane[37];
-bool planeLanding = false;
-bool receivingLuggage = false;
-bool waitingForCheckSum = false;
-bool planeLanded = false;
+/// @brief 4 ints and 7 bools, built straight into this buffer.
+#define HARDWARE_PLANE_SIZE PLANE_SIZE(4*4 + 7*1, 11)
+unsigned short hardwarePlane[HARDWARE_PLANE_SIZE];
+int hardwarePlaneSize = 0;
 bool handshaken = false;
 bool sendControls = false;
-int currentPlaneSize = 0;
+
+/// @brief How planes are sent to the master. Agreed on during the handshake.
+WireMode wireMode = WireMode::Unpacked;
+/// @brief UniversalInformationPlane as chunks, for the runway.
+unsigned short universalInfoPassengers[85];
+/// @brief Answer that could not take off yet, the runway was still sending the last one. See PlaneTakeOff.
+unsigned short* planeAwaitingTakeOff = nullptr;
+int sizeOfPlaneAwaitingTakeOff = 0;
 
 void WhileError()
 {
@@ -84,20 +94,6 @@ void WhileError()
   }
 }
 
-unsigned short leftJoystickXaxisPassengers[5];   // Buffer of 1 flight attendant and 4 passenger
-unsigned short leftJoystickYaxisPassengers[5];   // Buffer of 1 flight attendant and 4 passenger
-unsigned short leftJoystickButtonPassengers[2];  // Buffer of 1 flight attendant and 1 passenger
-
-unsigned short rightJoystickXaxisPassengers[5];
-unsigned short rightJoystickYaxisPassengers[5];
-unsigned short rightJoystickButtonPassengers[2];
-
-unsigned short switch1Passengers[2];
-unsigned short switch2Passengers[2];
-unsigned short switch3Passengers[2];
-unsigned short switch4Passengers[2];
-unsigned short switch5Passengers[2];
-
 unsigned char leftJoystickXaxisLuggage[4];
 unsigned char leftJoystickYaxisLuggage[4];
 unsigned char leftJoystickButtonLuggage[1];
@@ -112,9 +108,7 @@ unsigned char switch3Luggage[1];
 unsigned char switch4Luggage[1];
 unsigned char switch5Luggage[1];
 
-unsigned short temporaryBufferA[37]; // Used to append passengers segments toghether
-unsigned short temporaryBufferB[37]; // used to append passengers segments toghether
-unsigned short boardedPassengers[34]; // Used to put all the passengers before boarding the pilot and co-pilot
+cPacketBuilder hardwarePlaneBuilder; // Boards luggages straight into hardwarePlane
 
 int leftJoystickXaxis = 0;
 int leftJoystickYaxis = 0;
@@ -131,115 +125,19 @@ bool switch3 = false;
 bool switch4 = false;
 bool switch5 = false;
 
-/**
- * @brief Interface that clears the runway
- * of anything saved.
- */
-void ClearRunway()
-{
-  currentPlaneSize = 0;
-  receivingLuggage = 0;
-  waitingForCheckSum = 0;
-  for(int index = 0; index<200; index++)
-  {
-    receivedPassengers[index] = 0;
-  }
-}
-
-/**
- * @brief Interface that handles data received when
- * the data is a passenger.
- * @param passenger 
- */
-void HandlePassengerLuggage(unsigned char passenger)
-{
-  if(receivingLuggage && planeLanding)
-  {
-    receivedPassengers[currentPlaneSize] = passenger;
-    currentPlaneSize++;
-    receivingLuggage = false;
-
-    if(waitingForCheckSum)
-    {
-      waitingForCheckSum = false;
-      receivingLuggage = false;
-      planeLanding = false;
-      planeLanded = true;
-    }
-  }
-}
-
-/**
- * @brief Interface that handles data received
- * when the current data is a passenger type.
- * @param passengerType 
- */
-void HandlePassengerType(unsigned char passengerType)
-{
-  if(!receivingLuggage)
-  {
-    // passenger to come is a pilot 
-    if(!planeLanding && passengerType == 2 && !receivingLuggage)
-    {
-      planeLanding = true;
-      ClearRunway();
-      receivedPassengers[currentPlaneSize] = 2;
-      currentPlaneSize++;
-      receivingLuggage = true;
-      waitingForCheckSum = true;
-      return;
-    }
-
-    // next passenger is a co-pilot
-    if(planeLanding && passengerType == 3 && !receivingLuggage)
-    {
-      ClearRunway();
-      receivedPassengers[currentPlaneSize] = 3;
-      currentPlaneSize++;
-      receivingLuggage = true;
-      return;
-    }
-
-    // next passenger is a passenger
-    if(planeLanding && passengerType == 0 && !receivingLuggage)
-    {
-      ClearRunway();
-      receivedPassengers[currentPlaneSize] = 0;
-      currentPlaneSize++;
-      receivingLuggage = true;
-      return;
-    }
-
-    // next passenger is a flight attendant.
-    if(planeLanding && passengerType == 1 && !receivingLuggage)
-    {
-      ClearRunway();
-      receivedPassengers[currentPlaneSize] = 1;
-      currentPlaneSize++;
-      receivingLuggage = true;
-      return;
-    }
-  }
-}
-
 /**
  * @brief Interface that surounds the hardware pilot
  */
 void HandleReceivedMasterData()
 {
-  if (kontrolToGamepad.available())
+  // Producer side. Could as well run from a UART event task, masterArrivals is lock free.
+  masterArrivals._HandleReception();
+
+  if (masterArrivals.GetWaitingBytes() > 0)
   {
     Device.SetStatus(Status::Busy);
-    unsigned char currentByte = kontrolToGamepad.read();
-
-    if(!planeLanding || !receivingLuggage)
-    {
-      HandlePassengerType(currentByte);
-    }
-    else
-    {
-      HandlePassengerLuggage(currentByte);
-    }
+    // The terminal tells apart unpacked, packed and protected bytes by itself.
+    masterArrivals.DrainInto(&MasterTerminal);
   }
 }
 
@@ -267,18 +165,15 @@ void UpdateAllControls()
  */
 bool PlaneIsAnHandshake()
 {
-  if(planeLanded)
+  unsigned char planeID;
+
+  if(MasterTerminal.GetLastPlaneID(&planeID) == Execution::Passed && planeID == 7)
   {
-    planeLanded = false;
-    if(receivedPassengers[1] == 7)
-    {
-      handshaken = true;
-      return true;
-    }
-    else
-    {
-      return false;
-    }
+    MasterTerminal.packetAvailable = false;
+    // A master that handshakes in packed frames or protected chunks wants its answers the same way.
+    wireMode = MasterTerminal.arrivalWireMode;
+    handshaken = true;
+    return true;
   }
   return false;
 }
@@ -291,17 +186,12 @@ bool PlaneIsAnHandshake()
  */
 bool PlaneIsAnHardwareRequest()
 {
-  if(planeLanded)
+  unsigned char planeID;
+
+  if(MasterTerminal.GetLastPlaneID(&planeID) == Execution::Passed && planeID == 20)
   {
-    planeLanded = false;
-    if(receivedPassengers[1] == 20)
-    {
-      return true;
-    }
-    else
-    {
-      return false;
-    }
+    MasterTerminal.packetAvailable = false;
+    return true;
   }
   return false;
 }
@@ -312,10 +202,11 @@ bool PlaneIsAnHardwareRequest()
  */
 void SendUniversalInfo()
 {
-  for(int index = 0; index < 170; index++)
+  for(int index = 0; index < 85; index++)
   {
-    kontrolToGamepad.write(UniversalInformationPlane[index]);
+    universalInfoPassengers[index] = (UniversalInformationPlane[2*index] << 8) | UniversalInformationPlane[2*index + 1];
   }
+  PlaneTakeOff(universalInfoPassengers, 85);
 }
 
 #pragma region ------------------------- RGB handlers
@@ -503,7 +394,7 @@ void ConvertSwitchesToLuggage()
 
 /**
  * @brief Interface that converts hardware to
- * luggages to be later assigned to passengers.
+ * luggages to be later boarded in the plane.
  */
 void ConvertVariablesToLuggage()
 {
@@ -513,209 +404,41 @@ void ConvertVariablesToLuggage()
 }
 #pragma endregion
 
-#pragma region ------------------------- Passenger classes convertions
-/**
- * @brief Function that generates segments 
- * from the left joystick values
- */
-void AssignLeftJoystickLuggageToPassengers()
-{
-  Execution result;
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(leftJoystickXaxisLuggage, leftJoystickXaxisPassengers, 4, 5);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("439: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(leftJoystickYaxisLuggage, leftJoystickYaxisPassengers, 4, 5);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("446: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(leftJoystickButtonLuggage, leftJoystickButtonPassengers, 1, 2);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("453: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-}
-/**
- * @brief Function that generates segments 
- * from the right joystick values
- */
-void AssignRightJoystickLuggageToPassengers()
-{
-  Execution result;
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(rightJoystickXaxisLuggage, rightJoystickXaxisPassengers, 4, 5);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("465: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(rightJoystickYaxisLuggage, rightJoystickYaxisPassengers, 4, 5);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("472: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(rightJoystickButtonLuggage, rightJoystickButtonPassengers, 1, 2);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("479: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-}
-/**
- * @brief Function that generates segments 
- * from the switches values
- */
-void AssignSwitchesLuggageToPassengers()
-{
-  Execution result;
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(switch1Luggage, switch1Passengers, 1, 2);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("491: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(switch2Luggage, switch2Passengers, 1, 2);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("498: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(switch3Luggage, switch3Passengers, 1, 2);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("505: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(switch4Luggage, switch4Passengers, 1, 2);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("512: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  //////////////////////////////////////////
-  result = Packet.GetParameterSegmentFromBytes(switch5Luggage, switch5Passengers, 1, 2);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("519: Packet.GetParameterSegmentFromBytes");
-    Device.SetStatus(Status::CommunicationError);
-  }
-}
-
-/**
- * @brief Interface that assigns luggages
- * to passengers.
- */
-void AssignLuggagesToPassengers()
-{
-  AssignLeftJoystickLuggageToPassengers();
-  AssignRightJoystickLuggageToPassengers();
-  AssignSwitchesLuggageToPassengers();
-}
-#pragma endregion
-
 #pragma region ------------------------- Board classes in plane
 /**
- * @brief Function that generates segments
- * to build a plane later.
+ * @brief Function that boards every luggage
+ * in hardwarePlane, in order. Each luggage becomes
+ * one segment of the plane.
  */
 void BoardPassengersInThePlane()
 {
   Execution result;
-  int temporarySegmentSize = 10;
-  /////////////////////////////////////// LX + LY
-  result = Packet.AppendSegments(leftJoystickXaxisPassengers, 5, leftJoystickYaxisPassengers, 5, temporaryBufferA, &temporarySegmentSize);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("545: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  /////////////////////////////////////// LX,LY + LB
-  temporarySegmentSize = 12;
-  result = Packet.AppendSegments(temporaryBufferA, 10, leftJoystickButtonPassengers, 2, temporaryBufferB, &temporarySegmentSize);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("556: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  /////////////////////////////////////// LX,LY,LB + RX
-  temporarySegmentSize = 17;
-  result = Packet.AppendSegments(temporaryBufferB, 12, rightJoystickXaxisPassengers, 5, temporaryBufferA, &temporarySegmentSize);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("564: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  /////////////////////////////////////// LX,LY,LB,RX + RY
-  temporarySegmentSize = 22;
-  result = Packet.AppendSegments(temporaryBufferA, 17, rightJoystickYaxisPassengers, 5, temporaryBufferB, &temporarySegmentSize);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("572: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  /////////////////////////////////////// LX,LY,LB,RX,RY + RB
-  temporarySegmentSize = 24;
-  result = Packet.AppendSegments(temporaryBufferB, 22, rightJoystickButtonPassengers, 2, temporaryBufferA, &temporarySegmentSize);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("580: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
-  }
+  unsigned char* luggages[11] = {
+    leftJoystickXaxisLuggage, leftJoystickYaxisLuggage, leftJoystickButtonLuggage,
+    rightJoystickXaxisLuggage, rightJoystickYaxisLuggage, rightJoystickButtonLuggage,
+    switch1Luggage, switch2Luggage, switch3Luggage, switch4Luggage, switch5Luggage
+  };
+  int luggageSizes[11] = {4, 4, 1, 4, 4, 1, 1, 1, 1, 1, 1};
 
-  /////////////////////////////////////// LX,LY,LB,RX,RY,RB + S1
-  temporarySegmentSize = 26;
-  result = Packet.AppendSegments(temporaryBufferA, 24, switch1Passengers, 2, temporaryBufferB, &temporarySegmentSize);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("589: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  /////////////////////////////////////// LX,LY,LB,RX,RY,RB,S1 + S2
-  temporarySegmentSize = 28;
-  result = Packet.AppendSegments(temporaryBufferB, 26, switch2Passengers, 2, temporaryBufferA, &temporarySegmentSize);
+  result = hardwarePlaneBuilder.Begin(20, hardwarePlane, HARDWARE_PLANE_SIZE);
   if(result != Execution::Passed)
   {
-    Device.SetErrorMessage("597: Packet.AppendSegments");
+    Device.SetErrorMessage("524: hardwarePlaneBuilder.Begin");
     Device.SetStatus(Status::CommunicationError);
+    return;
   }
-  /////////////////////////////////////// LX,LY,LB,RX,RY,RB,S1,S2 + S3
-  temporarySegmentSize = 30;
-  result = Packet.AppendSegments(temporaryBufferA, 28, switch3Passengers, 2, temporaryBufferB, &temporarySegmentSize);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("605: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  /////////////////////////////////////// LX,LY,LB,RX,RY,RB,S1,S2,S3 + S4
-  temporarySegmentSize = 32;
-  result = Packet.AppendSegments(temporaryBufferB, 30, switch4Passengers, 2, temporaryBufferA, &temporarySegmentSize);
-  if(result != Execution::Passed)
-  {
-    Device.SetErrorMessage("613: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
-  }
-  /////////////////////////////////////// LX,LY,LB,RX,RY,RB,S1,S2,S3,S4 + S5
-  temporarySegmentSize = 34;
-  result = Packet.AppendSegments(temporaryBufferA, 32, switch5Passengers, 2, boardedPassengers, &temporarySegmentSize);
-  if(result != Execution::Passed)
+
+  for(int luggage = 0; luggage < 11; luggage++)
   {
-    Device.SetErrorMessage("621: Packet.AppendSegments");
-    Device.SetStatus(Status::CommunicationError);
+    result = hardwarePlaneBuilder.AddSegment(luggages[luggage], luggageSizes[luggage]);
+    if(result != Execution::Passed)
+    {
+      // A plane missing luggages must never be sealed and sent.
+      hardwarePlaneBuilder.Abort();
+      Device.SetErrorMessage("534: hardwarePlaneBuilder.AddSegment");
+      Device.SetStatus(Status::CommunicationError);
+      return;
+    }
   }
 }
 #pragma endregion
@@ -728,9 +451,17 @@ void GetPlaneReadyForTakeOff()
 {
   Execution result;
   /////////////////
-  result = Packet.CreateFromSegments(20, boardedPassengers, 34, hardwarePlane, 36);
+  if(!hardwarePlaneBuilder.built)
+  {
+    // Boarding failed and already said why.
+    hardwarePlaneSize = 0;
+    return;
+  }
+
+  result = hardwarePlaneBuilder.Finish(&hardwarePlaneSize);
   if(result != Execution::Passed)
   {
+    hardwarePlaneSize = 0;
     Device.SetErrorMessage("636: Plane building failure");
     Device.SetStatus(Status::CommunicationError);
   }
@@ -743,7 +474,6 @@ void BuildHardwarePlane()
 {
   ExtractVariablesFromHardware();
   ConvertVariablesToLuggage();
-  AssignLuggagesToPassengers();
   BoardPassengersInThePlane();
   GetPlaneReadyForTakeOff();
 }
@@ -756,9 +486,12 @@ void HandleAnswerToHardwareRequest()
 {
   Device.SetStatus(Status::Busy);
   BuildHardwarePlane();
-  PlaneTakeOff(hardwarePlane, 37);
-  ClearRunway();
-  planeLanded = false;
+  if(hardwarePlaneSize == 0)
+  {
+    // Nothing valid to answer with. The error is already set.
+    return;
+  }
+  PlaneTakeOff(hardwarePlane, hardwarePlaneSize);
   Device.SetStatus(Status::Available);
 }
 #pragma endregion
@@ -771,25 +504,26 @@ void HandleAnswerToHardwareRequest()
 void PlaneTakeOff(unsigned short* planePassengers, int sizeOfPlane)
 {
   Execution result;
-  unsigned char uartPassenger[2];
 
-  // Convert passengers to uart bytes.
-  for (unsigned char passengerIndex = 0; passengerIndex < sizeOfPlane; passengerIndex++)
+  // A master that negotiated CRC-8 checks our planes with it too.
+  cTerminal::SealPlane(planePassengers, sizeOfPlane, MasterTerminal.planeCheck);
+
+  // The runway encodes the whole plane now and sends it over the next loops.
+  gamepadRunway.wireMode = wireMode;
+  result = gamepadRunway.SetPlaneForTakeOff(planePassengers, sizeOfPlane);
+  if(result == Execution::Bypassed)
   {
-    unsigned short passenger = planePassengers[passengerIndex];
+    // The last plane is still being sent. Its request was already handled, so this answer waits its turn.
+    planeAwaitingTakeOff = planePassengers;
+    sizeOfPlaneAwaitingTakeOff = sizeOfPlane;
+    return;
+  }
 
-    result = Chunk.ToUART(passenger, uartPassenger);
-    if(result != Execution::Passed)
-    {
-      Device.SetErrorMessage("664: UART Convertion failure");
-      Device.SetStatus(Status::CommunicationError);
-    }
-    //Serial.print(uartPassenger[1]);
-    //Serial.print(",");
-    //Serial.print(uartPassenger[0]);
-    //Serial.print(",");
-    kontrolToGamepad.write(uartPassenger[1]);
-    kontrolToGamepad.write(uartPassenger[0]);
+  planeAwaitingTakeOff = nullptr;
+  if(result != Execution::Passed)
+  {
+    Device.SetErrorMessage("492: Runway takeoff failure");
+    Device.SetStatus(Status::CommunicationError);
   }
 }
 
@@ -814,8 +548,6 @@ void HandleHandshaken()
      if(PlaneIsAnHandshake())
      {
        SendUniversalInfo();
-       ClearRunway();
-       planeLanded = false;
        handshaken = true;
      }
    }
@@ -835,8 +567,6 @@ void HandleHandshaking()
     if(PlaneIsAnHandshake())
     {
       SendUniversalInfo();
-      ClearRunway();
-      planeLanded = false;
       handshaken = true;
     } 
   }
@@ -853,8 +583,18 @@ void HandleHandshaking()
 void HandleCommunications()
 {
   HandleReceivedMasterData();
-  HandleHandshaking();
-  HandleHandshaken();
+
+  if(planeAwaitingTakeOff != nullptr)
+  {
+    // New requests wait until the answer to the last one took off.
+    PlaneTakeOff(planeAwaitingTakeOff, sizeOfPlaneAwaitingTakeOff);
+  }
+  else
+  {
+    HandleHandshaking();
+    HandleHandshaken();
+  }
+  gamepadRunway._Handle();
 }
 
 /**
@@ -0,0 +1,49 @@
+/**
+ * @file _UNIT_TEST_AdcScan.h
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the ADC scanner class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+#include "Globals.h"
+
+#ifndef ADCSCAN_UNIT_TEST_H
+  #define ADCSCAN_UNIT_TEST_H
+
+/**
+ * @brief Function that returns
+ * execution::passed if published scans are
+ * only seen once swapped in, whole, and if
+ * pins are given their channel.
+ * 
+ * @return Execution 
+ */
+Execution TEST_ADCSCAN_DoubleBuffer();
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if the ADC scanner works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cAdcScanner_LaunchTests();
+
+
+#endif
@@ -56,6 +56,37 @@ Execution TEST_CHUNK_ToByte();
  * @return Execution 
  */
 Execution TEST_CHUNK_ToChunk();
+/**
+ * @brief Function that returns
+ * execution::passed if ToChunks, ToTypes
+ * and ToBytes from the cChunk class give
+ * the same results as their one chunk
+ * versions.
+ * 
+ * @return Execution 
+ */
+Execution TEST_CHUNK_Spans();
+/**
+ * @brief Function that returns
+ * execution::passed if planes packed with
+ * ToPackedUART come back the same through
+ * FromPackedUART and cPackedUARTReceiver,
+ * even after noise on the line.
+ * 
+ * @return Execution 
+ */
+Execution TEST_CHUNK_Packed();
+/**
+ * @brief Function that returns
+ * execution::passed if every chunk made by
+ * ToProtectedUART comes back through
+ * FromProtectedUART with any single bit
+ * flipped, and if any 2 flipped bits are
+ * detected.
+ * 
+ * @return Execution 
+ */
+Execution TEST_CHUNK_Protected();
 
 /**
  * @brief Unit test function which returns
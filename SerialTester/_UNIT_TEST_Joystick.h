@@ -49,6 +49,41 @@ Execution TEST_JOYSTICK_CalculateJoystickAxisDeadzone();
  * @return Execution 
  */
 Execution TEST_JOYSTICK_CalculateJoystickAxisTrim();
+/**
+ * @brief Unit test function that tests that
+ * cJoystickPipeline chains its stages in order
+ * and that each mode gets its own pipeline.
+ * 
+ * It Tests if returned executions are what's
+ * expected. It also tests that the correct
+ * values are set in the pointers.
+ * @return Execution 
+ */
+Execution TEST_JOYSTICK_Pipeline();
+/**
+ * @brief Unit test function that tests that
+ * the filter stages remove noise and spikes
+ * and follow moves as documented.
+ * 
+ * It Tests if returned executions are what's
+ * expected. It also tests that the correct
+ * values are set in the pointers.
+ * @return Execution 
+ */
+Execution TEST_JOYSTICK_Filters();
+/**
+ * @brief Unit test function that tests the
+ * response curves, their tables, the radial
+ * deadzone and its overshoot, setting them through the
+ * ResponseCurve gate, and that each joystick
+ * rebuilds its own tables in Update.
+ * 
+ * It Tests if returned executions are what's
+ * expected. It also tests that the correct
+ * values are set in the pointers.
+ * @return Execution 
+ */
+Execution TEST_JOYSTICK_ResponseCurves();
 #pragma endregion
 
 #pragma region Methods
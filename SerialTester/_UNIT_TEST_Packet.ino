@@ -271,6 +271,34 @@ Execution TEST_PACKET_VerifyID()
     }
     #pragma endregion
 
+    #pragma region -Every ID-
+    for(int id=0; id<256; ++id)
+    {
+        bool listed = false;
+        for(int index=0; index<_AMOUNT_OF_SUPPORTED_ID; ++index)
+        {
+            listed = listed || (supportedBFIOIDs[index] == id);
+        }
+
+        planeA[0] = ChunkType::Start + id;
+        execution = Packet.VerifyID(planeA, 4);
+        TestStepDone();
+        if((execution == Execution::Passed) != listed)
+        {
+            TestFailed("Packet.VerifyID does not match the list of supported IDs.");
+            TestExpectedVSGotten(std::to_string(listed).c_str(), std::to_string(id).c_str());
+            return Execution::Failed;
+        }
+
+        if(listed && supportedBFIOIDs[BFIO_ID_TABLE[id] - 1] != id)
+        {
+            TestFailed("BFIO_ID_TABLE gave the wrong slot.");
+            TestExpectedVSGotten(std::to_string(id).c_str(), std::to_string(BFIO_ID_TABLE[id]).c_str());
+            return Execution::Failed;
+        }
+    }
+    #pragma endregion
+
     #pragma region -Incorrect ID-
     planeA[0] = 0b0000001011111111;
     execution = Packet.VerifyID(planeA, 4);
@@ -1075,14 +1103,14 @@ Execution TEST_PACKET_EntireProcess()
     unsigned short segmentToSendC[9];
     unsigned char bytesToSendA[25];
     unsigned char bytesToSendB[27];
-    unsigned char bytesToSendC[2];
+    unsigned char bytesToSendC[8];
 
     unsigned short receivedSegmentA[26];
     unsigned short receivedSegmentB[28];
     unsigned short receivedSegmentC[9];
     unsigned char receivedBytesA[25];
     unsigned char receivedBytesB[27];
-    unsigned char receivedBytesC[2];
+    unsigned char receivedBytesC[8];
     unsigned char functionID = 8;
     unsigned char extractedFunctionID = 0;
     int resultedPlaneSize = 100;
@@ -1263,14 +1291,14 @@ Execution TEST_PACKET_EntireProcess()
       if(index < 28) {segmentToSendB[index] = 0;}
       if(index < 27) {bytesToSendB[index]   = 0;}
       if(index < 2) {segmentToSendC[index]  = 0;}
-      if(index < 2) {bytesToSendC[index]    = 0;}
+      if(index < 8) {bytesToSendC[index]    = 0;}
 
       if(index < 26) {receivedSegmentA[index] = 0;}
       if(index < 25) {receivedBytesA[index]   = 0;}
       if(index < 28) {receivedSegmentB[index] = 0;}
       if(index < 27) {receivedBytesB[index]   = 0;}
       if(index < 2)  {receivedSegmentC[index] = 0;}
-      if(index < 2)  {receivedBytesC[index]   = 0;}
+      if(index < 8)  {receivedBytesC[index]   = 0;}
     }
 
     #pragma region --- ULTRA MEGA SUPER MONSTER TEST
@@ -1500,6 +1528,670 @@ Execution TEST_PACKET_EntireProcess()
     return Execution::Passed;
 }
 
+Execution TEST_PACKET_IndexPlane()
+{
+    TestStart("IndexPlane");
+    Execution execution;
+    cPlaneIndex planeIndex;
+    unsigned char functionID = 21;
+    unsigned char receivedBytes[4];
+    unsigned char scannedBytes[4];
+    // Start(21), [Div, 1, 2, 3, 4], [Div, 5], [Div, 6, 7], Check
+    unsigned char wantedCheckSum = 21 + 1 + 2 + 3 + 4 + 5 + 6 + 7;
+    unsigned short plane[11] = {
+        (unsigned short)(ChunkType::Start + functionID),
+        ChunkType::Div, 1, 2, 3, 4,
+        ChunkType::Div, 5,
+        ChunkType::Div, 6, 7
+    };
+    unsigned short fullPlane[12];
+    int wantedOffsets[3] = {2, 7, 9};
+    int wantedLengths[3] = {4, 1, 2};
+
+    for(int index = 0; index < 11; index++)
+    {
+        fullPlane[index] = plane[index];
+    }
+    fullPlane[11] = ChunkType::Check + wantedCheckSum;
+
+    #pragma region --- Valid plane
+    execution = Packet.IndexPlane(fullPlane, 12, &planeIndex);
+    TestStepDone();
+    if(execution != Execution::Passed)
+    {
+        TestFailed("IndexPlane did not pass a valid plane");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    if(planeIndex.planeID != functionID || planeIndex.planeSize != 12 || planeIndex.parameterCount != 3)
+    {
+        TestFailed("IndexPlane returned wrong plane informations");
+        TestExpectedVSGotten(std::to_string(3).c_str(), std::to_string(planeIndex.parameterCount).c_str());
+        return Execution::Failed;
+    }
+
+    for(int segment = 0; segment < 3; segment++)
+    {
+        TestStepDone();
+        if(planeIndex.segmentOffsets[segment] != wantedOffsets[segment] || planeIndex.segmentLengths[segment] != wantedLengths[segment])
+        {
+            TestFailed("Segment table does not match the plane");
+            TestExpectedVSGotten(std::to_string(wantedOffsets[segment]).c_str(), std::to_string(planeIndex.segmentOffsets[segment]).c_str());
+            return Execution::Failed;
+        }
+    }
+    #pragma endregion
+
+    #pragma region --- Indexed GetBytes matches scanning GetBytes
+    for(int segment = 1; segment <= 3; segment++)
+    {
+        execution = Packet.GetBytes(&planeIndex, fullPlane, segment, receivedBytes, 4);
+        TestStepDone();
+        if(execution != Execution::Passed)
+        {
+            TestFailed("Indexed GetBytes failed");
+            TestExecution(execution);
+            return Execution::Failed;
+        }
+
+        execution = Packet.GetBytes(fullPlane, 12, segment, scannedBytes, 4);
+        TestStepDone();
+        if(execution != Execution::Passed)
+        {
+            TestFailed("GetBytes failed");
+            TestExecution(execution);
+            return Execution::Failed;
+        }
+
+        for(int byte = 0; byte < wantedLengths[segment-1]; byte++)
+        {
+            if(receivedBytes[byte] != scannedBytes[byte])
+            {
+                TestFailed("Indexed GetBytes does not match GetBytes");
+                TestExpectedVSGotten(std::to_string(scannedBytes[byte]).c_str(), std::to_string(receivedBytes[byte]).c_str());
+                return Execution::Failed;
+            }
+        }
+    }
+
+    execution = Packet.GetBytes(&planeIndex, fullPlane, 4, receivedBytes, 4);
+    TestStepDone();
+    if(execution != Execution::Failed)
+    {
+        TestFailed("Indexed GetBytes found a segment that does not exist");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    execution = Packet.GetBytes(&planeIndex, fullPlane, 1, receivedBytes, 3);
+    TestStepDone();
+    if(execution != Execution::Crashed)
+    {
+        TestFailed("Indexed GetBytes wrote past the given array");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Scanning GetBytes past 255 chunks
+    // [Div, 299 zeros], [Div, 7]: the second segment starts past what a byte can index.
+    unsigned short longSegments[302] = {ChunkType::Div};
+    longSegments[300] = ChunkType::Div;
+    longSegments[301] = 7;
+    execution = Packet.GetBytes(longSegments, 302, 2, receivedBytes, 4);
+    TestStepDone();
+    if(execution != Execution::Passed || receivedBytes[0] != 7)
+    {
+        TestFailed("GetBytes lost a segment past 255 chunks");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Corrupted planes
+    fullPlane[11] = ChunkType::Check + (unsigned char)(wantedCheckSum + 1);
+    execution = Packet.IndexPlane(fullPlane, 12, &planeIndex);
+    TestStepDone();
+    if(execution != Execution::Failed)
+    {
+        TestFailed("IndexPlane accepted a wrong checksum");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    fullPlane[11] = ChunkType::Check + wantedCheckSum;
+
+    fullPlane[7] = ChunkType::Div;
+    execution = Packet.IndexPlane(fullPlane, 12, &planeIndex);
+    TestStepDone();
+    if(execution != Execution::Crashed)
+    {
+        TestFailed("IndexPlane accepted consecutive Div chunks");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    fullPlane[7] = 5;
+
+    execution = Packet.IndexPlane(fullPlane, 11, &planeIndex);
+    TestStepDone();
+    if(execution != Execution::Crashed)
+    {
+        TestFailed("IndexPlane accepted a plane without Check chunk");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    execution = Packet.IndexPlane(&fullPlane[1], 11, &planeIndex);
+    TestStepDone();
+    if(execution != Execution::Failed)
+    {
+        TestFailed("IndexPlane accepted a plane without Start chunk");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    TestPassed();
+    return Execution::Passed;
+}
+
+Execution TEST_PACKET_Views()
+{
+    TestStart("Views");
+    Execution execution;
+    cPacketView view;
+    cSegmentView segment;
+    unsigned char functionID = 21;
+
+    int wantedInt = -123456;
+    double wantedDouble = 3.25;
+    std::string wantedString = "BFIO";
+    bool wantedBool = true;
+
+    unsigned char intBytes[4];
+    unsigned char doubleBytes[8];
+    unsigned char stringBytes[4];
+    unsigned char boolBytes[1];
+
+    Data.ToBytes(wantedInt, intBytes, 4);
+    Data.ToBytes(wantedDouble, doubleBytes, 8);
+    Data.ToBytes(wantedString, stringBytes, 4);
+    Data.ToBytes(wantedBool, boolBytes, 1);
+
+    unsigned char* segments[4] = {intBytes, doubleBytes, stringBytes, boolBytes};
+    int segmentSizes[4] = {4, 8, 4, 1};
+
+    // Start, 4 * Div + bytes, Check
+    unsigned short plane[23];
+    int planeSize = 0;
+    unsigned char checkSum = functionID;
+    plane[planeSize++] = ChunkType::Start + functionID;
+    for(int segmentIndex = 0; segmentIndex < 4; segmentIndex++)
+    {
+        plane[planeSize++] = ChunkType::Div;
+        for(int byte = 0; byte < segmentSizes[segmentIndex]; byte++)
+        {
+            plane[planeSize++] = segments[segmentIndex][byte];
+            checkSum += segments[segmentIndex][byte];
+        }
+    }
+    plane[planeSize++] = ChunkType::Check + checkSum;
+
+    #pragma region --- Closed view
+    execution = view.GetSegment(1, &segment);
+    TestStepDone();
+    if(execution != Execution::Crashed)
+    {
+        TestFailed("A closed view returned a segment");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Opening
+    execution = view.Open(plane, planeSize);
+    TestStepDone();
+    if(execution != Execution::Passed)
+    {
+        TestFailed("View could not open a valid plane");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    if(view.GetID() != functionID || view.GetSize() != planeSize || view.GetParameterCount() != 4)
+    {
+        TestFailed("View returned wrong plane informations");
+        TestExpectedVSGotten(std::to_string(4).c_str(), std::to_string(view.GetParameterCount()).c_str());
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Reading segments
+    int gottenInt = 0;
+    int dataInt = 0;
+    view.GetSegment(1, &segment);
+    execution = segment.ToData(&gottenInt);
+    Data.ToData(&dataInt, intBytes, 4);
+    TestStepDone();
+    if(execution != Execution::Passed || gottenInt != dataInt || gottenInt != wantedInt)
+    {
+        TestFailed("int read through the view is wrong");
+        TestExpectedVSGotten(std::to_string(wantedInt).c_str(), std::to_string(gottenInt).c_str());
+        return Execution::Failed;
+    }
+
+    double gottenDouble = 0;
+    view.GetSegment(2, &segment);
+    execution = segment.ToData(&gottenDouble);
+    TestStepDone();
+    if(execution != Execution::Passed || gottenDouble != wantedDouble)
+    {
+        TestFailed("double read through the view is wrong");
+        TestExpectedVSGotten(std::to_string(wantedDouble).c_str(), std::to_string(gottenDouble).c_str());
+        return Execution::Failed;
+    }
+
+    std::string gottenString;
+    view.GetSegment(3, &segment);
+    execution = segment.ToData(gottenString);
+    TestStepDone();
+    if(execution != Execution::Passed || gottenString != wantedString)
+    {
+        TestFailed("string read through the view is wrong");
+        TestExpectedVSGotten(wantedString.c_str(), gottenString.c_str());
+        return Execution::Failed;
+    }
+
+    bool gottenBool = false;
+    view.GetSegment(4, &segment);
+    execution = segment.ToData(&gottenBool);
+    TestStepDone();
+    if(execution != Execution::Passed || gottenBool != wantedBool)
+    {
+        TestFailed("bool read through the view is wrong");
+        TestExpectedVSGotten(std::to_string(wantedBool).c_str(), std::to_string(gottenBool).c_str());
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Refusals
+    execution = view.GetSegment(5, &segment);
+    TestStepDone();
+    if(execution != Execution::Failed)
+    {
+        TestFailed("View returned a segment that does not exist");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    // A bool segment is too small to hold an int.
+    view.GetSegment(4, &segment);
+    execution = segment.ToData(&gottenInt);
+    TestStepDone();
+    if(execution != Execution::Failed)
+    {
+        TestFailed("Segment decoded an int from a single byte");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    plane[planeSize-1] = ChunkType::Check + (unsigned char)(checkSum + 1);
+    execution = view.Open(plane, planeSize);
+    TestStepDone();
+    if(execution == Execution::Passed || view.built)
+    {
+        TestFailed("View opened a plane with a wrong checksum");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    TestPassed();
+    return Execution::Passed;
+}
+
+Execution TEST_PACKET_Builder()
+{
+    TestStart("Builder");
+    Execution execution;
+    cPacketBuilder builder;
+    unsigned char functionID = 21;
+    unsigned char firstBytes[4] = {1, 2, 3, 4};
+    unsigned char secondBytes[1] = {5};
+    // [Div, 1, 2, 3, 4], [Div, 5]
+    unsigned short segments[7] = {ChunkType::Div, 1, 2, 3, 4, ChunkType::Div, 5};
+    unsigned short wantedPlane[PLANE_SIZE(5, 2)];
+    unsigned short builtPlane[PLANE_SIZE(5, 2) + 1];
+    int builtSize = 0;
+
+    Packet.CreateFromSegments(functionID, segments, 7, wantedPlane, PLANE_SIZE(5, 2));
+    builtPlane[PLANE_SIZE(5, 2)] = 0xFFFF;
+
+    #pragma region --- Not started
+    execution = builder.AddSegment(firstBytes, 4);
+    TestStepDone();
+    if(execution != Execution::Crashed)
+    {
+        TestFailed("Builder added a segment before Begin");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Same plane as CreateFromSegments
+    execution = builder.Begin(functionID, builtPlane, PLANE_SIZE(5, 2));
+    TestStepDone();
+    if(execution != Execution::Passed)
+    {
+        TestFailed("Builder could not begin");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    builder.AddSegment(firstBytes, 4);
+    builder.AddSegment(secondBytes, 1);
+    execution = builder.Finish(&builtSize);
+    TestStepDone();
+    if(execution != Execution::Passed || builtSize != PLANE_SIZE(5, 2))
+    {
+        TestFailed("Builder did not finish the plane");
+        TestExpectedVSGotten(std::to_string(PLANE_SIZE(5, 2)).c_str(), std::to_string(builtSize).c_str());
+        return Execution::Failed;
+    }
+
+    for(int index = 0; index < PLANE_SIZE(5, 2); index++)
+    {
+        TestStepDone();
+        if(builtPlane[index] != wantedPlane[index])
+        {
+            TestFailed("Builder plane does not match CreateFromSegments");
+            TestExpectedVSGotten(std::to_string(wantedPlane[index]).c_str(), std::to_string(builtPlane[index]).c_str());
+            return Execution::Failed;
+        }
+    }
+    #pragma endregion
+
+    #pragma region --- Buffer limits
+    builder.Begin(functionID, builtPlane, PLANE_SIZE(5, 2));
+    builder.AddSegment(firstBytes, 4);
+    execution = builder.AddSegment(firstBytes, 4);
+    TestStepDone();
+    if(execution != Execution::Failed)
+    {
+        TestFailed("Builder accepted a segment bigger than its buffer");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    execution = builder.AddSegment(secondBytes, 0);
+    TestStepDone();
+    if(execution != Execution::Failed)
+    {
+        TestFailed("Builder accepted an empty segment");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    builder.AddSegment(secondBytes, 1);
+    builder.Finish(&builtSize);
+    TestStepDone();
+    if(builtPlane[PLANE_SIZE(5, 2)] != 0xFFFF)
+    {
+        TestFailed("Builder wrote past its buffer");
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Aborted planes
+    builder.Begin(functionID, builtPlane, PLANE_SIZE(5, 2));
+    builder.AddSegment(firstBytes, 4);
+    execution = builder.Abort();
+    TestStepDone();
+    if(execution != Execution::Passed || builder.Finish(&builtSize) != Execution::Crashed)
+    {
+        TestFailed("Builder finished a plane that was aborted");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    execution = builder.Abort();
+    TestStepDone();
+    if(execution != Execution::Unecessary)
+    {
+        TestFailed("Builder aborted a plane it was not building");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    TestPassed();
+    return Execution::Passed;
+}
+
+Execution TEST_PACKET_Schema()
+{
+    TestStart("Schema");
+    Execution execution;
+    typedef cPlaneSchema<21, int, bool, double> cPlane_Test;
+
+    static_assert(cPlane_Test::size == PLANE_SIZE(4 + 1 + 8, 3), "Wrong schema size");
+    static_assert(cPlane_Ping::size == 4, "Ping plane is 4 chunks");
+    static_assert(cPlane_Status::size == 7, "Status plane is 7 chunks");
+    static_assert(cPlane_ID::size == 11, "ID plane is 11 chunks");
+    static_assert(cPlane_Restart::size == 2, "Restart plane is 2 chunks");
+
+    int wantedInt = -123456;
+    bool wantedBool = true;
+    double wantedDouble = -2.5;
+    unsigned char intBytes[4];
+    unsigned char boolBytes[1];
+    unsigned char doubleBytes[8];
+    unsigned short wantedPlane[cPlane_Test::size];
+    unsigned short encodedPlane[cPlane_Test::size];
+    cPacketBuilder builder;
+    int builtSize = 0;
+
+    Data.ToBytes(wantedInt, intBytes, 4);
+    Data.ToBytes(wantedBool, boolBytes, 1);
+    Data.ToBytes(wantedDouble, doubleBytes, 8);
+    builder.Begin(21, wantedPlane, cPlane_Test::size);
+    builder.AddSegment(intBytes, 4);
+    builder.AddSegment(boolBytes, 1);
+    builder.AddSegment(doubleBytes, 8);
+    builder.Finish(&builtSize);
+
+    #pragma region --- Encoding
+    cPlane_Test::Encode(encodedPlane, wantedInt, wantedBool, wantedDouble);
+    for(int index = 0; index < cPlane_Test::size; index++)
+    {
+        TestStepDone();
+        if(encodedPlane[index] != wantedPlane[index])
+        {
+            TestFailed("Schema plane does not match cData + cPacketBuilder");
+            TestExpectedVSGotten(std::to_string(wantedPlane[index]).c_str(), std::to_string(encodedPlane[index]).c_str());
+            return Execution::Failed;
+        }
+    }
+    #pragma endregion
+
+    #pragma region --- Decoding
+    int gottenInt = 0;
+    bool gottenBool = false;
+    double gottenDouble = 0;
+    execution = cPlane_Test::Decode(encodedPlane, cPlane_Test::size, &gottenInt, &gottenBool, &gottenDouble);
+    TestStepDone();
+    if(execution != Execution::Passed)
+    {
+        TestFailed("Schema could not decode its own plane");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(gottenInt != wantedInt || gottenBool != wantedBool || gottenDouble != wantedDouble)
+    {
+        TestFailed("Schema decoded wrong values");
+        TestExpectedVSGotten(std::to_string(wantedInt).c_str(), std::to_string(gottenInt).c_str());
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Refusals
+    execution = cPlane_Test::Decode(encodedPlane, cPlane_Test::size - 1, &gottenInt, &gottenBool, &gottenDouble);
+    TestStepDone();
+    if(execution != Execution::Incompatibility)
+    {
+        TestFailed("Schema decoded a plane of the wrong size");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    encodedPlane[6] = ChunkType::Byte + 1;
+    execution = cPlane_Test::Decode(encodedPlane, cPlane_Test::size, &gottenInt, &gottenBool, &gottenDouble);
+    TestStepDone();
+    if(execution != Execution::Incompatibility)
+    {
+        TestFailed("Schema decoded a plane with a missing Div chunk");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    encodedPlane[6] = ChunkType::Div;
+
+    encodedPlane[2] = (unsigned short)(encodedPlane[2] + 1);
+    gottenInt = 0;
+    execution = cPlane_Test::Decode(encodedPlane, cPlane_Test::size, &gottenInt, &gottenBool, &gottenDouble);
+    TestStepDone();
+    if(execution != Execution::Failed || gottenInt != 0)
+    {
+        TestFailed("Schema decoded a plane with a wrong checksum");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    TestPassed();
+    return Execution::Passed;
+}
+
+Execution TEST_PACKET_CRC()
+{
+    TestStart("CRC");
+    Execution execution;
+    cPacketBuilder builder;
+    cPlaneIndex index;
+    unsigned char firstBytes[4] = {1, 2, 3, 4};
+    unsigned char secondBytes[1] = {5};
+    unsigned short sumPlane[PLANE_SIZE(5, 2)];
+    unsigned short crcPlane[PLANE_SIZE(5, 2)];
+    unsigned short swapped[PLANE_SIZE(5, 2)];
+    int planeSize = 0;
+    unsigned char crc = 0;
+
+    #pragma region --- Table
+    // CRC-8 check value of "123456789" with polynomial 0x07.
+    const char* checkString = "123456789";
+    for(int i = 0; i < 9; i++)
+    {
+        crc = PLANE_CRC8_TABLE[crc ^ (unsigned char)checkString[i]];
+    }
+    TestStepDone();
+    if(crc != 0xF4)
+    {
+        TestFailed("PLANE_CRC8_TABLE is not CRC-8");
+        TestExpectedVSGotten("244", std::to_string(crc).c_str());
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Builder
+    builder.Begin(21, sumPlane, PLANE_SIZE(5, 2));
+    builder.AddSegment(firstBytes, 4);
+    builder.AddSegment(secondBytes, 1);
+    builder.Finish(&planeSize);
+
+    builder.Begin(21, crcPlane, PLANE_SIZE(5, 2));
+    builder.AddSegment(firstBytes, 4);
+    builder.AddSegment(secondBytes, 1);
+    execution = builder.Finish(&planeSize, PlaneCheck::CRC8);
+
+    Packet.GetCRC8(crcPlane, planeSize - 1, &crc);
+    TestStepDone();
+    if(execution != Execution::Passed || crcPlane[planeSize - 1] != ChunkType::Check + crc)
+    {
+        TestFailed("Builder did not put the CRC in the Check chunk");
+        TestExpectedVSGotten(std::to_string(ChunkType::Check + crc).c_str(), std::to_string(crcPlane[planeSize - 1]).c_str());
+        return Execution::Failed;
+    }
+
+    unsigned char runningCRC = 0;
+    for(int i = 0; i < planeSize - 1; i++)
+    {
+        runningCRC = cPacket::UpdateCRC8(runningCRC, crcPlane[i]);
+    }
+    TestStepDone();
+    if(runningCRC != crc)
+    {
+        TestFailed("UpdateCRC8 does not match GetCRC8");
+        return Execution::Failed;
+    }
+
+    execution = Packet.IndexPlane(crcPlane, planeSize, &index, PlaneCheck::CRC8);
+    TestStepDone();
+    if(execution != Execution::Passed)
+    {
+        TestFailed("CRC8 plane was not indexed");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+
+    execution = Packet.IndexPlane(sumPlane, planeSize, &index, PlaneCheck::CRC8);
+    TestStepDone();
+    if(execution != Execution::Failed)
+    {
+        TestFailed("Summed plane was accepted as CRC8");
+        TestExecution(execution);
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    #pragma region --- Errors the sum misses
+    // Swapped bytes: [Div, 2, 1, 3, 4]
+    memcpy(swapped, sumPlane, sizeof(swapped));
+    swapped[2] = sumPlane[3];
+    swapped[3] = sumPlane[2];
+    TestStepDone();
+    if(Packet.IndexPlane(swapped, planeSize, &index) != Execution::Passed)
+    {
+        TestFailed("Sum was expected to miss swapped bytes");
+        return Execution::Failed;
+    }
+
+    memcpy(swapped, crcPlane, sizeof(swapped));
+    swapped[2] = crcPlane[3];
+    swapped[3] = crcPlane[2];
+    TestStepDone();
+    if(Packet.IndexPlane(swapped, planeSize, &index, PlaneCheck::CRC8) != Execution::Failed)
+    {
+        TestFailed("CRC8 missed swapped bytes");
+        return Execution::Failed;
+    }
+
+    // Moved Div: [Div, 1, 2, 3], [Div, 4, 5]
+    memcpy(swapped, crcPlane, sizeof(swapped));
+    swapped[5] = ChunkType::Div;
+    swapped[6] = crcPlane[5];
+    TestStepDone();
+    if(Packet.IndexPlane(swapped, planeSize, &index, PlaneCheck::CRC8) != Execution::Failed)
+    {
+        TestFailed("CRC8 missed a moved Div chunk");
+        return Execution::Failed;
+    }
+    #pragma endregion
+
+    TestPassed();
+    return Execution::Passed;
+}
+
 /**
  * @brief Unit test function which returns
  * Execution::Passed if packet works
@@ -1558,6 +2250,31 @@ Execution cPacket_LaunchTests()
         return Execution::Failed;
     }
 
+    if(TEST_PACKET_IndexPlane() != Execution::Passed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    if(TEST_PACKET_Views() != Execution::Passed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    if(TEST_PACKET_Builder() != Execution::Passed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    if(TEST_PACKET_Schema() != Execution::Passed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    if(TEST_PACKET_CRC() != Execution::Passed){
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
     UnitTestPassed();
     return Execution::Passed;
 }
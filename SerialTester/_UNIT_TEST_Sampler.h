@@ -0,0 +1,50 @@
+/**
+ * @file _UNIT_TEST_Sampler.h
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the input sampler class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+#include "Globals.h"
+
+#ifndef SAMPLER_UNIT_TEST_H
+  #define SAMPLER_UNIT_TEST_H
+
+/**
+ * @brief Function that returns
+ * execution::passed if published snapshots
+ * are read back whole and numbered, and if
+ * SampleInputs publishes what the input
+ * objects hold.
+ * 
+ * @return Execution 
+ */
+Execution TEST_SAMPLER_Snapshot();
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if the input sampler works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cInputSampler_LaunchTests();
+
+
+#endif
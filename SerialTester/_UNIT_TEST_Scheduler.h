@@ -0,0 +1,59 @@
+/**
+ * @file _UNIT_TEST_Scheduler.h
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the Scheduler class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+#include "Globals.h"
+
+#ifndef SCHEDULER_UNIT_TEST_H
+  #define SCHEDULER_UNIT_TEST_H
+
+/**
+ * @brief Function that returns
+ * execution::passed if periodic tasks run
+ * at a fixed rate, first added first, and
+ * if their runtime, jitter, overruns and
+ * skipped periods are measured.
+ * 
+ * @return Execution 
+ */
+Execution TEST_SCHEDULER_FixedRate();
+/**
+ * @brief Function that returns
+ * execution::passed if event driven tasks
+ * only run once signaled, and if the time
+ * until the next task is right.
+ * 
+ * @return Execution 
+ */
+Execution TEST_SCHEDULER_Events();
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if scheduler works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cScheduler_LaunchTests();
+
+
+#endif
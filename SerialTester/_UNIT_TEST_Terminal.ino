@@ -0,0 +1,1790 @@
+/**
+ * @file _UNIT_TEST_Terminal.ino
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the Terminal class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ * 
+ * @copyright Copyright (c) 2023
+ * 
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ## 
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+
+
+#include "Globals.h"
+
+/// @brief Joystick(3, 4) request with 2 segments. Its check is 21+5+3+4.
+#define UT_TERMINAL_PLANE_SIZE 7
+unsigned short UT_TERMINAL_PLANE[UT_TERMINAL_PLANE_SIZE] = {ChunkType::Start + 21, ChunkType::Div, ChunkType::Byte + 5, ChunkType::Div, ChunkType::Byte + 3, ChunkType::Byte + 4, ChunkType::Check + 33};
+
+/**
+ * @brief Function that returns
+ * execution::passed if a valid plane
+ * given chunk by chunk lands already
+ * indexed, and if the terminal swaps
+ * arrival runways for the next one.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Arrival()
+{
+    Execution result;
+    // Static: a terminal does not fit on the loop task's stack next to its planes.
+    static cTerminal terminal;
+    cPacketView view;
+    cSegmentView segment;
+    unsigned short landed[UT_TERMINAL_PLANE_SIZE];
+    unsigned char planeID = 0;
+    unsigned char byte = 0;
+    unsigned char checkSum = 0;
+    int chunkCount = 0;
+
+    #pragma region Landing
+    TestStart("Terminal - Landing");
+    for(int i=0; i<UT_TERMINAL_PLANE_SIZE-1; ++i)
+    {
+        TestStepDone();
+        result = terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[i]);
+        if(result != Execution::Bypassed)
+        {
+            TestFailed("A chunk was not stored.");
+            TestExecution(result);
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    terminal.GetCurrentArrivalInfo(&planeID, &chunkCount, &checkSum);
+    if(planeID != 21 || chunkCount != UT_TERMINAL_PLANE_SIZE-1 || checkSum != 33)
+    {
+        TestFailed("Wrong information on the landing plane.");
+        TestExpectedVSGotten("21, 6, 33", (std::to_string(planeID) + ", " + std::to_string(chunkCount) + ", " + std::to_string(checkSum)).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    result = terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[UT_TERMINAL_PLANE_SIZE-1]);
+    if(result != Execution::Passed || !terminal.packetAvailable || terminal.receivingPacket)
+    {
+        TestFailed("The plane did not land.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    #pragma region Index
+    TestStart("Terminal - Index");
+    TestStepDone();
+    result = terminal.GetLastArrivalView(&view);
+    if(result != Execution::Passed || view.GetID() != 21 || view.GetSize() != UT_TERMINAL_PLANE_SIZE || view.GetParameterCount() != 2)
+    {
+        TestFailed("The landed plane was not indexed.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    view.GetSegment(2, &segment);
+    segment.GetByte(1, &byte);
+    if(segment.Size() != 2 || byte != 4)
+    {
+        TestFailed("Wrong second segment.");
+        TestExpectedVSGotten("4", std::to_string(byte).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(terminal.GetLastArrival(landed, UT_TERMINAL_PLANE_SIZE-1) != Execution::Failed)
+    {
+        TestFailed("The plane was copied in a buffer too small.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    result = terminal.GetLastArrival(landed, UT_TERMINAL_PLANE_SIZE);
+    if(result != Execution::Passed || memcmp(landed, UT_TERMINAL_PLANE, sizeof(landed)) != 0 || terminal.packetAvailable)
+    {
+        TestFailed("The landed plane is not the one sent.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(terminal.GetLastPlaneID(&planeID) != Execution::Unecessary)
+    {
+        TestFailed("The plane was still available once taken.");
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    #pragma region Runways
+    TestStart("Terminal - Runways");
+    terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[0]);
+    terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[1]);
+    terminal._HandlePlaneArrival(ChunkType::Byte + 9);
+    terminal._HandlePlaneArrival(ChunkType::Check + 30);
+    terminal.GetLastArrivalView(&view);
+
+    // The next plane lands on the other runway. The view must not move.
+    TestStepDone();
+    terminal._HandlePlaneArrival(ChunkType::Start + 26);
+    terminal._HandlePlaneArrival(ChunkType::Div);
+    terminal._HandlePlaneArrival(ChunkType::Byte + 1);
+    view.GetSegment(1, &segment);
+    segment.GetByte(0, &byte);
+    if(view.GetID() != 21 || byte != 9)
+    {
+        TestFailed("The landing plane overwrote the last one.");
+        TestExpectedVSGotten("9", std::to_string(byte).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    result = terminal._HandlePlaneArrival(ChunkType::Check + 27);
+    terminal.GetLastPlaneID(&planeID);
+    if(result != Execution::Passed || planeID != 26)
+    {
+        TestFailed("The second plane did not land.");
+        TestExpectedVSGotten("26", std::to_string(planeID).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if planes with a
+ * wrong check, stray chunks, empty
+ * parameters and cut off planes are
+ * all dropped.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Drops()
+{
+    Execution result;
+    // Static: a terminal does not fit on the loop task's stack next to its planes.
+    static cTerminal terminal;
+    unsigned char planeID = 0;
+
+    TestStart("Terminal - Drops");
+    TestStepDone();
+    for(int i=0; i<UT_TERMINAL_PLANE_SIZE-1; ++i)
+    {
+        terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[i]);
+    }
+    result = terminal._HandlePlaneArrival(ChunkType::Check + 34);
+    if(result != Execution::Failed || terminal.packetAvailable || terminal.receivingPacket)
+    {
+        TestFailed("A plane with a wrong check landed.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(terminal._HandlePlaneArrival(ChunkType::Byte + 3) != Execution::Failed)
+    {
+        TestFailed("A stray chunk was accepted.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    terminal._HandlePlaneArrival(ChunkType::Start + 21);
+    if(terminal._HandlePlaneArrival(ChunkType::Byte + 3) != Execution::Failed)
+    {
+        TestFailed("A byte outside of a parameter was accepted.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    terminal._HandlePlaneArrival(ChunkType::Start + 21);
+    terminal._HandlePlaneArrival(ChunkType::Div);
+    if(terminal._HandlePlaneArrival(ChunkType::Div) != Execution::Failed)
+    {
+        TestFailed("An empty parameter was accepted.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    terminal._HandlePlaneArrival(ChunkType::Start + 11);
+    terminal._HandlePlaneArrival(ChunkType::Div);
+    terminal._HandlePlaneArrival(ChunkType::Byte + 1);
+    result = terminal._HandlePlaneArrival(ChunkType::Check + 12);
+    if(result != Execution::Incompatibility || terminal.packetAvailable)
+    {
+        TestFailed("A plane with an unsupported ID landed.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    // A plane cut off by another start is dropped, the new one lands.
+    TestStepDone();
+    terminal._HandlePlaneArrival(ChunkType::Start + 26);
+    terminal._HandlePlaneArrival(ChunkType::Div);
+    result = terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[0]);
+    if(result != Execution::Failed)
+    {
+        TestFailed("A plane was cut off without error.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+    for(int i=1; i<UT_TERMINAL_PLANE_SIZE; ++i)
+    {
+        result = terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[i]);
+    }
+    terminal.GetLastPlaneID(&planeID);
+    if(result != Execution::Passed || planeID != 21)
+    {
+        TestFailed("The plane that cut off the other did not land.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    terminal.Reset();
+    if(terminal.packetAvailable || terminal.receivingPacket)
+    {
+        TestFailed("Reset kept arrivals.");
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if _HandleUARTArrival
+ * lands the same plane sent unpacked,
+ * packed and protected.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_WireModes()
+{
+    Execution result;
+    // Static: a terminal does not fit on the loop task's stack next to its planes.
+    static cTerminal terminal;
+    unsigned short landed[UT_TERMINAL_PLANE_SIZE];
+    unsigned char line[PACKED_UART_SIZE(UT_TERMINAL_PLANE_SIZE) + 2*2*UT_TERMINAL_PLANE_SIZE];
+    unsigned char bytes[2];
+    int lineSize = 0;
+    WireMode modes[3] = {WireMode::Unpacked, WireMode::Packed, WireMode::Protected};
+
+    TestStart("Terminal - Wire modes");
+    for(int mode=0; mode<3; ++mode)
+    {
+        lineSize = 0;
+        if(modes[mode] == WireMode::Packed)
+        {
+            Chunk.ToPackedUART(UT_TERMINAL_PLANE, UT_TERMINAL_PLANE_SIZE, line, &lineSize);
+        }
+        else
+        {
+            for(int i=0; i<UT_TERMINAL_PLANE_SIZE; ++i)
+            {
+                if(modes[mode] == WireMode::Protected)
+                {
+                    Chunk.ToProtectedUART(UT_TERMINAL_PLANE[i], bytes);
+                }
+                else
+                {
+                    Chunk.ToUART(UT_TERMINAL_PLANE[i], bytes);
+                }
+                line[lineSize++] = bytes[1];
+                line[lineSize++] = bytes[0];
+            }
+        }
+
+        // One flipped bit in the protected plane is corrected on arrival.
+        if(modes[mode] == WireMode::Protected)
+        {
+            line[5] ^= 0x10;
+        }
+
+        TestStepDone();
+        for(int i=0; i<lineSize; ++i)
+        {
+            result = terminal._HandleUARTArrival(line[i]);
+        }
+        if(result != Execution::Passed || terminal.arrivalWireMode != modes[mode])
+        {
+            TestFailed("The plane did not land in the mode it was sent.");
+            TestExpectedVSGotten(std::to_string(modes[mode]).c_str(), std::to_string(terminal.arrivalWireMode).c_str());
+            return Execution::Failed;
+        }
+
+        TestStepDone();
+        terminal.GetLastArrival(landed, UT_TERMINAL_PLANE_SIZE);
+        if(memcmp(landed, UT_TERMINAL_PLANE, sizeof(landed)) != 0)
+        {
+            TestFailed("The landed plane is not the one sent.");
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    if(terminal.correctedChunks != 1)
+    {
+        TestFailed("The flipped bit was not counted.");
+        TestExpectedVSGotten("1", std::to_string(terminal.correctedChunks).c_str());
+        return Execution::Failed;
+    }
+
+    // The flag is coded too: chunks whose flag flipped are still read as protected, and corrected.
+    TestStepDone();
+    lineSize = 0;
+    for(int i=0; i<UT_TERMINAL_PLANE_SIZE; ++i)
+    {
+        Chunk.ToProtectedUART(UT_TERMINAL_PLANE[i], bytes);
+        line[lineSize++] = bytes[1];
+        line[lineSize++] = bytes[0];
+    }
+    line[0] ^= 0x80;
+    line[lineSize - 2] ^= 0x80;
+    for(int i=0; i<lineSize; ++i)
+    {
+        result = terminal._HandleUARTArrival(line[i]);
+    }
+    terminal.GetLastArrival(landed, UT_TERMINAL_PLANE_SIZE);
+    if(result != Execution::Passed || terminal.correctedChunks != 3 || memcmp(landed, UT_TERMINAL_PLANE, sizeof(landed)) != 0)
+    {
+        TestFailed("A protected plane whose flags flipped did not land.");
+        TestExpectedVSGotten("3", std::to_string(terminal.correctedChunks).c_str());
+        return Execution::Failed;
+    }
+
+    // The other side went back to unpacked chunks: the first one drops its plane, then first bytes tell the mode again.
+    TestStepDone();
+    lineSize = 0;
+    for(int i=0; i<UT_TERMINAL_PLANE_SIZE; ++i)
+    {
+        Chunk.ToUART(UT_TERMINAL_PLANE[i], bytes);
+        line[lineSize++] = bytes[1];
+        line[lineSize++] = bytes[0];
+    }
+    for(int i=0; i<2; ++i)
+    {
+        result = terminal._HandleUARTArrival(line[i]);
+    }
+    if(result != Execution::Failed || terminal.arrivalWireMode != WireMode::Unpacked)
+    {
+        TestFailed("An unpacked chunk was not refused as protected.");
+        TestExpectedVSGotten(std::to_string(WireMode::Unpacked).c_str(), std::to_string(terminal.arrivalWireMode).c_str());
+        return Execution::Failed;
+    }
+    for(int i=0; i<lineSize; ++i)
+    {
+        result = terminal._HandleUARTArrival(line[i]);
+    }
+    terminal.GetLastArrival(landed, UT_TERMINAL_PLANE_SIZE);
+    if(result != Execution::Passed || memcmp(landed, UT_TERMINAL_PLANE, sizeof(landed)) != 0)
+    {
+        TestFailed("The unpacked plane after protected ones did not land.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(terminal._HandleUARTArrival(0x13) != Execution::Failed)
+    {
+        TestFailed("A byte that starts no chunk was accepted.");
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/// @brief Amount of segments given to UT_TERMINAL_CountSegment.
+int UT_TERMINAL_SEGMENTS = 0;
+/// @brief Last value given to UT_TERMINAL_CountLanding. -1 until called.
+int UT_TERMINAL_LANDED = -1;
+
+Execution UT_TERMINAL_CountSegment(void* gate, unsigned char planeID, int segmentNumber, cSegmentView* segment)
+{
+    UT_TERMINAL_SEGMENTS++;
+    return (segment->Size() == 0 || segmentNumber != UT_TERMINAL_SEGMENTS) ? Execution::Failed : Execution::Passed;
+}
+
+void UT_TERMINAL_CountLanding(void* gate, unsigned char planeID, bool landed)
+{
+    UT_TERMINAL_LANDED = landed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if cut-through gates
+ * get each segment while the plane lands
+ * and only commit it once its check chunk
+ * is verified.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_CutThrough()
+{
+    Execution result;
+    // Static: a terminal does not fit on the loop task's stack next to its planes.
+    static cTerminal terminal;
+    cGate_UniversalInfo gate;
+    cPacketBuilder builder;
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    int planeSize = 0;
+    unsigned long long deviceID = 0;
+    unsigned char deviceType = 0;
+    std::string deviceName;
+    std::string revision;
+
+    #pragma region Segments
+    TestStart("Terminal - Cut-through segments");
+    TestStepDone();
+    if(terminal.SetCutThroughGate(11, nullptr, &UT_TERMINAL_CountSegment, &UT_TERMINAL_CountLanding) != Execution::Incompatibility)
+    {
+        TestFailed("A gate was set for an unsupported ID.");
+        return Execution::Failed;
+    }
+    terminal.SetCutThroughGate(21, nullptr, &UT_TERMINAL_CountSegment, &UT_TERMINAL_CountLanding);
+
+    // Segment 1 is complete once the next Div lands, segment 2 once the Check lands.
+    TestStepDone();
+    for(int i=0; i<4; ++i)
+    {
+        terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[i]);
+    }
+    if(UT_TERMINAL_SEGMENTS != 1 || UT_TERMINAL_LANDED != -1)
+    {
+        TestFailed("Segment 1 was not given when it was complete.");
+        TestExpectedVSGotten("1", std::to_string(UT_TERMINAL_SEGMENTS).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    for(int i=4; i<UT_TERMINAL_PLANE_SIZE; ++i)
+    {
+        result = terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[i]);
+    }
+    if(result != Execution::Passed || UT_TERMINAL_SEGMENTS != 2 || UT_TERMINAL_LANDED != 1)
+    {
+        TestFailed("The plane did not land through its gate.");
+        TestExpectedVSGotten("2", std::to_string(UT_TERMINAL_SEGMENTS).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    UT_TERMINAL_SEGMENTS = 0;
+    for(int i=0; i<UT_TERMINAL_PLANE_SIZE-1; ++i)
+    {
+        terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[i]);
+    }
+    terminal._HandlePlaneArrival(ChunkType::Check + 34);
+    if(UT_TERMINAL_SEGMENTS != 2 || UT_TERMINAL_LANDED != 0)
+    {
+        TestFailed("The gate was not told the plane dropped.");
+        return Execution::Failed;
+    }
+
+    // A gate refusing a segment drops the plane right away. Counting from 1 makes it refuse segment 1.
+    TestStepDone();
+    UT_TERMINAL_SEGMENTS = 1;
+    for(int i=0; i<4; ++i)
+    {
+        result = terminal._HandlePlaneArrival(UT_TERMINAL_PLANE[i]);
+    }
+    if(result != Execution::Failed || terminal.receivingPacket)
+    {
+        TestFailed("A refused segment did not drop the plane.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    #pragma region UniversalInfo
+    TestStart("Terminal - Cut-through UniversalInfo");
+    unsigned char idBytes[8] = {121, 49, 64, 0, 0, 0, 0, 0};
+    unsigned char bfioBytes[8] = {1, 0, 0, 0, 0, 0, 0, 0};
+    unsigned char typeByte = 0;
+    unsigned char statusByte = 1;
+    builder.Begin(UNIVERSALINFO_PLANE_ID, plane, MAX_PLANE_PASSENGER_CAPACITY);
+    builder.AddSegment(idBytes, 8);
+    builder.AddSegment(bfioBytes, 8);
+    builder.AddSegment(&typeByte, 1);
+    builder.AddSegment(&statusByte, 1);
+    builder.AddSegment((unsigned char*)"https://github.com/LyamBRS/BrSpand_GamePad.git", 46);
+    builder.AddSegment((unsigned char*)"GamePad", 7);
+    builder.AddSegment((unsigned char*)"Rev A", 5);
+    builder.Finish(&planeSize);
+
+    TestStepDone();
+    gate.DockCutThrough(&terminal);
+    for(int i=0; i<planeSize-1; ++i)
+    {
+        terminal._HandlePlaneArrival(plane[i]);
+    }
+    if(gate.ReadInfo(&deviceID, &deviceType, &deviceName, &revision) != Execution::Bypassed)
+    {
+        TestFailed("Passengers were committed before the check.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    result = terminal._HandlePlaneArrival(plane[planeSize-1]);
+    if(result != Execution::Passed || gate.ReadInfo(&deviceID, &deviceType, &deviceName, &revision) != Execution::Passed)
+    {
+        TestFailed("Passengers were not committed with the check.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(deviceID != 4206969 || deviceName != "GamePad" || revision != "Rev A")
+    {
+        TestFailed("Wrong passengers committed.");
+        TestExpectedVSGotten("4206969 GamePad Rev A", (std::to_string(deviceID) + " " + deviceName + " " + revision).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    plane[planeSize-1]++;
+    for(int i=0; i<planeSize; ++i)
+    {
+        terminal._HandlePlaneArrival(plane[i]);
+    }
+    if(gate.ReadInfo(&deviceID, &deviceType, &deviceName, &revision) != Execution::Bypassed)
+    {
+        TestFailed("Passengers of a dropped plane were committed.");
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if the departure
+ * taxiway keeps the order of each lane,
+ * lets priority planes go first, refuses
+ * duplicates and counts taxiing times.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Taxiway()
+{
+    Execution result;
+    // Static: a terminal does not fit on the loop task's stack next to its planes.
+    static cTerminal terminal;
+    unsigned char planeID = 0;
+    int depth = 0;
+    // UniversalInfo and ErrorMessage are bulk, the others are not.
+    unsigned char queued[5] = {7, 21, 3, 0, 26};
+    unsigned char expected[5] = {21, 0, 26, 7, 3};
+
+    #pragma region Lanes
+    TestStart("Terminal - Taxiway lanes");
+    TestStepDone();
+    if(terminal.PutPlaneOnTaxiway(21) != Execution::Failed)
+    {
+        TestFailed("A plane taxied while departures are not available.");
+        return Execution::Failed;
+    }
+    terminal.departureStatus = TerminalStatus::DepartureAvailable;
+
+    TestStepDone();
+    for(int i=0; i<5; ++i)
+    {
+        result = terminal.PutPlaneOnTaxiway(queued[i]);
+        if(result != Execution::Passed)
+        {
+            TestFailed("A plane could not taxi.");
+            TestExecution(result);
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    terminal.GetTaxiwayDepth(TaxiwayLane::Bulk, &depth);
+    if(depth != 2 || terminal.PutPlaneOnTaxiway(21) != Execution::Unecessary || terminal.IsPlaneOnDepartureTaxiway(26) != Execution::Passed)
+    {
+        TestFailed("Planes are not tracked on the taxiway.");
+        TestExpectedVSGotten("2", std::to_string(depth).c_str());
+        return Execution::Failed;
+    }
+
+    delay(2);
+    for(int i=0; i<5; ++i)
+    {
+        TestStepDone();
+        terminal.GetNextDepartingPlaneID(&planeID);
+        if(planeID != expected[i])
+        {
+            TestFailed("Planes left in the wrong order.");
+            TestExpectedVSGotten(std::to_string(expected[i]).c_str(), std::to_string(planeID).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    if(terminal.GetNextDepartingPlaneID(&planeID) != Execution::Unecessary || terminal.IsPlaneOnDepartureTaxiway(26) != Execution::Failed)
+    {
+        TestFailed("The taxiway is not empty.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(terminal.departedPlanes != 5 || terminal.mostPlanesTaxiing != 5 || terminal.longestTaxiTime < 2000 || terminal.totalTaxiTime < 5*2000)
+    {
+        TestFailed("Wrong taxiway counters.");
+        TestExpectedVSGotten(">= 2000", std::to_string(terminal.longestTaxiTime).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    #pragma region Full
+    TestStart("Terminal - Taxiway full");
+    // The priority lane no longer starts at 0, so filling it wraps around the ring buffer.
+    for(int i=0; i<SIZE_OF_DEPARTURE_TAXIWAY; ++i)
+    {
+        TestStepDone();
+        if(terminal.PutPlaneOnTaxiway(100 + i) != Execution::Passed)
+        {
+            TestFailed("The taxiway filled up too soon.");
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    if(terminal.PutPlaneOnTaxiway(99) != Execution::Bypassed || terminal.departureStatus != TerminalStatus::DepartureAvailable || terminal.CanPlaneTaxi(10, 99) != Execution::Failed)
+    {
+        TestFailed("A full lane took another plane.");
+        return Execution::Failed;
+    }
+
+    // Only the priority lane is full. Bulk planes still taxi, behind it.
+    TestStepDone();
+    if(terminal.CanPlaneTaxi(10, 7) != Execution::Passed || terminal.PutPlaneOnTaxiway(7) != Execution::Passed)
+    {
+        TestFailed("A full priority lane blocked the bulk lane.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    terminal.GetNextDepartingPlaneID(&planeID);
+    if(planeID != 100 || terminal.PutPlaneOnTaxiway(99) != Execution::Passed)
+    {
+        TestFailed("The taxiway did not free up.");
+        TestExpectedVSGotten("100", std::to_string(planeID).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    for(int i=1; i<SIZE_OF_DEPARTURE_TAXIWAY; ++i)
+    {
+        terminal.GetNextDepartingPlaneID(&planeID);
+    }
+    terminal.GetNextDepartingPlaneID(&planeID);
+    if(planeID != 99)
+    {
+        TestFailed("The ring buffer did not wrap around.");
+        TestExpectedVSGotten("99", std::to_string(planeID).c_str());
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    terminal.GetNextDepartingPlaneID(&planeID);
+    if(planeID != 7 || terminal.GetNextDepartingPlaneID(&planeID) != Execution::Unecessary)
+    {
+        TestFailed("The bulk plane did not leave after the priority lane.");
+        TestExpectedVSGotten("7", std::to_string(planeID).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+    #pragma endregion
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Stream that keeps what is written to
+ * it and has a TX FIFO of whatever size the
+ * test sets in room.
+ */
+class cUnitTestStream : public Stream
+{
+    public:
+        unsigned char written[SIZE_OF_DEPARTURE_RUNWAY];
+        int writtenSize = 0;
+        int room = 0;
+        int writeCalls = 0;
+
+        unsigned char received[2*SIZE_OF_ARRIVAL_RUNWAY];
+        int receivedSize = 0;
+        int readIndex = 0;
+
+        int available() { return receivedSize - readIndex; }
+        int read() { return (readIndex < receivedSize) ? received[readIndex++] : -1; }
+        int peek() { return (readIndex < receivedSize) ? received[readIndex] : -1; }
+        int availableForWrite() { return room; }
+        size_t write(uint8_t value) { return write(&value, 1); }
+        size_t write(const uint8_t* buffer, size_t size)
+        {
+            if((int)size > room)
+            {
+                size = room;
+            }
+            memcpy(&written[writtenSize], buffer, size);
+            writtenSize += size;
+            room -= size;
+            writeCalls++;
+            return size;
+        }
+};
+
+/**
+ * @brief Function that returns
+ * execution::passed if cDepartureRunway
+ * sends whole planes in every wire mode
+ * without writing more than the stream's
+ * TX FIFO accepts.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_DepartureRunway()
+{
+    Execution result;
+    // Static: with the stream and the runway, a terminal is more than the loop task's stack.
+    static cUnitTestStream stream;
+    static cDepartureRunway runway(&stream);
+    static cTerminal terminal;
+    unsigned short landed[UT_TERMINAL_PLANE_SIZE];
+    WireMode modes[3] = {WireMode::Unpacked, WireMode::Packed, WireMode::Protected};
+
+    TestStart("Terminal - Departure runway");
+    TestStepDone();
+    if(runway._Handle() != Execution::Unecessary)
+    {
+        TestFailed("An empty runway sent something.");
+        return Execution::Failed;
+    }
+
+    for(int mode=0; mode<3; ++mode)
+    {
+        TestStepDone();
+        stream.writtenSize = 0;
+        stream.writeCalls = 0;
+        runway.wireMode = modes[mode];
+        runway.SetPlaneForTakeOff(UT_TERMINAL_PLANE, UT_TERMINAL_PLANE_SIZE);
+        if(runway.SetPlaneForTakeOff(UT_TERMINAL_PLANE, UT_TERMINAL_PLANE_SIZE) != Execution::Bypassed)
+        {
+            TestFailed("A plane took the runway of another one.");
+            return Execution::Failed;
+        }
+
+        // A full FIFO stalls, then 3 bytes fit per loop.
+        TestStepDone();
+        if(runway._Handle() != Execution::Bypassed || runway.stalls != (unsigned long)mode + 1 || stream.writtenSize != 0)
+        {
+            TestFailed("A full FIFO did not stall the runway.");
+            return Execution::Failed;
+        }
+
+        TestStepDone();
+        do
+        {
+            stream.room = 3;
+            result = runway._Handle();
+        } while(result == Execution::Bypassed);
+        if(result != Execution::Passed || stream.writeCalls != (stream.writtenSize + 2) / 3)
+        {
+            TestFailed("The plane was not written in FIFO sized blocks.");
+            TestExecution(result);
+            return Execution::Failed;
+        }
+        stream.room = 0;
+
+        TestStepDone();
+        for(int i=0; i<stream.writtenSize; ++i)
+        {
+            terminal._HandleUARTArrival(stream.written[i]);
+        }
+        terminal.GetLastArrival(landed, UT_TERMINAL_PLANE_SIZE);
+        if(terminal.arrivalWireMode != modes[mode] || memcmp(landed, UT_TERMINAL_PLANE, sizeof(landed)) != 0)
+        {
+            TestFailed("The plane sent is not the plane that landed.");
+            TestExpectedVSGotten(std::to_string(modes[mode]).c_str(), std::to_string(terminal.arrivalWireMode).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    if(runway.planesSent != 3 || runway.bytesSent != 2*UT_TERMINAL_PLANE_SIZE*2 + PACKED_UART_SIZE(UT_TERMINAL_PLANE_SIZE))
+    {
+        TestFailed("Wrong runway counters.");
+        TestExpectedVSGotten(std::to_string(2*UT_TERMINAL_PLANE_SIZE*2 + PACKED_UART_SIZE(UT_TERMINAL_PLANE_SIZE)).c_str(), std::to_string(runway.bytesSent).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if cArrivalRunway
+ * hands every received byte to the
+ * terminal in order, even when its ring
+ * wraps, stalls or overflows.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_ArrivalRunway()
+{
+    Execution result;
+    // Static: with the stream and the runway, a terminal is more than the loop task's stack.
+    static cUnitTestStream stream;
+    static cArrivalRunway runway(&stream);
+    static cTerminal terminal;
+    unsigned short landed[UT_TERMINAL_PLANE_SIZE];
+    unsigned char uartPlane[2*UT_TERMINAL_PLANE_SIZE];
+    const int planeCount = 20;
+
+    for(int i=0; i<UT_TERMINAL_PLANE_SIZE; ++i)
+    {
+        uartPlane[2*i]   = UT_TERMINAL_PLANE[i] >> 8;
+        uartPlane[2*i+1] = UT_TERMINAL_PLANE[i] & 0xFF;
+    }
+
+    TestStart("Terminal - Arrival runway");
+    TestStepDone();
+    if(runway._HandleReception() != Execution::Unecessary || runway.DrainInto(&terminal) != Execution::Unecessary)
+    {
+        TestFailed("An empty runway had bytes.");
+        return Execution::Failed;
+    }
+
+    // More planes than the ring can hold. The rest must wait in the stream.
+    TestStepDone();
+    for(int i=0; i<planeCount; ++i)
+    {
+        memcpy(&stream.received[stream.receivedSize], uartPlane, sizeof(uartPlane));
+        stream.receivedSize += sizeof(uartPlane);
+    }
+    result = runway._HandleReception();
+    if(result != Execution::Passed || runway.GetWaitingBytes() != SIZE_OF_ARRIVAL_RUNWAY || runway.stalls.load() != 1)
+    {
+        TestFailed("The stream did not fill the runway.");
+        TestExpectedVSGotten(std::to_string(SIZE_OF_ARRIVAL_RUNWAY).c_str(), std::to_string(runway.GetWaitingBytes()).c_str());
+        return Execution::Failed;
+    }
+
+    for(int i=0; i<planeCount; ++i)
+    {
+        TestStepDone();
+        runway._HandleReception();
+        result = runway.DrainInto(&terminal);
+        terminal.GetLastArrival(landed, UT_TERMINAL_PLANE_SIZE);
+        terminal.packetAvailable = false;
+        if(result != Execution::Passed || memcmp(landed, UT_TERMINAL_PLANE, sizeof(landed)) != 0)
+        {
+            TestFailed("A plane did not land from the runway.");
+            TestExpectedVSGotten(std::to_string(i).c_str(), std::to_string(runway.drainedBytes).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    TestStepDone();
+    if(runway.GetWaitingBytes() != 0 || stream.available() != 0 || runway.drainedBytes != planeCount*sizeof(uartPlane))
+    {
+        TestFailed("Bytes were left behind.");
+        return Execution::Failed;
+    }
+
+    // Land has nowhere to leave extra bytes, they are dropped.
+    TestStepDone();
+    int landedBytes = 0;
+    for(int i=0; i<planeCount; ++i)
+    {
+        landedBytes += runway.Land(uartPlane, sizeof(uartPlane));
+    }
+    if(landedBytes != SIZE_OF_ARRIVAL_RUNWAY || runway.droppedBytes.load() != planeCount*sizeof(uartPlane) - SIZE_OF_ARRIVAL_RUNWAY)
+    {
+        TestFailed("A full runway did not drop the extra bytes.");
+        TestExpectedVSGotten(std::to_string(SIZE_OF_ARRIVAL_RUNWAY).c_str(), std::to_string(landedBytes).c_str());
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if landed planes
+ * are routed to the gate docked for
+ * their ID, and if unsupported IDs are
+ * answered with a HandlingError plane
+ * without touching any gate.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Dispatch()
+{
+    Execution result;
+    // Static: 2 terminals, their gate tables, the stream and the runway do not fit on the loop task's stack.
+    static cTerminal master;
+    static cTerminal slave;
+    cGate_Status gate;
+    static cUnitTestStream stream;
+    static cDepartureRunway runway(&stream, &master);
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    unsigned short unsupportedPlane[4] = {ChunkType::Start + 11, ChunkType::Div, ChunkType::Byte + 1, ChunkType::Check + 12};
+    unsigned char planeID = 0;
+    unsigned char unhandledID = 0;
+    int value = 0;
+    int planeSize = 0;
+    cPlaneIndex planeIndex;
+
+    TestStart("Terminal - Dispatch");
+    TestStepDone();
+    if(DockGate(&master, &slave, &gate) != Execution::Passed || master.SetDockingGate(11, &gate, nullptr, nullptr) != Execution::Incompatibility)
+    {
+        TestFailed("The gate could not be docked.");
+        return Execution::Failed;
+    }
+    master.departureStatus = TerminalStatus::DepartureAvailable;
+
+    // An answer lands on the master terminal.
+    TestStepDone();
+    cPlane_Status::Encode(plane, 42);
+    for(int i=0; i<cPlane_Status::size; ++i)
+    {
+        result = master._HandlePlaneArrival(plane[i]);
+    }
+    if(result != Execution::Passed || master.packetAvailable || master.dockedPlanes != 1 || gate.Read(&value) != Execution::Passed || value != 42)
+    {
+        TestFailed("The answer did not dock at its gate.");
+        TestExpectedVSGotten("42", std::to_string(value).c_str());
+        return Execution::Failed;
+    }
+
+    // A request lands on the slave terminal.
+    TestStepDone();
+    cPlane_Status::Encode(plane, 7);
+    for(int i=0; i<cPlane_Status::size; ++i)
+    {
+        slave._HandlePlaneArrival(plane[i]);
+    }
+    if(slave.dockedPlanes != 1 || gate.Read(&value) != Execution::Passed || value != 7)
+    {
+        TestFailed("The request did not dock at its gate.");
+        TestExpectedVSGotten("7", std::to_string(value).c_str());
+        return Execution::Failed;
+    }
+
+    // Supported but without a gate, the plane is left to the application.
+    TestStepDone();
+    for(int i=0; i<UT_TERMINAL_PLANE_SIZE; ++i)
+    {
+        result = master._HandlePlaneArrival(UT_TERMINAL_PLANE[i]);
+    }
+    if(result != Execution::Passed || !master.packetAvailable || master.dockedPlanes != 1)
+    {
+        TestFailed("A plane without gate was not left available.");
+        return Execution::Failed;
+    }
+    master.packetAvailable = false;
+
+    TestStepDone();
+    for(int i=0; i<4; ++i)
+    {
+        result = master._HandlePlaneArrival(unsupportedPlane[i]);
+    }
+    if(result != Execution::Incompatibility || master.unhandledPlanes != 1 || master.dockedPlanes != 1 || gate.Read(&value) != Execution::Bypassed)
+    {
+        TestFailed("The unsupported plane was not refused.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    if(master.GetNextDepartingPlaneID(&planeID) != Execution::Passed || planeID != HANDLINGERROR_PLANE_ID)
+    {
+        TestFailed("No HandlingError plane taxied.");
+        TestExpectedVSGotten(std::to_string(HANDLINGERROR_PLANE_ID).c_str(), std::to_string(planeID).c_str());
+        return Execution::Failed;
+    }
+
+    // The runway builds it by ID, the slave terminal lands it.
+    TestStepDone();
+    stream.writtenSize = 0;
+    stream.room = SIZE_OF_DEPARTURE_RUNWAY;
+    if(runway.SetPlaneForTakeOff(planeID) != Execution::Passed || runway._Handle() != Execution::Passed)
+    {
+        TestFailed("The HandlingError plane did not take off.");
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    for(int i=0; i<stream.writtenSize; ++i)
+    {
+        slave._HandleUARTArrival(stream.written[i]);
+    }
+    slave.GetLastArrival(plane, MAX_PLANE_PASSENGER_CAPACITY);
+    if(cPlane_HandlingError::Decode(plane, cPlane_HandlingError::size, &unhandledID) != Execution::Passed || unhandledID != 11)
+    {
+        TestFailed("The HandlingError plane does not carry the unsupported ID.");
+        TestExpectedVSGotten("11", std::to_string(unhandledID).c_str());
+        return Execution::Failed;
+    }
+
+    // Once CRC-8 was negotiated, departing planes carry it too.
+    TestStepDone();
+    master.planeCheck = PlaneCheck::CRC8;
+    gate.status = GateStatus::JustLeft;
+    result = master.BoardPlane(STATUS_PLANE_ID, plane, &planeSize);
+    master.planeCheck = PlaneCheck::AdditiveSum;
+    if(result != Execution::Passed || Packet.IndexPlane(plane, planeSize, &planeIndex, PlaneCheck::CRC8) != Execution::Passed)
+    {
+        TestFailed("A departing plane is not checked with the CRC-8.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    // And gates still decode the planes that land checked with it.
+    TestStepDone();
+    slave.planeCheck = PlaneCheck::CRC8;
+    cPlane_Status::Encode(plane, 9);
+    cTerminal::SealPlane(plane, cPlane_Status::size, PlaneCheck::CRC8);
+    for(int i=0; i<cPlane_Status::size; ++i)
+    {
+        result = slave._HandlePlaneArrival(plane[i]);
+    }
+    slave.planeCheck = PlaneCheck::AdditiveSum;
+    if(result != Execution::Passed || gate.Read(&value) != Execution::Passed || value != 9)
+    {
+        TestFailed("A CRC-8 checked plane did not dock at its gate.");
+        TestExpectedVSGotten("9", std::to_string(value).c_str());
+        return Execution::Failed;
+    }
+
+    // The gate dies with this test, the terminals outlive it.
+    master.SetDockingGate(STATUS_PLANE_ID, nullptr, nullptr, nullptr);
+    slave.SetDockingGate(STATUS_PLANE_ID, nullptr, nullptr, nullptr);
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if every handshake
+ * that passes its check sets the plane
+ * check it asks for, back and forth, if
+ * a handshake checked with the other check
+ * changes nothing and if Reset forgets
+ * what was negotiated.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Handshake()
+{
+    Execution result;
+    // Static: a terminal does not fit on the loop task's stack next to its planes.
+    static cTerminal terminal;
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    unsigned short legacyHandshake[2] = {ChunkType::Start + HANDSHAKE_PLANE_ID, ChunkType::Check + HANDSHAKE_PLANE_ID};
+    unsigned char crc = 0;
+
+    TestStart("Terminal - Handshake");
+    TestStepDone();
+    cPlane_Handshake::Encode(plane, HANDSHAKE_CRC8);
+    cTerminal::SealPlane(plane, cPlane_Handshake::size, PlaneCheck::CRC8);
+    for(int i=0; i<cPlane_Handshake::size; ++i)
+    {
+        result = terminal._HandlePlaneArrival(plane[i]);
+    }
+    terminal.packetAvailable = false;
+    if(result != Execution::Passed || terminal.planeCheck != PlaneCheck::CRC8)
+    {
+        TestFailed("A CRC-8 handshake did not switch to the CRC-8.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    // Asking for nothing goes back to the additive sum.
+    TestStepDone();
+    cPlane_Handshake::Encode(plane, 0);
+    for(int i=0; i<cPlane_Handshake::size; ++i)
+    {
+        result = terminal._HandlePlaneArrival(plane[i]);
+    }
+    terminal.packetAvailable = false;
+    if(result != Execution::Passed || terminal.planeCheck != PlaneCheck::AdditiveSum)
+    {
+        TestFailed("A summed handshake did not go back to the sum.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    // A summed handshake whose Check chunk got corrupted into its CRC-8 is dropped, not read as a switch.
+    TestStepDone();
+    cPlane_Handshake::Encode(plane, 0);
+    Packet.GetCRC8(plane, cPlane_Handshake::size - 1, &crc);
+    if(crc == (unsigned char)plane[cPlane_Handshake::size - 1])
+    {
+        TestFailed("The test plane's CRC-8 is its sum.");
+        return Execution::Failed;
+    }
+    plane[cPlane_Handshake::size - 1] = ChunkType::Check + crc;
+    for(int i=0; i<cPlane_Handshake::size; ++i)
+    {
+        result = terminal._HandlePlaneArrival(plane[i]);
+    }
+    if(result != Execution::Failed || terminal.planeCheck != PlaneCheck::AdditiveSum || terminal.packetAvailable)
+    {
+        TestFailed("A corrupted handshake switched the check.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    // Nor does a CRC-8 handshake that arrived summed.
+    TestStepDone();
+    cPlane_Handshake::Encode(plane, HANDSHAKE_CRC8);
+    for(int i=0; i<cPlane_Handshake::size; ++i)
+    {
+        result = terminal._HandlePlaneArrival(plane[i]);
+    }
+    if(result != Execution::Failed || terminal.planeCheck != PlaneCheck::AdditiveSum)
+    {
+        TestFailed("A summed CRC-8 handshake switched the check.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    // A rejecting terminal does not renegotiate.
+    TestStepDone();
+    terminal.planeCheck = PlaneCheck::CRC8;
+    terminal.SetMode(1);
+    cPlane_Handshake::Encode(plane, 0);
+    cTerminal::SealPlane(plane, cPlane_Handshake::size, PlaneCheck::CRC8);
+    for(int i=0; i<cPlane_Handshake::size; ++i)
+    {
+        result = terminal._HandlePlaneArrival(plane[i]);
+    }
+    terminal.SetMode(0);
+    if(result != Execution::Bypassed || terminal.planeCheck != PlaneCheck::CRC8)
+    {
+        TestFailed("A rejecting terminal renegotiated.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    // Handshakes without flags ask for the defaults.
+    TestStepDone();
+    terminal.planeCheck = PlaneCheck::CRC8;
+    for(int i=0; i<2; ++i)
+    {
+        result = terminal._HandlePlaneArrival(legacyHandshake[i]);
+    }
+    terminal.packetAvailable = false;
+    if(result != Execution::Passed || terminal.planeCheck != PlaneCheck::AdditiveSum)
+    {
+        TestFailed("A handshake without flags did not go back to the sum.");
+        TestExecution(result);
+        return Execution::Failed;
+    }
+
+    TestStepDone();
+    terminal.planeCheck = PlaneCheck::CRC8;
+    terminal.sequenceTags = true;
+    terminal.Reset();
+    if(terminal.planeCheck != PlaneCheck::AdditiveSum || terminal.sequenceTags)
+    {
+        TestFailed("Reset kept what was negotiated.");
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if a handshake asked
+ * for by one terminal is answered by the
+ * other, untagged, and leaves both on the
+ * flags they both support.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_HandshakeExchange()
+{
+    Execution result = Execution::Passed;
+    // Static: 2 terminals do not fit on the loop task's stack.
+    static cTerminal master;
+    static cTerminal slave;
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    unsigned char planeID = 0;
+    unsigned char flags = 0;
+    int planeSize = 0;
+    cPlaneIndex planeIndex;
+    const unsigned char asked[2] = {HANDSHAKE_SEQUENCE_TAGS, HANDSHAKE_CRC8 | HANDSHAKE_SEQUENCE_TAGS};
+    const unsigned char supported[2] = {HANDSHAKE_CRC8 | HANDSHAKE_SEQUENCE_TAGS, HANDSHAKE_CRC8};
+
+    TestStart("Terminal - Handshake exchange");
+    master.departureStatus = TerminalStatus::DepartureAvailable;
+    slave.departureStatus = TerminalStatus::DepartureAvailable;
+
+    // Once with everything supported, once with a slave that does not know sequence tags.
+    for(int exchange = 0; exchange < 2; ++exchange)
+    {
+        unsigned char agreed = asked[exchange] & supported[exchange];
+        slave.supportedHandshakeFlags = supported[exchange];
+
+        TestStepDone();
+        if(master.Handshake(asked[exchange]) != Execution::Passed || master.GetNextDepartingPlaneID(&planeID) != Execution::Passed
+           || planeID != HANDSHAKE_PLANE_ID || master.BoardPlane(planeID, plane, &planeSize) != Execution::Passed)
+        {
+            TestFailed("The handshake did not board.");
+            return Execution::Failed;
+        }
+
+        // The slave takes what both support and answers with it.
+        TestStepDone();
+        for(int i=0; i<planeSize; ++i)
+        {
+            result = slave._HandlePlaneArrival(plane[i]);
+        }
+        slave.packetAvailable = false;
+        if(result != Execution::Passed || slave.sequenceTags != ((agreed & HANDSHAKE_SEQUENCE_TAGS) != 0)
+           || slave.GetNextDepartingPlaneID(&planeID) != Execution::Passed || planeID != HANDSHAKE_PLANE_ID)
+        {
+            TestFailed("The slave did not answer the handshake.");
+            TestExecution(result);
+            return Execution::Failed;
+        }
+
+        // Its flags are its only Byte chunk, right before the Check chunk.
+        TestStepDone();
+        if(slave.BoardPlane(planeID, plane, &planeSize) != Execution::Passed || planeSize != cPlane_Handshake::size
+           || Packet.IndexPlane(plane, planeSize, &planeIndex, (agreed & HANDSHAKE_CRC8) ? PlaneCheck::CRC8 : PlaneCheck::AdditiveSum) != Execution::Passed)
+        {
+            TestFailed("The answer is tagged or not checked with what it asks for.");
+            TestExpectedVSGotten(std::to_string(cPlane_Handshake::size).c_str(), std::to_string(planeSize).c_str());
+            return Execution::Failed;
+        }
+        flags = (unsigned char)plane[planeSize - 2];
+
+        // The answer lands on the master, which takes the same flags and does not answer back.
+        TestStepDone();
+        for(int i=0; i<planeSize; ++i)
+        {
+            result = master._HandlePlaneArrival(plane[i]);
+        }
+        master.packetAvailable = false;
+        if(result != Execution::Passed || flags != agreed || master.sequenceTags != slave.sequenceTags
+           || master.planeCheck != slave.planeCheck || master.GetNextDepartingPlaneID(&planeID) != Execution::Unecessary)
+        {
+            TestFailed("The master did not take the agreed flags.");
+            TestExpectedVSGotten(std::to_string(agreed).c_str(), std::to_string(flags).c_str());
+            return Execution::Failed;
+        }
+    }
+
+    if(master.planeCheck != PlaneCheck::CRC8 || master.sequenceTags)
+    {
+        TestFailed("The flags the slave does not support were taken.");
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if tagged requests
+ * of one gate can be in flight together,
+ * if the docked gate answers each with
+ * its request's tag, if those answers are
+ * matched by tag in any order and if
+ * untagged or stray answers are refused.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_SequenceTags()
+{
+    Execution result = Execution::Passed;
+    // Gates taxi their answers on the global terminals, the test has to use them.
+    cTerminal& master = MasterTerminal;
+    cTerminal& slave = SlaveTerminal;
+    TerminalStatus masterStatus = master.departureStatus;
+    TerminalStatus slaveStatus = slave.departureStatus;
+    cGate_Status gate;
+    unsigned short requests[2][MAX_PLANE_PASSENGER_CAPACITY];
+    int requestSizes[2] = {0, 0};
+    unsigned short answers[2][MAX_PLANE_PASSENGER_CAPACITY];
+    int answerSizes[2] = {0, 0};
+    unsigned char tags[2] = {0, 0};
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    int planeSize = 0;
+    unsigned char planeID = 0;
+    unsigned char tag = 0;
+    unsigned char crc = 0;
+    int value = 0;
+    cPlaneIndex planeIndex;
+
+    TestStart("Terminal - Sequence tags");
+    TestStepDone();
+    master.sequenceTags = true;
+    slave.sequenceTags = true;
+    master.departureStatus = TerminalStatus::DepartureAvailable;
+    slave.departureStatus = TerminalStatus::DepartureAvailable;
+    if(DockGate(&master, &slave, &gate) != Execution::Passed)
+    {
+        TestFailed("The gate could not be docked.");
+        result = Execution::Failed;
+    }
+
+    // 2 requests of the same gate leave one after the other.
+    for(int request = 0; request < 2 && result == Execution::Passed; request++)
+    {
+        TestStepDone();
+        gate.status = GateStatus::JustLeft;
+        if(master.BoardPlane(STATUS_PLANE_ID, requests[request], &requestSizes[request]) != Execution::Passed)
+        {
+            TestFailed("A request did not board.");
+            result = Execution::Failed;
+        }
+    }
+    if(result == Execution::Passed && (gate.GetRequestsInFlight() != 2 || requestSizes[1] != cPlane_Status::size + 2))
+    {
+        TestFailed("The requests are not both in flight.");
+        TestExpectedVSGotten("2", std::to_string(gate.GetRequestsInFlight()).c_str());
+        result = Execution::Failed;
+    }
+
+    // The other side answers them in the opposite order, through the docked gate.
+    for(int request = 1; request >= 0 && result == Execution::Passed; request--)
+    {
+        TestStepDone();
+        for(int i=0; i<requestSizes[request]; ++i)
+        {
+            slave._HandlePlaneArrival(requests[request][i]);
+        }
+        if(slave.GetLastSequenceTag(&tags[request]) != Execution::Passed || slave.GetNextDepartingPlaneID(&planeID) != Execution::Passed || planeID != STATUS_PLANE_ID)
+        {
+            TestFailed("The tagged request did not get an answer taxiing.");
+            TestExpectedVSGotten(std::to_string(STATUS_PLANE_ID).c_str(), std::to_string(planeID).c_str());
+            result = Execution::Failed;
+            break;
+        }
+
+        TestStepDone();
+        if(slave.BoardPlane(planeID, answers[request], &answerSizes[request]) != Execution::Passed || answerSizes[request] != cPlane_Status::size + 2)
+        {
+            TestFailed("The answer did not board tagged.");
+            TestExpectedVSGotten(std::to_string(cPlane_Status::size + 2).c_str(), std::to_string(answerSizes[request]).c_str());
+            result = Execution::Failed;
+            break;
+        }
+        tag = (unsigned char)(answers[request][answerSizes[request] - 2] - ChunkType::Byte);
+        if(tag != tags[request])
+        {
+            TestFailed("The answer does not echo its request's tag.");
+            TestExpectedVSGotten(std::to_string(tags[request]).c_str(), std::to_string(tag).c_str());
+            result = Execution::Failed;
+        }
+    }
+    if(result == Execution::Passed && tags[1] != (unsigned char)(tags[0] + 1))
+    {
+        TestFailed("The requests did not carry consecutive tags.");
+        result = Execution::Failed;
+    }
+
+    // Landing back to back, the second request waits for the first answer to board, then gets its own.
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        for(int request = 0; request < 2; request++)
+        {
+            for(int i=0; i<requestSizes[request]; ++i)
+            {
+                slave._HandlePlaneArrival(requests[request][i]);
+            }
+        }
+    }
+    for(int answer = 0; answer < 2 && result == Execution::Passed; answer++)
+    {
+        TestStepDone();
+        if(slave.GetNextDepartingPlaneID(&planeID) != Execution::Passed || planeID != STATUS_PLANE_ID
+           || slave.BoardPlane(planeID, plane, &planeSize) != Execution::Passed || plane[planeSize - 2] != ChunkType::Byte + tags[answer])
+        {
+            TestFailed("A request landing back to back was not answered with its tag.");
+            TestExpectedVSGotten(std::to_string(tags[answer]).c_str(), std::to_string((unsigned char)plane[planeSize - 2]).c_str());
+            result = Execution::Failed;
+        }
+    }
+    if(result == Execution::Passed && slave.GetNextDepartingPlaneID(&planeID) != Execution::Unecessary)
+    {
+        TestFailed("More answers than requests taxied.");
+        result = Execution::Failed;
+    }
+
+    // Answers come back out of order, each matches its own request.
+    for(int answer = 1; answer >= 0 && result == Execution::Passed; answer--)
+    {
+        TestStepDone();
+        for(int i=0; i<answerSizes[answer]; ++i)
+        {
+            master._HandlePlaneArrival(answers[answer][i]);
+        }
+        if(gate.Read(&value) != Execution::Passed || master.GetLastSequenceTag(&tag) != Execution::Passed || tag != tags[answer] || gate.GetRequestsInFlight() != answer)
+        {
+            TestFailed("An answer did not match its request.");
+            TestExpectedVSGotten(std::to_string(answer).c_str(), std::to_string(gate.GetRequestsInFlight()).c_str());
+            result = Execution::Failed;
+        }
+    }
+
+    // Nothing is in flight anymore: any tagged answer is a stray.
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        for(int i=0; i<answerSizes[0]; ++i)
+        {
+            master._HandlePlaneArrival(answers[0][i]);
+        }
+        if(gate.Read(&value) != Execution::Bypassed)
+        {
+            TestFailed("A stray answer docked.");
+            result = Execution::Failed;
+        }
+    }
+
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        cPlane_Status::Encode(plane, 3);
+        for(int i=0; i<cPlane_Status::size; ++i)
+        {
+            result = master._HandlePlaneArrival(plane[i]);
+        }
+        if(result != Execution::Failed || gate.Read(&value) != Execution::Bypassed)
+        {
+            TestFailed("An untagged answer landed.");
+            TestExecution(result);
+            result = Execution::Failed;
+        }
+        else
+        {
+            result = Execution::Passed;
+        }
+    }
+
+    // A rejecting terminal does not look for the tag, it bypasses the plane like any other.
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        slave.SetMode(1);
+        for(int i=0; i<requestSizes[0]; ++i)
+        {
+            result = slave._HandlePlaneArrival(requests[0][i]);
+        }
+        slave.SetMode(0);
+        if(result != Execution::Bypassed || slave.GetLastSequenceTag(&tag) != Execution::Unecessary || slave.GetNextDepartingPlaneID(&planeID) != Execution::Unecessary)
+        {
+            TestFailed("A rejecting terminal did not bypass a tagged plane.");
+            TestExecution(result);
+            result = Execution::Failed;
+        }
+        else
+        {
+            result = Execution::Passed;
+        }
+    }
+
+    // Tags are checked like the rest of the plane, CRC-8 included.
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        slave.planeCheck = PlaneCheck::CRC8;
+        cPlane_Status::Encode(plane, 4);
+        Packet.GetCRC8(plane, cPlane_Status::size - 1, &crc);
+        plane[cPlane_Status::size - 1] = ChunkType::Check + crc;
+        planeSize = cPlane_Status::size;
+        cTerminal::TagPlane(plane, &planeSize, 2, PlaneCheck::CRC8);
+        for(int i=0; i<planeSize; ++i)
+        {
+            result = slave._HandlePlaneArrival(plane[i]);
+        }
+        if(result != Execution::Passed || slave.GetLastSequenceTag(&tag) != Execution::Passed || tag != 2 || gate.Read(&value) != Execution::Passed || value != 4)
+        {
+            TestFailed("A CRC-8 checked plane did not dock.");
+            TestExpectedVSGotten("2", std::to_string(tag).c_str());
+            result = Execution::Failed;
+        }
+    }
+
+    // Its answer is tagged and checked the same way.
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        slave.GetNextDepartingPlaneID(&planeID);
+        result = slave.BoardPlane(planeID, plane, &planeSize);
+        if(result != Execution::Passed || plane[planeSize - 2] != ChunkType::Byte + 2 || Packet.IndexPlane(plane, planeSize, &planeIndex, PlaneCheck::CRC8) != Execution::Passed)
+        {
+            TestFailed("The answer is not tagged and checked like its request.");
+            TestExecution(result);
+            result = Execution::Failed;
+        }
+    }
+
+    // The gate dies with this test, the global terminals must forget it.
+    master.SetDockingGate(STATUS_PLANE_ID, nullptr, nullptr, nullptr);
+    slave.SetDockingGate(STATUS_PLANE_ID, nullptr, nullptr, nullptr);
+    master.sequenceTags = false;
+    slave.sequenceTags = false;
+    slave.planeCheck = PlaneCheck::AdditiveSum;
+    master.departureStatus = masterStatus;
+    slave.departureStatus = slaveStatus;
+    if(result != Execution::Passed)
+    {
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Function that returns
+ * execution::passed if a request sent
+ * through the master terminal docks on
+ * the slave terminal and if the gate's
+ * answer departs from it back to the
+ * master terminal.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TERMINAL_Answers()
+{
+    Execution result;
+    // Gates taxi on the global terminals, the test has to use them.
+    TerminalStatus masterStatus = MasterTerminal.departureStatus;
+    TerminalStatus slaveStatus = SlaveTerminal.departureStatus;
+    cGate_Status gate;
+    unsigned short plane[MAX_PLANE_PASSENGER_CAPACITY];
+    unsigned char planeID = 0;
+    int planeSize = 0;
+    int expected = 0;
+    int value = 0;
+
+    TestStart("Terminal - Answers");
+    TestStepDone();
+    MasterTerminal.departureStatus = TerminalStatus::DepartureAvailable;
+    SlaveTerminal.departureStatus = TerminalStatus::DepartureAvailable;
+    Device.GetStatus(&expected);
+    if(DockGate(&MasterTerminal, &SlaveTerminal, &gate) != Execution::Passed)
+    {
+        TestFailed("The gate could not be docked.");
+        return Execution::Failed;
+    }
+
+    // The request leaves the master terminal.
+    TestStepDone();
+    if(gate.Request() != Execution::Passed || MasterTerminal.GetNextDepartingPlaneID(&planeID) != Execution::Passed || planeID != STATUS_PLANE_ID)
+    {
+        TestFailed("The request did not taxi.");
+        TestExpectedVSGotten(std::to_string(STATUS_PLANE_ID).c_str(), std::to_string(planeID).c_str());
+        result = Execution::Failed;
+    }
+    else
+    {
+        result = MasterTerminal.BoardPlane(planeID, plane, &planeSize);
+        if(result != Execution::Passed)
+        {
+            TestFailed("The request did not board.");
+            TestExecution(result);
+            result = Execution::Failed;
+        }
+    }
+
+    // It docks on the slave terminal, which puts the answer on its taxiway.
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        for(int i=0; i<planeSize; ++i)
+        {
+            SlaveTerminal._HandlePlaneArrival(plane[i]);
+        }
+        if(gate.Read(&value) != Execution::Passed || value != expected || SlaveTerminal.GetNextDepartingPlaneID(&planeID) != Execution::Passed || planeID != STATUS_PLANE_ID)
+        {
+            TestFailed("The request did not get an answer taxiing.");
+            TestExpectedVSGotten(std::to_string(STATUS_PLANE_ID).c_str(), std::to_string(planeID).c_str());
+            result = Execution::Failed;
+        }
+    }
+
+    // The answer boards on the slave terminal.
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        value = -1;
+        result = SlaveTerminal.BoardPlane(planeID, plane, &planeSize);
+        if(result != Execution::Passed || cPlane_Status::Decode(plane, planeSize, &value) != Execution::Passed || value != expected)
+        {
+            TestFailed("The answer did not board.");
+            TestExpectedVSGotten(std::to_string(expected).c_str(), std::to_string(value).c_str());
+            result = Execution::Failed;
+        }
+    }
+
+    // And lands back where the request came from.
+    if(result == Execution::Passed)
+    {
+        TestStepDone();
+        value = -1;
+        for(int i=0; i<planeSize; ++i)
+        {
+            MasterTerminal._HandlePlaneArrival(plane[i]);
+        }
+        if(gate.Read(&value) != Execution::Passed || value != expected)
+        {
+            TestFailed("The answer did not dock at its gate.");
+            TestExpectedVSGotten(std::to_string(expected).c_str(), std::to_string(value).c_str());
+            result = Execution::Failed;
+        }
+    }
+
+    // The gate dies with this test, the global terminals must forget it.
+    MasterTerminal.SetDockingGate(STATUS_PLANE_ID, nullptr, nullptr, nullptr);
+    SlaveTerminal.SetDockingGate(STATUS_PLANE_ID, nullptr, nullptr, nullptr);
+    MasterTerminal.departureStatus = masterStatus;
+    SlaveTerminal.departureStatus = slaveStatus;
+    if(result != Execution::Passed)
+    {
+        return Execution::Failed;
+    }
+    TestPassed();
+
+    return Execution::Passed;
+}
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if terminal works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cTerminal_LaunchTests()
+{
+    StartOfUnitTest("class cTerminal");
+    Execution result;
+
+    result = TEST_TERMINAL_Arrival();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_Drops();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_WireModes();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_CutThrough();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_Taxiway();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_DepartureRunway();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_ArrivalRunway();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_Dispatch();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_Handshake();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_HandshakeExchange();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_SequenceTags();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    result = TEST_TERMINAL_Answers();
+    if(result == Execution::Failed)
+    {
+        UnitTestFailed();
+        return Execution::Failed;
+    }
+
+    UnitTestPassed();
+    return Execution::Passed;
+}
@@ -0,0 +1,60 @@
+/**
+ * @file _UNIT_TEST_Tower.h
+ * @author Lyam (lyam.brs@gmail.com)
+ * @brief This file contains the various
+ * definitions of unit test functions used
+ * to verify that the Tower class functions
+ * as intended.
+ * @version 0.1
+ * @date 2026-10-17
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+/*  ############    ############     ##########
+    ############    ############     ##########
+              ##              ##   ##
+    ####    ##      ####    ##     ############
+    ####    ##      ####    ##     ############
+              ##              ##             ##
+    ############    ####      ##   ##########
+    ############    ####      ##   ##########*/
+
+
+#include "Globals.h"
+
+#ifndef TOWER_UNIT_TEST_H
+  #define TOWER_UNIT_TEST_H
+
+/**
+ * @brief Function that returns
+ * execution::passed if deadlines expire
+ * closest first, only once their time
+ * came, even across a millis() wrap, and
+ * if they can be replaced or cancelled.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TOWER_Deadlines();
+/**
+ * @brief Function that returns
+ * execution::passed if a gate whose plane
+ * does not come back in time is woken by
+ * the tower, and if a gate whose plane
+ * docked is forgotten.
+ * 
+ * @return Execution 
+ */
+Execution TEST_TOWER_GateTimeout();
+
+/**
+ * @brief Unit test function which returns
+ * Execution::Passed if tower works
+ * successfully for each methods it has.
+ * @return Execution 
+ */
+Execution cTower_LaunchTests();
+
+
+#endif